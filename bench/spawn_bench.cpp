@@ -0,0 +1,149 @@
+/*
+ * Spawn latency of subprocess::run (posix_spawn, one epoll loop on the calling thread) against
+ * the thread-per-pipe design it replaced, where every pipe has a thread blocked in read
+ *
+ *  build/spawn_bench [iterations]
+ */
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "holofetch/subprocess.hpp"
+
+extern char** environ;
+
+namespace {
+
+    using clock = std::chrono::steady_clock;
+
+    struct command {
+        std::string_view line;
+        std::vector<const char*> argv;
+    };
+
+    void read_all(int fd, std::string& out) {
+        char buffer[16 * 1024];
+        for (;;) {
+            ssize_t n = ::read(fd, buffer, sizeof(buffer));
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                break;
+            out.append(buffer, static_cast<size_t>(n));
+        }
+    }
+
+    /*
+     * The reference: blocking pipes, a reader thread each for stdout and stderr, waitpid
+     */
+    size_t run_thread_per_pipe(const command& c) {
+        int out[2];
+        int err[2];
+        if (::pipe2(out, O_CLOEXEC) != 0 || ::pipe2(err, O_CLOEXEC) != 0)
+            std::abort();
+
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+        posix_spawn_file_actions_adddup2(&actions, out[1], STDOUT_FILENO);
+        posix_spawn_file_actions_adddup2(&actions, err[1], STDERR_FILENO);
+
+        pid_t pid = -1;
+        auto argv = c.argv;
+        argv.push_back(nullptr);
+        if (::posix_spawnp(&pid, argv[0], &actions, nullptr, const_cast<char* const*>(argv.data()), environ) != 0)
+            std::abort();
+        posix_spawn_file_actions_destroy(&actions);
+
+        ::close(out[1]);
+        ::close(err[1]);
+
+        std::string stdout_text;
+        std::string stderr_text;
+        std::thread out_reader{[&] { read_all(out[0], stdout_text); }};
+        std::thread err_reader{[&] { read_all(err[0], stderr_text); }};
+        out_reader.join();
+        err_reader.join();
+
+        int status = 0;
+        while (::waitpid(pid, &status, 0) < 0 && errno == EINTR);
+
+        ::close(out[0]);
+        ::close(err[0]);
+        return stdout_text.size() + stderr_text.size();
+    }
+
+    size_t run_epoll(const command& c) {
+        auto r = holofetch::subprocess::run(c.line);
+        if (!r)
+            std::abort();
+        return r->out.size() + r->err.size();
+    }
+
+    struct summary {
+        double mean;
+        double median;
+        double p99;
+    };
+
+    template <class Run>
+    summary measure(const command& c, size_t iterations, Run&& run) {
+        std::vector<double> samples;
+        samples.reserve(iterations);
+
+        // the first spawns page the binaries in
+        for (size_t i = 0; i < 5; ++i) {
+            run(c);
+        }
+
+        for (size_t i = 0; i < iterations; ++i) {
+            auto start = clock::now();
+            run(c);
+            samples.push_back(std::chrono::duration<double, std::micro>(clock::now() - start).count());
+        }
+
+        std::sort(samples.begin(), samples.end());
+        double total = 0;
+        for (double s : samples) {
+            total += s;
+        }
+        return {total / samples.size(), samples[samples.size() / 2], samples[std::min(samples.size() - 1, samples.size() * 99 / 100)]};
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+    if (iterations == 0) {
+        std::fprintf(stderr, "usage: spawn_bench [iterations]\n");
+        return 1;
+    }
+
+    const std::vector<command> commands{
+        {"true", {"true"}},
+        {"echo holofetch", {"echo", "holofetch"}},
+        {"head -c 1048576 /dev/zero", {"head", "-c", "1048576", "/dev/zero"}},
+    };
+
+    std::printf("%-28s %-16s %10s %10s %10s\n", "command", "design", "mean us", "median us", "p99 us");
+    for (const auto& c : commands) {
+        auto threads = measure(c, iterations, run_thread_per_pipe);
+        auto epoll = measure(c, iterations, run_epoll);
+
+        std::printf("%-28.*s %-16s %10.1f %10.1f %10.1f\n", static_cast<int>(c.line.size()), c.line.data(), "thread per pipe", threads.mean, threads.median, threads.p99);
+        std::printf("%-28.*s %-16s %10.1f %10.1f %10.1f\n", static_cast<int>(c.line.size()), c.line.data(), "epoll", epoll.mean, epoll.median, epoll.p99);
+    }
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ * Width of printable ASCII text through unicode::ascii_run (a vector of bytes at a time) against
+ * a byte at a time loop and the decode_utf8 + codepoint_width path every byte took before it
+ * build.sh compiles with -O0, the numbers that matter come from an optimized build:
+ *
+ *  g++ -std=c++23 -O2 -Iinclude bench/unicode_bench.cpp src/unicode.cpp -o build/unicode_bench
+ *  build/unicode_bench [iterations]
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "holofetch/unicode.hpp"
+
+namespace {
+
+    using clock = std::chrono::steady_clock;
+
+    namespace unicode = holofetch::unicode;
+
+    struct text {
+        std::string_view name;
+        std::string value;
+    };
+
+    size_t decoded_width(std::string_view s) {
+        size_t width = 0;
+        for (size_t i = 0; i < s.size();) {
+            size_t length;
+            width += static_cast<size_t>(unicode::codepoint_width(unicode::decode_utf8(s.substr(i), length)));
+            i += length;
+        }
+        return width;
+    }
+
+    size_t byte_loop(std::string_view s) {
+        size_t i = 0;
+        while (i < s.size() && static_cast<unsigned char>(s[i]) >= 0x20 && static_cast<unsigned char>(s[i]) < 0x7F) {
+            ++i;
+        }
+        return i;
+    }
+
+    size_t vector_run(std::string_view s) {
+        return unicode::ascii_run(s);
+    }
+
+    struct summary {
+        double median;
+        double per_byte;
+    };
+
+    /*
+     * Nanoseconds per call, the results are summed so the calls cannot be dropped
+     */
+    template <class Measure>
+    summary measure(const std::string& s, size_t iterations, Measure&& measure_width) {
+        constexpr size_t calls = 1000;
+        std::vector<double> samples;
+        samples.reserve(iterations);
+
+        volatile size_t sink = 0;
+        for (size_t i = 0; i < iterations; ++i) {
+            size_t total = 0;
+            auto start = clock::now();
+            for (size_t c = 0; c < calls; ++c) {
+                total += measure_width(std::string_view{s});
+            }
+            samples.push_back(std::chrono::duration<double, std::nano>(clock::now() - start).count() / calls);
+            sink = sink + total;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        const double median = samples[samples.size() / 2];
+        return {median, median / static_cast<double>(s.size())};
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+    if (iterations == 0) {
+        std::fprintf(stderr, "usage: unicode_bench [iterations]\n");
+        return 1;
+    }
+
+    // a property value, a line of a banner and one that does not fill a vector
+    const std::vector<text> texts{
+        {"property (58 B)", "Intel(R) Core(TM) i7-12700H CPU @ 2.30GHz (20 threads) x2"},
+        {"banner (200 B)", std::string(200, '#')},
+        {"short (12 B)", "Linux 6.18.4"},
+    };
+
+    std::printf("%-18s %-16s %10s %10s\n", "text", "design", "ns/call", "ns/byte");
+    for (const auto& t : texts) {
+        auto decoded = measure(t.value, iterations, decoded_width);
+        auto bytes = measure(t.value, iterations, byte_loop);
+        auto run = measure(t.value, iterations, vector_run);
+
+        std::printf("%-18.*s %-16s %10.1f %10.3f\n", static_cast<int>(t.name.size()), t.name.data(), "decode + width", decoded.median, decoded.per_byte);
+        std::printf("%-18.*s %-16s %10.1f %10.3f\n", static_cast<int>(t.name.size()), t.name.data(), "byte loop", bytes.median, bytes.per_byte);
+        std::printf("%-18.*s %-16s %10.1f %10.3f\n", static_cast<int>(t.name.size()), t.name.data(), "ascii_run", run.median, run.per_byte);
+    }
+
+    return 0;
+}
@@ -13,10 +13,38 @@ CL.EXE /std:c++latest /EHsc /Zi /Od /c /Iextern `
 # COMPILE INTERNALS
 CL.EXE /std:c++latest /EHsc /Zi /Od /c /Iinclude /Iextern `
     /D_UNICODE=1 /DUNICODE=1 /source-charset:utf-8 /execution-charset:utf-8 `
-    src/subprocess.cpp src/network.cpp src/info.cpp src/renderer.cpp src/main.cpp /Fobuild/ /Fdbuild/
+    src/mapped_file.cpp src/shared_memory.cpp src/metadata.cpp src/probe.cpp src/cache.cpp src/executables.cpp src/subprocess_common.cpp src/subprocess.cpp src/network.cpp src/info.cpp src/daemon.cpp src/console.cpp src/arena.cpp src/sgr.cpp src/unicode.cpp src/ansi.cpp src/avatar.cpp src/canvas.cpp src/layout.cpp src/renderer.cpp `
+    src/main.cpp src/holofetchd.cpp /Fobuild/ /Fdbuild/
 
-# LINK EXECUTABLE
-LINK.EXE /DEBUG:FULL build/Registry.obj `
-    build/subprocess.obj build/network.obj build/info.obj build/renderer.obj build/main.obj `
+$objects = @(
+    'build/Registry.obj',
+    'build/mapped_file.obj', 'build/shared_memory.obj', 'build/metadata.obj', 'build/probe.obj', 'build/cache.obj', 'build/executables.obj',
+    'build/subprocess_common.obj', 'build/subprocess.obj', 'build/network.obj', 'build/info.obj', 'build/daemon.obj'
+)
+
+# LINK EXECUTABLES
+LINK.EXE /DEBUG:FULL @objects build/console.obj build/arena.obj build/sgr.obj build/unicode.obj build/ansi.obj build/avatar.obj build/canvas.obj build/layout.obj build/renderer.obj build/main.obj `
     user32.lib Advapi32.lib `
     /OUT:build/holofetch.exe
+
+LINK.EXE /DEBUG:FULL @objects build/holofetchd.obj `
+    user32.lib Advapi32.lib `
+    /OUT:build/holofetchd.exe
+
+# BUILD TESTS, *_linux_test.cpp take POSIX
+foreach ($test in Get-ChildItem tests/*_test.cpp -Exclude *_linux_test.cpp) {
+    CL.EXE /std:c++latest /EHsc /Zi /Od /Iinclude /Iextern `
+        /D_UNICODE=1 /DUNICODE=1 /source-charset:utf-8 /execution-charset:utf-8 `
+        $test.FullName @objects build/console.obj build/arena.obj build/sgr.obj build/unicode.obj build/ansi.obj build/avatar.obj build/canvas.obj build/layout.obj build/renderer.obj `
+        user32.lib Advapi32.lib `
+        /Fobuild/ /Fdbuild/ /Febuild/$($test.BaseName).exe
+}
+
+# RUN TESTS, ./build.ps1 test
+if ($args[0] -eq 'test') {
+    foreach ($test in Get-ChildItem build/*_test.exe) {
+        Write-Output $test.Name
+        & $test.FullName
+        if ($LASTEXITCODE -ne 0) { exit $LASTEXITCODE }
+    }
+}
@@ -0,0 +1,57 @@
+#!/bin/sh
+# STOP ON BUILD ERROR
+set -e
+
+CXX="${CXX:-g++}"
+CXXFLAGS="-std=c++23 -g -O0 -pthread -finput-charset=UTF-8 -fexec-charset=UTF-8"
+
+# PREPARE BUILD DIRECTORY
+rm -rf build
+mkdir -p build
+
+# COMPILE INTERNALS
+for src in \
+    src/mapped_file.cpp src/shared_memory.cpp src/metadata.cpp src/probe.cpp src/cache.cpp src/executables.cpp \
+    src/subprocess_common.cpp src/subprocess_linux.cpp src/network_linux.cpp src/info_linux.cpp src/daemon.cpp src/console_linux.cpp src/arena.cpp src/sgr.cpp src/unicode.cpp src/ansi.cpp src/avatar.cpp src/canvas.cpp src/layout.cpp src/renderer.cpp \
+    src/main.cpp src/holofetchd.cpp
+do
+    $CXX $CXXFLAGS -c -Iinclude -Iextern "$src" -o "build/$(basename "${src%.cpp}").o"
+done
+
+OBJECTS="build/mapped_file.o build/shared_memory.o build/metadata.o build/probe.o build/cache.o build/executables.o \
+    build/subprocess_common.o build/subprocess_linux.o build/network_linux.o build/info_linux.o build/daemon.o"
+RENDERER="build/console_linux.o build/arena.o build/sgr.o build/unicode.o build/ansi.o build/avatar.o build/canvas.o build/layout.o build/renderer.o"
+
+# LINK EXECUTABLES
+$CXX -pthread $OBJECTS $RENDERER build/main.o -lrt -o build/holofetch
+$CXX -pthread $OBJECTS build/holofetchd.o -lrt -o build/holofetchd
+
+# BUILD TESTS
+for test in tests/*_test.cpp
+do
+    $CXX $CXXFLAGS -Iinclude -Iextern "$test" $OBJECTS $RENDERER -lrt -o "build/$(basename "${test%.cpp}")"
+done
+
+# BUILD BENCHMARKS
+for bench in bench/*_bench.cpp
+do
+    $CXX $CXXFLAGS -Iinclude -Iextern "$bench" $OBJECTS $RENDERER -lrt -o "build/$(basename "${bench%.cpp}")"
+done
+
+# RUN TESTS, ./build.sh test
+if [ "$1" = "test" ]; then
+    for test in build/*_test
+    do
+        echo "$test"
+        "$test"
+    done
+fi
+
+# RUN BENCHMARKS, ./build.sh bench
+if [ "$1" = "bench" ]; then
+    for bench in build/*_bench
+    do
+        echo "$bench"
+        "$bench"
+    done
+fi
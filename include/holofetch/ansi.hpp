@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include "holofetch/sgr.hpp"
+
+namespace holofetch::ansi {
+
+    enum class token_kind : uint8_t {
+        end,        // the text is used up
+        text,       // printable ASCII, a column per byte
+        glyph,      // one code point of any other width
+        newline,
+        control,    // any other C0 control or DEL
+        sgr,        // an SGR sequence, parser::style() has it applied
+        sequence,   // any other escape, control or string sequence, SGR the style cannot model included
+    };
+
+    struct token {
+        token_kind kind{token_kind::end};
+        std::string_view bytes;
+        char32_t codepoint{0};  // of a glyph
+        size_t width{0};        // columns text or a glyph takes, 0 for everything else
+    };
+
+    /*
+     * ECMA-48 parser for UTF-8 text, following the state machine of the DEC VT500 series:
+     * C0 controls inside an escape or control sequence are executed without ending it, CAN and
+     * SUB cancel it, ESC starts a new one; OSC ends at BEL or ST, DCS, SOS, PM and APC at ST
+     * 8-bit C1 controls are not recognised, their bytes belong to UTF-8 sequences
+     * Cancelled and unterminated sequences produce no token
+     */
+    class parser {
+        enum class state : uint8_t {
+            ground,
+            escape,
+            escape_intermediate,
+            csi,
+            string,
+            string_escape,      // ESC inside a string, ST if '\' follows
+        };
+
+        std::string_view text_;
+        size_t position_{0};
+        size_t start_{0};       // of the sequence being parsed
+        state state_{state::ground};
+        bool osc_{false};       // the string may end at BEL
+        bool plain_csi_{false}; // no private parameters, intermediates or controls so far, may be SGR
+        bool styled_{true};
+        sgr::style style_;
+
+    public:
+        explicit parser(std::string_view text, const sgr::style& initial = {}) noexcept
+            : text_{text}, style_{initial} {}
+
+        /*
+         * Only tells text from sequences, which is all measuring needs: every CSI ending in 'm'
+         * without private parameters comes out as sgr and style() stays as it is
+         */
+        static parser unstyled(std::string_view text) noexcept {
+            parser p{text};
+            p.styled_ = false;
+            return p;
+        }
+
+        token next() noexcept;
+
+        /*
+         * The SGR state after the tokens returned so far
+         */
+        const sgr::style& style() const noexcept { return style_; }
+
+        size_t position() const noexcept { return position_; }
+
+    private:
+        token complete(token_kind kind) noexcept;
+        token complete_csi(unsigned char last) noexcept;
+    };
+
+    struct line {
+        size_t offset{0};       // of its first byte
+        size_t length{0};       // in bytes, without the newline and a carriage return before it
+        size_t width{0};        // columns it takes on a terminal
+        sgr::style style;       // SGR state at its end
+    };
+
+    /*
+     * Lines of ANSI text found in a single pass of the parser; every newline ends one, empty
+     * lines included, and text after the last newline makes the last line
+     * The index points into the text, which has to outlive it
+     */
+    class line_index {
+        std::string_view text_;
+        std::pmr::vector<line> lines_;
+        size_t width_{0};
+
+    public:
+        line_index() = default;
+        explicit line_index(std::string_view text, const sgr::style& initial = {}, std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+
+        size_t size() const noexcept { return lines_.size(); }
+        bool empty() const noexcept { return lines_.empty(); }
+
+        const line& operator[](size_t i) const noexcept { return lines_[i]; }
+        auto begin() const noexcept { return lines_.begin(); }
+        auto end() const noexcept { return lines_.end(); }
+
+        std::string_view view(size_t i) const noexcept {
+            return text_.substr(lines_[i].offset, lines_[i].length);
+        }
+
+        /*
+         * Of the widest line
+         */
+        size_t width() const noexcept { return width_; }
+    };
+
+    /*
+     * Columns the widest line of text takes on a terminal, without keeping an index
+     */
+    size_t width(std::string_view text) noexcept;
+
+} // namespace holofetch::ansi
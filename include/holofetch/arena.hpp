@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace holofetch {
+
+    /*
+     * Memory for everything one frame allocates, handed out by bumping a pointer through one
+     * buffer and given back all at once by reset()
+     * A frame that outgrows the buffer takes the rest from the heap, the next reset() grows the
+     * buffer by that much so that frames of the same size stop allocating after the first one
+     */
+    class frame_arena {
+        /*
+         * The heap, counting what the arena had to take from it
+         */
+        class overflow_resource : public std::pmr::memory_resource {
+            size_t allocated_{0};
+        public:
+            size_t allocated() const noexcept { return allocated_; }
+            void clear() noexcept { allocated_ = 0; }
+
+        private:
+            void* do_allocate(size_t bytes, size_t alignment) override;
+            void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+        };
+
+        std::unique_ptr<std::byte[]> buffer_;
+        size_t capacity_{0};
+        overflow_resource overflow_;
+        std::optional<std::pmr::monotonic_buffer_resource> resource_;
+
+    public:
+        explicit frame_arena(size_t capacity = 64 * 1024);
+
+        frame_arena(const frame_arena&) = delete;
+        frame_arena& operator=(const frame_arena&) = delete;
+
+        std::pmr::memory_resource* resource() noexcept { return &*resource_; }
+
+        /*
+         * Releases everything allocated since the last reset, nothing allocated from resource()
+         * before may be used afterwards
+         */
+        void reset();
+
+        size_t capacity() const noexcept { return capacity_; }
+    };
+
+} // namespace holofetch
@@ -20,11 +20,4 @@ namespace holofetch::assets {
         |_|                                                              
                                                                          
 )";
-
-    constexpr std::string_view whitespaces = //[256]
-    "                                                                                                                                "
-    "                                                                                                                                ";
-    
-    constexpr std::string_view dots = //[64]
-    "................................................................";
 }
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "holofetch/mapped_file.hpp"
+#include "holofetch/sgr.hpp"
+
+namespace holofetch {
+
+    /*
+     * Avatar parsed once into a grid of cells, stored in a flat little-endian file that is used
+     * straight from its memory mapping:
+     *
+     *  header      magic, version, byte order mark, width, height, sizes, flags
+     *  palette     palette_size x u32, every distinct sgr::color
+     *  rows        (height + 1) x u32, index of the first run of every row, the last one is run_count
+     *  runs        run_count x run, cells in a row with the same codepoint and style
+     *
+     * width and row lengths are in columns, a run of wide code points takes two per cell
+     * A row may hold fewer columns than width, it is drawn as it was in the source
+     */
+    class compiled_avatar {
+    public:
+        static constexpr std::string_view magic{"holoava\n"};
+        static constexpr uint32_t format_version{2};
+        static constexpr std::string_view extension{".hfa"};
+
+        struct run {
+            uint32_t codepoint;
+            uint16_t fg;            // palette index
+            uint16_t bg;            // palette index
+            uint16_t attributes;    // sgr::attribute bits
+            uint16_t length;
+        };
+
+        enum flags : uint32_t {
+            textured = 1 << 0,      // has '#' cells for the texture to fill
+        };
+
+    private:
+        mapped_file file_;
+        std::vector<std::byte> owned_;
+        uint32_t width_{0};
+        uint32_t height_{0};
+        uint32_t flags_{0};
+        std::span<const uint32_t> palette_;
+        std::span<const uint32_t> rows_;
+        std::span<const run> runs_;
+
+    public:
+        compiled_avatar() = default;
+
+        /*
+         * Parses ANSI art: text, newlines and SGR sequences, a row for every line (see ansi::line_index)
+         * Returns nothing if it holds other escape sequences or needs more than 65536 colors
+         */
+        static std::optional<compiled_avatar> compile(std::string_view ans);
+
+        /*
+         * Memory-maps a compiled avatar, nothing if the file is missing, from another format
+         * version or byte order, or malformed
+         */
+        static std::optional<compiled_avatar> load(const std::filesystem::path& file) noexcept;
+
+        /*
+         * The avatar for source: source itself if it is compiled already, otherwise the compiled
+         * copy in cache_directory named after the hash of its content, compiled and stored there
+         * when missing; an empty cache_directory compiles without storing
+         */
+        static std::optional<compiled_avatar> load_or_compile(const std::filesystem::path& source, const std::filesystem::path& cache_directory);
+
+        static std::filesystem::path default_cache_directory();
+
+        /*
+         * An avatar built into the program from a header written by save_header(), the arrays
+         * are used in place and checked at compile time instead of by attach()
+         */
+        static compiled_avatar embedded(uint32_t width, uint32_t height, uint32_t flags, std::span<const uint32_t> palette, std::span<const uint32_t> rows, std::span<const run> runs) noexcept;
+
+        /*
+         * Writes aside and renames, returns false if the file could not be written
+         * An embedded avatar has no file image and cannot be saved
+         */
+        bool save(const std::filesystem::path& file) const;
+
+        /*
+         * Writes a C++ header with the avatar as constexpr arrays and holofetch::assets::name()
+         * returning it embedded; generator is the command line noted in the header
+         */
+        bool save_header(const std::filesystem::path& file, std::string_view name, std::string_view generator) const;
+
+        uint32_t width() const noexcept { return width_; }
+        uint32_t height() const noexcept { return height_; }
+        bool is_textured() const noexcept { return flags_ & textured; }
+
+        std::span<const run> row(size_t y) const noexcept {
+            return runs_.subspan(rows_[y], rows_[y + 1] - rows_[y]);
+        }
+
+        /*
+         * Number of columns row y takes
+         */
+        size_t row_length(size_t y) const noexcept;
+
+        sgr::style style_of(const run& r) const noexcept {
+            return {palette_[r.fg], palette_[r.bg], r.attributes};
+        }
+
+        /*
+         * The file image
+         */
+        std::span<const std::byte> bytes() const noexcept;
+
+    private:
+        bool attach(std::span<const std::byte> image) noexcept;
+    };
+
+} // namespace holofetch
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "holofetch/executables.hpp"
+#include "holofetch/subprocess.hpp"
+
+namespace holofetch {
+
+    enum class cache_mode {
+        enabled,    // read and write the cache file
+        disabled,   // never touch the cache file
+        refresh     // ignore stored entries, write fresh ones
+    };
+
+    /*
+     * Persistent store for slow-changing host facts (tool versions, OS product string, CPU/GPU names)
+     * Every entry has its own expiry time and an invalidation key, the entry is a miss
+     * when the key it was stored with differs from the current one
+     * get/put are thread safe, so concurrent probes can share one instance
+     */
+    class fact_cache {
+    public:
+        static constexpr std::string_view format_version{"holofetch-cache 1"};
+
+        struct entry {
+            std::string value;
+            std::string key;
+            int64_t expires{0}; // seconds since epoch
+        };
+
+    private:
+        std::filesystem::path file_;
+        cache_mode mode_{cache_mode::disabled};
+        std::unordered_map<std::string, entry> entries_;
+        mutable std::mutex mutex_;
+        std::atomic<size_t> hits_{0};
+        std::atomic<size_t> misses_{0};
+        bool dirty_{false};
+
+    public:
+        fact_cache() = default;
+        explicit fact_cache(std::filesystem::path file, cache_mode mode = cache_mode::enabled);
+        ~fact_cache() = default;
+
+        fact_cache(const fact_cache&) = delete;
+        fact_cache& operator=(const fact_cache&) = delete;
+
+        std::optional<std::string> get(std::string_view name, std::string_view key = {});
+        void put(std::string_view name, std::string value, std::chrono::seconds ttl, std::string_view key = {});
+
+        /*
+         * Writes the cache file if anything was put, does nothing in disabled mode
+         * Returns false if the file could not be written
+         */
+        bool save();
+
+        size_t hits() const noexcept { return hits_; }
+        size_t misses() const noexcept { return misses_; }
+        const std::filesystem::path& file() const noexcept { return file_; }
+
+        /*
+         * %LOCALAPPDATA%\holofetch\facts.cache on Windows,
+         * $XDG_CACHE_HOME/holofetch/facts.cache or ~/.cache/holofetch/facts.cache elsewhere
+         */
+        static std::filesystem::path default_path();
+
+    private:
+        void load();
+    };
+
+    /*
+     * Writes content to a uniquely named file next to file and renames it over file,
+     * so readers and concurrent writers never see half a file
+     */
+    bool write_replacing(const std::filesystem::path& file, std::string_view content);
+
+    /*
+     * Invalidation key of a file: "path|mtime|size", empty if the file does not exist
+     */
+    std::string file_fingerprint(const std::filesystem::path& path) noexcept;
+
+    /*
+     * How the version of one tool is found
+     * resolve maps the executable found in PATH to the binary to read, which differs for launchers
+     * such as rustup proxies or pyenv shims (none: the executable itself)
+     * read looks at that binary without running anything, command is what to run when it finds
+     * nothing (none or empty: give up) and parse turns the first line it writes to channel into the version
+     * parse also gets an empty line when the command could not run or timed out
+     */
+    struct tool_version_query {
+        std::string_view tool;
+        std::function<std::filesystem::path(const std::filesystem::path&)> resolve{};
+        std::function<std::string(const std::filesystem::path&)> read{};
+        std::function<std::string(const std::filesystem::path&)> command{};
+        subprocess::channel channel{subprocess::channel::out};
+        std::function<std::string(const std::filesystem::path&, std::string_view)> parse{};
+    };
+
+    /*
+     * Versions of tools keyed by the fingerprint of the binary they read, one per query in order
+     * Commands of all tools that are neither cached nor readable run as one subprocess::run_all batch,
+     * so their startup times overlap and timeout bounds them all together
+     * A tool that is not in PATH is cached as missing, so a warm run spawns nothing at all
+     * A failed query of a present tool is not cached, it may have just timed out
+     */
+    std::vector<std::string> cached_tool_versions(fact_cache& cache, std::span<const tool_version_query> tools, std::chrono::seconds ttl, std::chrono::milliseconds timeout);
+
+} // namespace holofetch
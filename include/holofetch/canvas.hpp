@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "holofetch/sgr.hpp"
+
+namespace holofetch {
+
+    /*
+     * Grid of cells, kept as one array per field (codepoints, foreground, background, attributes)
+     * so that clearing, blitting and scanning a row touch only what they need
+     *
+     * A cell with codepoint 0 is empty: blit leaves what is under it and encode writes a blank
+     * in the default style
+     * A wide glyph takes two cells, the right one holds wide_tail
+     *
+     * The arrays come from the memory resource given, a copy uses the default one
+     */
+    class canvas {
+        size_t width_{0};
+        size_t height_{0};
+        std::pmr::vector<char32_t> codepoints_;
+        std::pmr::vector<sgr::color> fg_;
+        std::pmr::vector<sgr::color> bg_;
+        std::pmr::vector<uint16_t> attributes_;
+
+    public:
+        static constexpr char32_t wide_tail{0xFFFFFFFF};
+
+        canvas() = default;
+
+        explicit canvas(std::pmr::memory_resource* memory) noexcept
+            : codepoints_{memory}, fg_{memory}, bg_{memory}, attributes_{memory} {}
+
+        canvas(size_t width, size_t height, std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+            : canvas{memory} {
+            resize(width, height);
+        }
+
+        /*
+         * Every cell is empty afterwards, capacity is kept
+         */
+        void resize(size_t width, size_t height);
+        void clear() noexcept;
+
+        /*
+         * Room for width x height cells, resizing to no more than that does not allocate
+         */
+        void reserve(size_t width, size_t height);
+
+        size_t width() const noexcept { return width_; }
+        size_t height() const noexcept { return height_; }
+        bool empty() const noexcept { return width_ == 0 || height_ == 0; }
+
+        char32_t codepoint(size_t x, size_t y) const noexcept {
+            return codepoints_[y * width_ + x];
+        }
+
+        sgr::style style(size_t x, size_t y) const noexcept {
+            size_t i = y * width_ + x;
+            return {fg_[i], bg_[i], attributes_[i]};
+        }
+
+        /*
+         * Cells outside the canvas are ignored
+         */
+        void set(size_t x, size_t y, char32_t codepoint, const sgr::style& s) noexcept;
+
+        /*
+         * Prints ANSI text from (x, y) the way a terminal would (see ansi::parser): SGR sequences
+         * change current, a newline continues at column x of the next row, other sequences,
+         * control characters and zero width code points are dropped; current is left as the text
+         * leaves it
+         * Returns the column after the last cell printed on the last row
+         */
+        size_t print(size_t x, size_t y, std::string_view text, sgr::style& current);
+
+        size_t print(size_t x, size_t y, std::string_view text) {
+            sgr::style current;
+            return print(x, y, text, current);
+        }
+
+        /*
+         * Number of cells the widest line of text takes when printed, see ansi::width
+         */
+        static size_t columns(std::string_view text) noexcept;
+
+        /*
+         * Copies the non-empty cells of source with its top left corner at (x, y), clipped to this canvas
+         */
+        void blit(const canvas& source, size_t x, size_t y) noexcept;
+
+        /*
+         * Appends every row followed by a newline, trailing blanks left out, colors downsampled
+         * to depth and no more SGR sequences than the cells need (see sgr::encoder)
+         * The style is back to the default at every newline
+         */
+        void encode(std::string& out, sgr::color_depth depth) const;
+
+        /*
+         * Appends what turns previous into this canvas on a terminal that shows previous from its
+         * top left corner: cursor moves and the cells that differ, short runs of equal cells
+         * between them are written again when that is cheaper than moving over them
+         * Both canvases must have the same size; the style is back to the default at the end
+         */
+        void encode_changes(const canvas& previous, std::string& out, sgr::color_depth depth) const;
+
+    private:
+        bool blank_at(size_t i) const noexcept;
+        bool same_at(const canvas& other, size_t i) const noexcept;
+        void encode_cell(sgr::encoder& e, size_t i) const;
+    };
+
+} // namespace holofetch
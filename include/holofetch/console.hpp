@@ -0,0 +1,114 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+
+#include "holofetch/sgr.hpp"
+
+namespace holofetch {
+
+    /*
+     * Standard output, whether it is a terminal or not
+     * The size comes from the terminal, then from COLUMNS/LINES, then defaults to 80x24
+     * A size fixed with fix_size wins over all of them
+     * colors is guessed from the environment: none when not a terminal or NO_COLOR is set,
+     * otherwise from COLORTERM/TERM on POSIX, truecolor on Windows
+     */
+    struct console {
+#ifdef _WIN32
+        void* handle{nullptr};
+#else
+        int fd{-1};
+#endif
+        uint32_t width{0};
+        uint32_t height{0};
+        bool tty{false};
+        sgr::color_depth colors{sgr::color_depth::none};
+        bool synchronized_output{false};
+
+        ~console() = default;
+        console();
+
+#ifdef _WIN32
+        operator bool() const noexcept { return handle != nullptr; }
+#else
+        operator bool() const noexcept { return fd >= 0; }
+#endif
+
+        /*
+         * 0 keeps the detected dimension
+         */
+        void fix_size(uint32_t fixed_width, uint32_t fixed_height) noexcept;
+
+        /*
+         * Asks the terminal for its size again
+         * Returns true if width or height changed
+         */
+        bool update_size() noexcept;
+
+        /*
+         * Starts listening for the terminal being resized: SIGWINCH on POSIX, window buffer size
+         * events on the console input on Windows
+         */
+        void watch_resize() noexcept;
+
+        /*
+         * Whether the terminal was resized since the last call, the size is not updated
+         * Always false before watch_resize
+         */
+        bool resized() noexcept;
+
+        /*
+         * Blocks until the terminal is resized, wake() is called or timeout passes, and returns
+         * what resized() would afterwards; without watch_resize it only waits
+         * A signal handled meanwhile may end it early too
+         */
+        bool wait_resize(std::chrono::milliseconds timeout) noexcept;
+
+        /*
+         * Makes the wait_resize in progress, or the next one, return at once
+         * Safe to call from a signal handler
+         */
+        static void wake() noexcept;
+
+        /*
+         * Asks the terminal whether it takes synchronized output (DEC private mode 2026), which
+         * holds the screen until a frame is complete, and sets synchronized_output
+         * Reads the answer from standard input, so only call it while nothing else does
+         */
+        bool detect_synchronized_output() noexcept;
+
+        void put(std::string_view str) const;
+        void put(std::wstring_view wstr) const;
+
+        /*
+         * Writes str out completely
+         * Returns the number of write calls it took
+         */
+        size_t write(std::string_view str) const;
+
+        template <class... Args>
+        void print(std::string_view fmt, Args&&... args) const {
+            std::string str = std::vformat(fmt, std::make_format_args(std::forward<Args>(args)...));
+            put(str);
+        }
+
+        template <class... Args>
+        void print(std::wstring_view fmt, Args&&... args) const {
+            std::wstring wstr = std::vformat(fmt, std::make_wformat_args(std::forward<Args>(args)...));
+            put(wstr);
+        }
+
+    private:
+        uint32_t fixed_width_{0};
+        uint32_t fixed_height_{0};
+#ifdef _WIN32
+        void* input_{nullptr};      // console input the resize events arrive on
+#endif
+    };
+
+} // namespace holofetch
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+
+#include "holofetch/info.hpp"
+#include "holofetch/network.hpp"
+
+namespace holofetch::daemon {
+
+    struct snapshot {
+        host_info host;
+        network::network_info network;
+        std::chrono::system_clock::time_point taken;
+    };
+
+    /*
+     * Binary form used by the shared memory segment and the socket,
+     * only meant to be read by the same build that wrote it
+     */
+    std::string encode(const snapshot& s);
+    std::optional<snapshot> decode(std::string_view bytes);
+
+    /*
+     * Whether a snapshot is too old to show at now, or taken further ahead of it than that,
+     * which only a wall clock set back since can explain
+     */
+    bool stale(const snapshot& s, std::chrono::system_clock::time_point now) noexcept;
+
+    /*
+     * Keeps a snapshot fresh, every probe on its own refresh interval, and publishes it through
+     * a seqlock protected shared memory segment and, where there are Unix sockets, a socket
+     * Blocks until stop is requested, throws if the snapshot cannot be published
+     * or another daemon already serves this user
+     */
+    void serve(std::stop_token stop);
+
+    /*
+     * Snapshot of a running daemon, from shared memory or else from its socket
+     * std::nullopt when no daemon answers or its snapshot has gone stale
+     */
+    std::optional<snapshot> connect() noexcept;
+
+} // namespace holofetch::daemon
@@ -0,0 +1,783 @@
+#pragma once
+
+/*
+ * Generated by holofetch compile-avatar assets/default_image_data.utf.ans --header include/holofetch/default_avatar.hpp
+ * Do not edit, compile the avatar again instead
+ */
+
+#include <cstdint>
+#include <iterator>
+
+#include "holofetch/avatar.hpp"
+
+namespace holofetch::assets::default_avatar_data {
+
+    inline constexpr uint32_t width{90};
+    inline constexpr uint32_t height{40};
+    inline constexpr uint32_t flags{1};
+
+    inline constexpr uint32_t palette[] = {
+        0x036a1f1b, 0x00000000, 0x036f201e, 0x037a2517, 0x03934026, 0x03a75825, 0x03b5641f, 0x03ab4c1b,
+        0x03b5501e, 0x03a34922, 0x03943820, 0x037f2c1a, 0x03711f16, 0x03661919, 0x035f1418, 0x03611819,
+        0x03621d1e, 0x03641f1e, 0x036c1f16, 0x036b1f1c, 0x036b201a, 0x036e221d, 0x036e211d, 0x036d211d,
+        0x036e201d, 0x036d201e, 0x036c211e, 0x036d201d, 0x036c201e, 0x03771f18, 0x0365291a, 0x0343291d,
+        0x03382f1b, 0x034c2c1d, 0x035a281e, 0x035c2620, 0x035c2421, 0x035b2521, 0x03582520, 0x03592718,
+        0x038a3f16, 0x034f371b, 0x03252f1e, 0x0342291d, 0x03602517, 0x03682216, 0x036b1f1b, 0x036b201e,
+        0x03691f1a, 0x036a1d19, 0x03681e1a, 0x03681e1d, 0x03661e1d, 0x03661e1e, 0x03671e1c, 0x03671e1e,
+        0x036b2020, 0x03662017, 0x03652013, 0x036d2215, 0x036f2319, 0x0370211c, 0x036b241e, 0x036a241e,
+        0x036d231f, 0x036e241f, 0x036e231f, 0x0373201d, 0x03691d19, 0x0361231a, 0x035d2716, 0x03582419,
+        0x03572a19, 0x035b3519, 0x03593216, 0x032e331f, 0x03322511, 0x03866a4a, 0x03979374, 0x033a3427,
+        0x030f0b08, 0x03631e21, 0x03631e1f, 0x03621e1f, 0x035f191d, 0x03601818, 0x03661c1b, 0x0374241a,
+        0x038e371c, 0x039c4822, 0x03ac4f2c, 0x03b4561d, 0x03b85a1e, 0x03ae581e, 0x03994c25, 0x03913f24,
+        0x03782c1e, 0x036b1e19, 0x0361191c, 0x035f181b, 0x035e171f, 0x035e1a21, 0x03621d20, 0x03611e20,
+        0x03641f21, 0x03651f21, 0x03641f20, 0x03641e1f, 0x03631e20, 0x03641e20, 0x03611f1f, 0x03681f1e,
+        0x035d201b, 0x0341271d, 0x03362b1d, 0x0348291c, 0x0355291d, 0x035a251f, 0x0356251e, 0x0355251c,
+        0x0359251e, 0x035a241f, 0x035f251f, 0x03642916, 0x0373331c, 0x03492719, 0x034d271b, 0x035f201a,
+        0x03641d18, 0x03652019, 0x03641e21, 0x03651e20, 0x03651f1f, 0x03661d1d, 0x03632116, 0x035d2414,
+        0x0362211a, 0x0365201b, 0x03651f1c, 0x035f211d, 0x0358231b, 0x0352261b, 0x0346291b, 0x034f2b1d,
+        0x03562f19, 0x03632c15, 0x03793114, 0x036f3a1a, 0x0337321c, 0x0340321b, 0x03552919, 0x03521c0f,
+        0x03452d22, 0x030c0b0b, 0x03000000, 0x03651f20, 0x03611d20, 0x035e191e, 0x035d171c, 0x035e181c,
+        0x03641c1b, 0x037b291d, 0x038b3b1f, 0x039e4e19, 0x03ba602e, 0x03c06c27, 0x03cd6928, 0x03b6661e,
+        0x03a5581e, 0x03944217, 0x03823016, 0x036b241b, 0x036a1c1c, 0x0362181d, 0x035b171c, 0x035f1c1f,
+        0x03631f1f, 0x03641d1e, 0x03661f1f, 0x0365201f, 0x03582617, 0x03372f1b, 0x034c251e, 0x035a2319,
+        0x035e221f, 0x035e2219, 0x03601e18, 0x03631d1d, 0x03651e1d, 0x035f211e, 0x0364201c, 0x0367201f,
+        0x03621c20, 0x03691d1e, 0x03681d1d, 0x03661d1c, 0x03641f1f, 0x03651e1e, 0x03691f17, 0x03452b17,
+        0x03442918, 0x0347251b, 0x0349271b, 0x03582214, 0x03812c12, 0x037d381a, 0x03462d1d, 0x033c331b,
+        0x033d2e20, 0x03482c1a, 0x03501e15, 0x0330100a, 0x03060102, 0x03020101, 0x03661e20, 0x03611b21,
+        0x035f181f, 0x035c161c, 0x0360181a, 0x036f2119, 0x03802e1d, 0x03913f17, 0x03a54c1f, 0x03b35f26,
+        0x03d87c32, 0x03c87023, 0x03b05a19, 0x03ac5f2b, 0x03a04c1e, 0x039a4b26, 0x03832c1b, 0x0366211e,
+        0x03621d1a, 0x03611a13, 0x03601a1c, 0x035c1a1b, 0x035b1d1c, 0x03631f20, 0x03671e1f, 0x03661f20,
+        0x03671e20, 0x03641f1c, 0x03671e1a, 0x036c1f19, 0x03681f1a, 0x036a1d17, 0x03641d1f, 0x03632118,
+        0x03532619, 0x03652a1f, 0x0374261a, 0x03822a16, 0x035a2f15, 0x0341311c, 0x03383121, 0x034a271a,
+        0x03451a15, 0x0322120b, 0x03020103, 0x03020201, 0x03010101, 0x03652020, 0x03621e20, 0x035e1b1e,
+        0x035f181e, 0x035d181f, 0x0362191e, 0x0371251e, 0x037c2a1c, 0x038f4123, 0x03a3551e, 0x03b4691a,
+        0x03ba6c25, 0x03b15f22, 0x03bd7022, 0x03bc6a26, 0x03b46227, 0x03a7591f, 0x039a431a, 0x03944225,
+        0x038e371d, 0x0375271d, 0x036e1e1c, 0x036a1b1a, 0x03601a1e, 0x035f181d, 0x035f1b1f, 0x03601b1f,
+        0x03631b1b, 0x03641b18, 0x0367211b, 0x03681f1c, 0x03662118, 0x03651e1a, 0x03691f1b, 0x03661e1f,
+        0x03651e1f, 0x03681e21, 0x03651d18, 0x03712915, 0x03693a17, 0x034d371e, 0x033c2e1a, 0x033c2116,
+        0x0331170d, 0x03130805, 0x03010000, 0x03642020, 0x03601d20, 0x03621a1d, 0x03641914, 0x03641816,
+        0x03611719, 0x03651a18, 0x03762920, 0x03954024, 0x03994216, 0x03a45319, 0x03b66528, 0x03c37923,
+        0x03c1701f, 0x03cd7922, 0x03b5681f, 0x03b65d19, 0x03bb6128, 0x03a9652e, 0x03a04824, 0x0385301e,
+        0x037e2e1a, 0x03752a17, 0x0370211a, 0x0365191d, 0x03621917, 0x03432318, 0x03541c16, 0x036c1b12,
+        0x03611d1a, 0x03671f1c, 0x03652021, 0x03681f20, 0x03702017, 0x03622218, 0x0367211c, 0x03632020,
+        0x03641e1e, 0x03691f1e, 0x03671e1b, 0x03671d1d, 0x035c241a, 0x033b1b12, 0x031a0705, 0x03050001,
+        0x03010100, 0x03651e21, 0x03661f1c, 0x0368211a, 0x036c1f17, 0x036a1f19, 0x0366201f, 0x03601c1f,
+        0x035c171e, 0x0360181d, 0x0365191b, 0x03792514, 0x03883417, 0x0391401d, 0x03a7501b, 0x03b66824,
+        0x03af6628, 0x039e6431, 0x03c3752c, 0x03d27b27, 0x03bc6b1a, 0x03c47c2c, 0x03ad6420, 0x03b46221,
+        0x03946030, 0x037b432b, 0x039e4625, 0x03732a1e, 0x0372241a, 0x03722019, 0x03601a1f, 0x0367171d,
+        0x03542115, 0x033c2618, 0x03651f1d, 0x03601d21, 0x0365201e, 0x036b1e1a, 0x035e2513, 0x036c2216,
+        0x03651f1e, 0x03621f21, 0x036a1f21, 0x03692417, 0x031b0b08, 0x03020100, 0x03652016, 0x036c1f14,
+        0x036a221d, 0x0364201f, 0x03621e21, 0x0365181d, 0x035c1a17, 0x034f2017, 0x034e201a, 0x0361241a,
+        0x0365271a, 0x03673e1f, 0x03954324, 0x03984719, 0x03ac5a1e, 0x03b96614, 0x03c08b36, 0x03b27a3f,
+        0x03ed903d, 0x03b97d44, 0x03bb7445, 0x03b36b1f, 0x03af5d1b, 0x03aa5f27, 0x038e4421, 0x035c3c25,
+        0x036c3c1e, 0x037c271c, 0x036d261d, 0x03661f1d, 0x03611a1c, 0x03671a1a, 0x034a231e, 0x03511f1b,
+        0x036c1b18, 0x035f1d1f, 0x03611f20, 0x03642117, 0x036b2218, 0x036a1f1d, 0x03681e1f, 0x03672118,
+        0x035b241d, 0x036b1e1b, 0x036b211e, 0x03722214, 0x03160809, 0x03010001, 0x03661e21, 0x03661f1b,
+        0x03602017, 0x03642315, 0x036a1e1b, 0x036a1e1f, 0x0368201a, 0x034e2619, 0x03512a18, 0x034f2e19,
+        0x035e2613, 0x036b2214, 0x03322d1d, 0x0332251b, 0x0363181a, 0x035f1a1f, 0x03691919, 0x03552a1d,
+        0x033e351f, 0x0383341b, 0x038d461c, 0x037b3d26, 0x03a75621, 0x03a95913, 0x03b56b1c, 0x03c17619,
+        0x03c27b38, 0x039e7f48, 0x03c7701e, 0x03c4751b, 0x03bd6f17, 0x03ad5720, 0x03a8581b, 0x03973d13,
+        0x039c3c21, 0x0375402a, 0x034b3317, 0x03792b22, 0x03722721, 0x036d1d19, 0x03671c1d, 0x03681a18,
+        0x034a231a, 0x035d1b18, 0x035f191e, 0x03601c21, 0x03651b1e, 0x03542418, 0x03482713, 0x03671c17,
+        0x035f1e20, 0x036d211b, 0x035a1b15, 0x0366221b, 0x03642313, 0x03651d20, 0x036d1e1c, 0x035a2416,
+        0x033e2c17, 0x035b2617, 0x03522a1b, 0x03472b1c, 0x03702314, 0x033d2c1e, 0x03273221, 0x034c2c16,
+        0x036e1f1c, 0x0366201d, 0x03562519, 0x03272a25, 0x03442916, 0x036f1914, 0x03571d14, 0x03621b1a,
+        0x03651a1b, 0x03661c16, 0x034c2a20, 0x037b2915, 0x036f3521, 0x03664f2b, 0x03985f26, 0x03b8651a,
+        0x03b46316, 0x03bc6722, 0x03bb671c, 0x03ab6419, 0x03ba6a20, 0x03ad694e, 0x03c28332, 0x03cb8127,
+        0x03b56c23, 0x03a34910, 0x03a6541a, 0x03b25b1e, 0x03854c2a, 0x03864a2c, 0x038d3e1b, 0x037e2f17,
+        0x037d2b17, 0x037a281d, 0x03842515, 0x034e2d19, 0x034c3520, 0x0371261a, 0x0368271a, 0x037c2b1a,
+        0x033d150d, 0x03020102, 0x03652018, 0x03642215, 0x03621f1f, 0x036c201b, 0x034c251f, 0x03402c1c,
+        0x03652415, 0x034b2918, 0x032f2f1d, 0x036f2013, 0x03502919, 0x032e2b24, 0x03302a1f, 0x03512920,
+        0x036b1e20, 0x03672317, 0x03342e1e, 0x032b2f20, 0x035c2616, 0x03682116, 0x035d2819, 0x03721e1c,
+        0x03582618, 0x03312c1e, 0x03312d1e, 0x036f1e16, 0x033d2917, 0x0322291c, 0x032d2a16, 0x03691c15,
+        0x036e211b, 0x03742416, 0x03873116, 0x0384371a, 0x039a4917, 0x03875437, 0x0397682d, 0x039f4d12,
+        0x03b47025, 0x03b16c23, 0x03bf631c, 0x03bd6b19, 0x03cc7935, 0x03be8052, 0x03c77b25, 0x03c56f2d,
+        0x03cd7426, 0x03ad5c0f, 0x03b57023, 0x03bf7a42, 0x039d6f49, 0x03ba7d2f, 0x03bb6c2c, 0x03bd6817,
+        0x03c67a32, 0x03311914, 0x03000102, 0x03691d1d, 0x035f2419, 0x035f2418, 0x036b1d1c, 0x03691e1b,
+        0x03382f1f, 0x03402920, 0x03701e19, 0x03492819, 0x0323321e, 0x03542717, 0x0369211c, 0x032c2f1c,
+        0x032e311a, 0x032e2a21, 0x034f2e1c, 0x0373201b, 0x034a2b18, 0x032f2f1c, 0x03662217, 0x03662315,
+        0x03682318, 0x034d281b, 0x032b301c, 0x032d2e20, 0x03442e19, 0x036b2818, 0x0330311c, 0x03322d20,
+        0x03372f1a, 0x03651f18, 0x03641d20, 0x03641c20, 0x035e1b20, 0x0361191f, 0x03651818, 0x034e2213,
+        0x03312a1a, 0x03302e1f, 0x035f2f1b, 0x037f2b16, 0x03802f1c, 0x03863621, 0x03903d23, 0x0379532f,
+        0x03955a22, 0x03b25a1b, 0x03c67836, 0x03b46424, 0x03ad631c, 0x03bd7323, 0x03ae7049, 0x03d4833b,
+        0x03c27928, 0x03ad6631, 0x03d69239, 0x03886638, 0x03050203, 0x03642619, 0x0351241b, 0x036d1e1a,
+        0x036a1d1e, 0x03652217, 0x03342a1f, 0x0342281d, 0x03722318, 0x0327321f, 0x0334301c, 0x036c2417,
+        0x034e2621, 0x03302822, 0x033f2f1b, 0x032c301e, 0x034b2c15, 0x036d1e19, 0x03322a21, 0x03302c21,
+        0x03652417, 0x03662516, 0x034e2818, 0x0326321e, 0x03432e1b, 0x03332a22, 0x035e2419, 0x03492d18,
+        0x032a301d, 0x032f311a, 0x03352f14, 0x0364201a, 0x035f221b, 0x03671f1e, 0x035e261e, 0x03592717,
+        0x033f2c1c, 0x03292d20, 0x03452519, 0x0367191b, 0x035d1c20, 0x035c1b20, 0x0364191b, 0x033e2419,
+        0x03282920, 0x036a1f12, 0x036d2420, 0x037d2d22, 0x03622b19, 0x037d2716, 0x037b4027, 0x035b461c,
+        0x03814015, 0x037f3f2d, 0x038e4522, 0x038a4125, 0x031b0807, 0x03701f13, 0x033e2d1c, 0x0364211b,
+        0x036b1e1d, 0x03612419, 0x03312a21, 0x0342281c, 0x03761d10, 0x035e261c, 0x032a301e, 0x03312f1d,
+        0x03492e18, 0x03662517, 0x03352925, 0x03332f1b, 0x034c2b19, 0x032a311c, 0x03462c1c, 0x0353231a,
+        0x032f2a20, 0x03313017, 0x03602417, 0x034b2919, 0x03292e1f, 0x03412c1e, 0x03482b1e, 0x0339291f,
+        0x03602718, 0x03482e1a, 0x032d301a, 0x032d3117, 0x03333018, 0x036f231a, 0x035b251a, 0x03432b19,
+        0x03711d18, 0x03671f17, 0x0353271c, 0x035b281b, 0x03362d17, 0x032c2f1b, 0x03432b1b, 0x036d201c,
+        0x03462b1c, 0x032b2f23, 0x0357211d, 0x03671c1e, 0x036a1c14, 0x033d1f25, 0x0362201e, 0x03631b18,
+        0x03242a1e, 0x035e1c19, 0x03601c15, 0x035c1c14, 0x036a1d15, 0x03270f0d, 0x03020000, 0x036f1f19,
+        0x034f251d, 0x034d261a, 0x036c1d1d, 0x03612218, 0x03312b23, 0x03372d1c, 0x036b1e18, 0x036e2010,
+        0x033b281e, 0x032d2f1b, 0x03372b18, 0x035e2818, 0x03522f1d, 0x032d2823, 0x033d2d1a, 0x0352291c,
+        0x032d311a, 0x03322f19, 0x03303115, 0x032d3212, 0x03303211, 0x03293217, 0x03532817, 0x0352281f,
+        0x03312d1d, 0x03572617, 0x032f311e, 0x033f2d1a, 0x0355231b, 0x03432b1f, 0x032d3116, 0x032c3217,
+        0x03382e1f, 0x0372231c, 0x03362921, 0x0348261b, 0x03721e1b, 0x035e2517, 0x0351271d, 0x03572319,
+        0x03362f19, 0x03283416, 0x0343291a, 0x036c1f1c, 0x0362201f, 0x036c1e1a, 0x033a2d1c, 0x032a2f1e,
+        0x034c2122, 0x035c261b, 0x032f2529, 0x03532818, 0x036b2118, 0x032e311e, 0x03672219, 0x03622616,
+        0x035d2717, 0x0377231a, 0x03401910, 0x036e2318, 0x03382d1f, 0x03622318, 0x03661d20, 0x0368221c,
+        0x03372821, 0x032c2f20, 0x0362231b, 0x036f201d, 0x034e2c1c, 0x032c311e, 0x032e3318, 0x03422b1a,
+        0x035c2d19, 0x03432e1d, 0x032b2d23, 0x033d321d, 0x03563118, 0x0333311c, 0x032f3313, 0x03313317,
+        0x032f3216, 0x03323216, 0x032e341a, 0x033b2d1b, 0x035f2918, 0x034b2a1a, 0x03472b1b, 0x032b2f1d,
+        0x03432d19, 0x035d301b, 0x033a2d19, 0x032e3117, 0x032d3115, 0x03362f18, 0x03422a20, 0x0328301e,
+        0x03622517, 0x0366221a, 0x034a221a, 0x0354261b, 0x036a2c1e, 0x03362c19, 0x032a3218, 0x0341281c,
+        0x036c1e1e, 0x032e2f1d, 0x032e2e1e, 0x03432622, 0x03751f11, 0x033c2623, 0x032b2b22, 0x034d2d17,
+        0x03622419, 0x032b301d, 0x035d211a, 0x03442b16, 0x0375231c, 0x0354170f, 0x03621f1e, 0x036e2119,
+        0x034d281c, 0x03402c1a, 0x03651d21, 0x036b231a, 0x03472424, 0x032c2923, 0x03472c1a, 0x0369201f,
+        0x036d1e18, 0x033b2514, 0x032e2a16, 0x03302c16, 0x0338200e, 0x037c543c, 0x03483a21, 0x032d2913,
+        0x03432915, 0x03352d19, 0x03292b17, 0x032a2f1b, 0x03272614, 0x03262518, 0x032b3019, 0x034c2d19,
+        0x034b3019, 0x03272c1a, 0x033e2010, 0x03977e59, 0x03806f50, 0x03242413, 0x03312f1c, 0x03312f17,
+        0x032e3215, 0x0329331a, 0x033d2d1b, 0x03612e19, 0x03481e12, 0x0365261d, 0x03b78c70, 0x0374513d,
+        0x032c2416, 0x032e2f1c, 0x03432a17, 0x03691d1f, 0x0366211d, 0x036c2315, 0x034e2a1d, 0x0330301b,
+        0x032c301c, 0x03422d19, 0x035a2616, 0x032e2e1b, 0x032d2e1e, 0x03672119, 0x034e281a, 0x032c311c,
+        0x03691e14, 0x0361312c, 0x03523c33, 0x03633130, 0x030c0d0c, 0x036a211a, 0x03342e21, 0x03572513,
+        0x03621f20, 0x036a1d20, 0x03592517, 0x032d2d1f, 0x0364251b, 0x03661b1c, 0x03783627, 0x039b805e,
+        0x03836a45, 0x03997b61, 0x03775e3d, 0x03ae8966, 0x03c0976e, 0x0396724d, 0x03866442, 0x038f6140,
+        0x03957054, 0x03534931, 0x03997a5f, 0x03432d1a, 0x03968060, 0x038e8162, 0x032f311c, 0x0338321b,
+        0x03442912, 0x03665632, 0x03a17b4c, 0x03877050, 0x033a342b, 0x0340331d, 0x033b3922, 0x033a2e1e,
+        0x03322d1e, 0x03402a1d, 0x034c1c17, 0x037c4838, 0x03c79c78, 0x03eac39d, 0x0364513b, 0x03262813,
+        0x03342d21, 0x035b261a, 0x0372211c, 0x03622015, 0x03432413, 0x0331301b, 0x032d3217, 0x03393018,
+        0x03362f1d, 0x032c311a, 0x03312f19, 0x03672518, 0x03362e1d, 0x033b2919, 0x03712516, 0x03362420,
+        0x03351d17, 0x037c2219, 0x035c2d1f, 0x03070808, 0x035d231b, 0x03302d20, 0x03641f18, 0x03691e1d,
+        0x036d1e1b, 0x0340281b, 0x03432d17, 0x0370221a, 0x03611312, 0x03936447, 0x03edcda3, 0x03e9bc92,
+        0x03e4be94, 0x03e1b88b, 0x03e2bc97, 0x03dcb993, 0x03e2b993, 0x03e4b78c, 0x03e6b78f, 0x03e5b88e,
+        0x03d5b386, 0x03e1be92, 0x03cf9c6f, 0x03dda980, 0x03dcb493, 0x03a2805d, 0x0398744e, 0x03b77e5d,
+        0x038d774f, 0x03d5b184, 0x03cea47f, 0x03795a3d, 0x035c3c23, 0x032c2714, 0x033a2617, 0x033c2a17,
+        0x033e3520, 0x03a1725a, 0x03d5b493, 0x03d8b993, 0x03bfa270, 0x03443424, 0x0329301d, 0x03392f18,
+        0x03662219, 0x035a170c, 0x03562b1c, 0x0372452e, 0x03472714, 0x032d3018, 0x032d2f15, 0x032c3119,
+        0x032e3116, 0x032c3013, 0x033e3218, 0x0350331a, 0x03242f1e, 0x03642518, 0x03531b15, 0x03000004,
+        0x034f3123, 0x03792313, 0x03492715, 0x03681e1b, 0x036e1f11, 0x0354281c, 0x03302e1e, 0x03691d1a,
+        0x035e1f1b, 0x03362725, 0x032a321d, 0x03542818, 0x03761d16, 0x035f1e19, 0x03ac8662, 0x03947052,
+        0x0394754d, 0x038d7149, 0x03635c42, 0x036f6141, 0x038f7b56, 0x03b29569, 0x03a9936e, 0x039d896e,
+        0x039c886f, 0x03a18465, 0x03a27840, 0x03c18d50, 0x03c08045, 0x03b3754b, 0x03946449, 0x03986647,
+        0x03a9754f, 0x03976241, 0x038b5333, 0x03bd926e, 0x03e0bc94, 0x03b7956b, 0x038f6944, 0x03835038,
+        0x036b482b, 0x03a87b5b, 0x03c39775, 0x03d9b890, 0x03cdaf84, 0x03ddb88f, 0x03725532, 0x03221d0d,
+        0x033b2915, 0x03442914, 0x03662e15, 0x036f4f36, 0x03a2785e, 0x037e6147, 0x03282518, 0x033a3624,
+        0x033d3c28, 0x032f2e22, 0x032d2f1f, 0x032d3318, 0x033f341e, 0x033a3122, 0x035c2414, 0x03180b0c,
+        0x03020204, 0x035c251c, 0x03722619, 0x032b0f0e, 0x03661f17, 0x03721e16, 0x03472b19, 0x03342f1a,
+        0x03722115, 0x03472423, 0x032c2c20, 0x03303118, 0x035c281d, 0x036b1919, 0x036b3223, 0x03c8a378,
+        0x039d7c60, 0x03444028, 0x03312409, 0x034d350e, 0x03373d22, 0x03818070, 0x03848276, 0x03424f36,
+        0x031c2618, 0x03282c19, 0x03423221, 0x0345362e, 0x0335291b, 0x03362e18, 0x03413319, 0x03403a2d,
+        0x03523a2a, 0x03be905b, 0x03d69f73, 0x03c3a486, 0x03caa682, 0x03d1af8a, 0x03d7b18a, 0x03ddb992,
+        0x03d6b388, 0x03d8ac84, 0x03d9b48e, 0x03d4b28a, 0x03d6b08b, 0x03d6af8c, 0x03c99472, 0x03bc8256,
+        0x03ab8c6f, 0x03be855e, 0x03b48762, 0x03cfa881, 0x03e4b186, 0x03766347, 0x03212713, 0x03363529,
+        0x0347342d, 0x03553e30, 0x0335201c, 0x033b3621, 0x03342619, 0x033d2316, 0x033b3422, 0x034e2d1c,
+        0x03130705, 0x03211812, 0x036f2f19, 0x03682c20, 0x030c0708, 0x03682117, 0x03632219, 0x036c201a,
+        0x03392c1c, 0x03382c1f, 0x036f1f13, 0x03661d1e, 0x0362241a, 0x033b2722, 0x032b3119, 0x033c2d18,
+        0x036a221a, 0x03601617, 0x03784b33, 0x03d8ba97, 0x03dcb48b, 0x03a38561, 0x03ac936f, 0x03978666,
+        0x03301a17, 0x03620d11, 0x03541613, 0x0342261d, 0x03512819, 0x0387483b, 0x037e443c, 0x03403631,
+        0x037d836d, 0x03ab9075, 0x03b4906f, 0x03af8d71, 0x03c6a075, 0x03d8ac80, 0x03d5b691, 0x03d4b18a,
+        0x03d2ae87, 0x03d0af87, 0x03cead86, 0x03d1ae87, 0x03d1b08a, 0x03d0ac86, 0x03d8b48e, 0x03c9a27c,
+        0x03957354, 0x0380634e, 0x03a77b49, 0x03d1a67a, 0x03cbb190, 0x03d3b38e, 0x03b29c72, 0x034c3f25,
+        0x031c2615, 0x03462e1c, 0x034b2a22, 0x0317110d, 0x031d1313, 0x03211810, 0x03392e1f, 0x031d1514,
+        0x03392a1b, 0x03282014, 0x030e0805, 0x033f2017, 0x03702b1c, 0x0320100d, 0x03671f15, 0x036e1d17,
+        0x0352221f, 0x03362b1e, 0x03671c19, 0x03671d1e, 0x03612621, 0x03352627, 0x032a3118, 0x03462d19,
+        0x036d2320, 0x035c1415, 0x039b684b, 0x03dabb94, 0x03ceaa82, 0x03dab792, 0x03d6b38b, 0x03e2b68f,
+        0x03b59268, 0x03985f45, 0x0392513d, 0x03753723, 0x03672e1f, 0x035a3b2b, 0x03554128, 0x03898a57,
+        0x03bcaf84, 0x03debe9b, 0x03d8b58e, 0x03d9b68e, 0x03d4b28c, 0x03d1b088, 0x03d2af89, 0x03d2af87,
+        0x03d1af88, 0x03d0ae88, 0x03d6b08a, 0x03c3a98a, 0x03564e3e, 0x03746f50, 0x034a3f20, 0x032d2815,
+        0x034c3821, 0x03483824, 0x033e3927, 0x032f301d, 0x03232b1d, 0x034c2a14, 0x0373271b, 0x032f1e17,
+        0x03070605, 0x03140a0a, 0x03412c22, 0x031a110e, 0x03150d06, 0x03772b15, 0x033c180e, 0x03621f14,
+        0x03661e1b, 0x0360231b, 0x032e2e19, 0x032e321b, 0x032f2e20, 0x03631f19, 0x03671e1d, 0x035b2519,
+        0x03302922, 0x03302724, 0x0351271b, 0x0372211d, 0x03601311, 0x039c6f57, 0x03dcb98d, 0x03d0ad86,
+        0x03d2af88, 0x03d0ad87, 0x03d1ae86, 0x03d8b98f, 0x03dcb991, 0x03d8b996, 0x03caac87, 0x03c1ac88,
+        0x03c2a680, 0x03c59f77, 0x03c2976e, 0x03c49a6f, 0x03d3ad86, 0x03d0ae87, 0x03d1af87, 0x03d0ac88,
+        0x03d9bc94, 0x03ac7e61, 0x03481213, 0x0338241d, 0x03482b23, 0x036f705c, 0x03918459, 0x03322c17,
+        0x03262c21, 0x03372c1e, 0x035e2619, 0x036f1c18, 0x036c2d27, 0x030b090d, 0x03160b13, 0x031b140f,
+        0x030a0202, 0x031c1011, 0x035d2616, 0x034f2919, 0x03661d15, 0x03641e16, 0x0369211a, 0x03362d1e,
+        0x032c2e21, 0x035a291b, 0x0352291b, 0x032c2f1d, 0x0348271b, 0x03601a15, 0x03b4885b, 0x03ddb68f,
+        0x03d0ad85, 0x03d4b08a, 0x03d6b088, 0x03d5b28a, 0x03d4b38c, 0x03d7b48d, 0x03d5b38e, 0x03d1af89,
+        0x03ddb792, 0x03b08a6e, 0x0372432f, 0x034b3520, 0x03625f3e, 0x03e2c29c, 0x03797455, 0x03262d15,
+        0x03442e1f, 0x036a291a, 0x036f2318, 0x033d1e19, 0x03070406, 0x031a0a08, 0x034b2719, 0x0327130b,
+        0x03681e1c, 0x03612117, 0x036d2015, 0x03432423, 0x032b311c, 0x03303116, 0x03303018, 0x032c2d20,
+        0x034a2a18, 0x03681d1e, 0x0358251c, 0x032e2c1f, 0x036d221f, 0x03ae7d60, 0x03dab890, 0x03d1ae88,
+        0x03d8b792, 0x03934c39, 0x03a27552, 0x03c0a172, 0x03cfa67d, 0x03d5b58d, 0x03b39875, 0x033e2817,
+        0x03602114, 0x0366211a, 0x03661c1d, 0x036e2b19, 0x03150c0b, 0x03050102, 0x03230d0d, 0x03321813,
+        0x030a0504, 0x03562418, 0x03702012, 0x034b231e, 0x032d2d22, 0x03303117, 0x032f3119, 0x032f301c,
+        0x032e2f20, 0x033a2c1c, 0x036a1f17, 0x035f211b, 0x03402a19, 0x036a231e, 0x03611414, 0x03986f5d,
+        0x03dcbc96, 0x03d0ac84, 0x03cfad85, 0x03dbbb95, 0x03a26f5a, 0x03551813, 0x035f2f22, 0x03a17855,
+        0x03ba926d, 0x03d9b086, 0x037a5b45, 0x035e1511, 0x03711f1e, 0x03622114, 0x036e1f1d, 0x035c2d18,
+        0x03010201, 0x031e1109, 0x0328190b, 0x03190808, 0x03000001, 0x03672019, 0x0343291c, 0x03662119,
+        0x035b2317, 0x032c2f1f, 0x032e3115, 0x032f3117, 0x032f2f1f, 0x032c2e1d, 0x03572517, 0x036a1d1d,
+        0x03681d1f, 0x03612818, 0x03342e16, 0x036a241a, 0x035f1518, 0x0386583e, 0x03daba95, 0x03d0ad84,
+        0x03d0ae86, 0x03d8b68f, 0x03c89e7c, 0x035d2119, 0x03562321, 0x03501b20, 0x03521b16, 0x03a47651,
+        0x03b58e67, 0x03642b20, 0x03661c1e, 0x03661f1a, 0x03631e19, 0x0328120a, 0x03040302, 0x03602118,
+        0x03392b1f, 0x035d231a, 0x032e2a24, 0x03302f1d, 0x032e301a, 0x03342f1d, 0x032f2e1f, 0x03392a1e,
+        0x03682118, 0x036d2012, 0x03412324, 0x032e2f19, 0x032a3214, 0x0359281a, 0x036e1615, 0x03743e32,
+        0x03d2b491, 0x03d2ae85, 0x03d1ad87, 0x03d1ae85, 0x03d6b590, 0x03914e32, 0x0361221c, 0x03703726,
+        0x038e4a31, 0x03a76f51, 0x03aa7f5a, 0x0374432e, 0x0361221a, 0x03642013, 0x036e1e16, 0x03623020,
+        0x03050809, 0x032f2d1e, 0x03532717, 0x03712217, 0x03332d1f, 0x032f3017, 0x03392f1c, 0x0333301d,
+        0x032d3119, 0x034a2b1e, 0x03362f1a, 0x032c2c21, 0x0349291a, 0x036f1e1a, 0x036e1e1a, 0x0352241e,
+        0x032e2c1e, 0x032f2e1c, 0x033b2e1d, 0x036b2219, 0x03691c13, 0x03bc9679, 0x03d7b58d, 0x03d0ad88,
+        0x03d1ae89, 0x03d7b38c, 0x03d7b790, 0x03d7b68f, 0x03d1b18b, 0x03c9aa85, 0x03c89466, 0x03d7ae88,
+        0x03d7a879, 0x03ca9467, 0x0395674b, 0x0367291f, 0x03621718, 0x03641f22, 0x03681f18, 0x03742318,
+        0x03381b11, 0x03010102, 0x035a2415, 0x03752013, 0x033b2a1c, 0x032c3115, 0x033a3018, 0x03413118,
+        0x032e3315, 0x0337301c, 0x0359261c, 0x03412b1c, 0x032d301c, 0x0354221c, 0x036e2017, 0x03631e1e,
+        0x036a2019, 0x03342c1e, 0x032f301a, 0x032a321e, 0x03542b1a, 0x036d130e, 0x0387573f, 0x03debf9c,
+        0x03d3ae89, 0x03d6b28c, 0x03d5b38b, 0x03d3b28d, 0x03d3b38f, 0x03d5b28b, 0x03d5b18a, 0x03d5b18b,
+        0x03cead87, 0x03cfad86, 0x03d1af86, 0x03d3b08a, 0x03bfa180, 0x03b69673, 0x03b79577, 0x03b38d73,
+        0x03af8a68, 0x03d7aa7f, 0x03e1bb94, 0x03d9b58d, 0x03b59772, 0x0393614e, 0x03692a27, 0x035d1718,
+        0x03631e1d, 0x0367261b, 0x03140806, 0x03712113, 0x033c2e1c, 0x032b311b, 0x03392f19, 0x034e2c19,
+        0x03323118, 0x032e3213, 0x03292b12, 0x03471f14, 0x035b231e, 0x033a2d1b, 0x032c311b, 0x032e2e1f,
+        0x03552322, 0x036d1d1b, 0x03701e1a, 0x03562716, 0x032b3219, 0x03303015, 0x03632014, 0x03a28f70,
+        0x03ceaf8b, 0x03c7a87d, 0x03d2a47b, 0x03d0a378, 0x03cc9f71, 0x03c9a176, 0x03c9a784, 0x03c9a785,
+        0x03d8b083, 0x03ddb88b, 0x03dbb98f, 0x03dcb78c, 0x03dbb790, 0x03d5b28d, 0x03d1ad86, 0x03d2b390,
+        0x03b67b5e, 0x0393664a, 0x03b78b65, 0x03daa67e, 0x03c19d79, 0x03b08c68, 0x03877052, 0x034c452b,
+        0x035e1f0e, 0x03651415, 0x03631b1d, 0x03662022, 0x036a2119, 0x035f2412, 0x036f1d14, 0x03582b21,
+        0x03050505, 0x033a2d1f, 0x03392c1a, 0x0350291a, 0x03372f19, 0x0330331a, 0x03252514, 0x03846a50,
+        0x038d5a3e, 0x03501915, 0x0356201e, 0x034f291c, 0x03342f1c, 0x032c3216, 0x032e2d21, 0x0349251e,
+        0x036c1f1a, 0x0362201c, 0x035d1e22, 0x03572120, 0x03342727, 0x032d2d2e, 0x032b2d2f, 0x0334282d,
+        0x0337232f, 0x0334292d, 0x033e3336, 0x033c2e35, 0x03422a35, 0x03432936, 0x033f292f, 0x033e2a33,
+        0x03402c3c, 0x033d3036, 0x035d4636, 0x036b554b, 0x0370594c, 0x03937255, 0x03a5886c, 0x03caa176,
+        0x03d5b389, 0x03e2bd93, 0x03cf936e, 0x03ae8163, 0x03ad8e6b, 0x0381724e, 0x03514b36, 0x032f281e,
+        0x03272215, 0x03262c16, 0x035b241f, 0x036b201f, 0x03662116, 0x03742216, 0x033d241d, 0x03312f1e,
+        0x0330331c, 0x033c2d1b, 0x035a2d1f, 0x0347301d, 0x032e321a, 0x03272a13, 0x03564d2f, 0x03d8b68e,
+        0x03e3b88f, 0x03ba8159, 0x036b3827, 0x0358241d, 0x0354291c, 0x03373018, 0x032e301b, 0x032b2f1e,
+        0x033f2527, 0x034d2426, 0x033b2530, 0x03382132, 0x03322236, 0x0330223a, 0x03312337, 0x0331243b,
+        0x0331233b, 0x03342236, 0x03332239, 0x03361f37, 0x03341c35, 0x03351c36, 0x03331e37, 0x03331d36,
+        0x03341c34, 0x03331e33, 0x032e1a33, 0x032c1632, 0x032d1630, 0x032b1a2f, 0x032d1e2b, 0x033d2a33,
+        0x0356433e, 0x03826555, 0x03998a70, 0x03555941, 0x03303022, 0x03232611, 0x03282b12, 0x032f3214,
+        0x03323418, 0x036a1e1a, 0x0363201f, 0x03632117, 0x03612018, 0x037b2d1e, 0x031a110d, 0x03252b15,
+        0x03322112, 0x03542516, 0x0376553b, 0x03353620, 0x032a2e14, 0x03302f1e, 0x03725d39, 0x03887335,
+        0x03816236, 0x0387693b, 0x03624d36, 0x03382d23, 0x033c2a2d, 0x03342b2e, 0x032f2930, 0x03322733,
+        0x03332136, 0x03312137, 0x0333203a, 0x03312438, 0x03322533, 0x032f243c, 0x03352035, 0x03381e37,
+        0x03381f36, 0x03362036, 0x03382037, 0x03382036, 0x03372138, 0x03372137, 0x03372037, 0x03362434,
+        0x03382336, 0x03392138, 0x03382238, 0x03392039, 0x03351d37, 0x032d1a34, 0x032b1630, 0x032c142f,
+        0x0325222a, 0x03302b27, 0x0332311f, 0x03313216, 0x03303113, 0x03313113, 0x032c2f1e, 0x03532318,
+        0x03681e20, 0x03632216, 0x036a2016, 0x03652216, 0x03090503, 0x03604f29, 0x037c6145, 0x038c6b47,
+        0x0332321c, 0x03292f17, 0x0335301c, 0x03b39167, 0x03bd9765, 0x0387613d, 0x03644126, 0x033e2e30,
+        0x0328252e, 0x032d2833, 0x03332139, 0x03362037, 0x03361f38, 0x032b2b3c, 0x03302538, 0x03312535,
+        0x03352136, 0x03381e38, 0x03371f37, 0x03372036, 0x03371f38, 0x03371f36, 0x03352234, 0x03352137,
+        0x03382136, 0x033a2138, 0x03392239, 0x03382039, 0x032d2a34, 0x032c2e2a, 0x03302f1a, 0x03313114,
+        0x032c2f19, 0x036a201e, 0x03691e1e, 0x03632312, 0x036b2319, 0x03452215, 0x03000002, 0x03f1a464,
+        0x03deab77, 0x035b4d37, 0x03282a1a, 0x03342f1b, 0x035a4f29, 0x03755f37, 0x034c322f, 0x03341f30,
+        0x03342037, 0x03322037, 0x03381d37, 0x03381f37, 0x03372035, 0x032e273b, 0x03302539, 0x03371f35,
+        0x03362135, 0x03361f36, 0x03362038, 0x03352039, 0x0333252f, 0x032f301e, 0x032b311d, 0x033e2b1c,
+        0x0366201e, 0x03671e21, 0x03602117, 0x036a2419, 0x03481b14, 0x03ca8b50, 0x034c4122, 0x03212118,
+        0x033b3524, 0x03494332, 0x03312d35, 0x03271f32, 0x032e2037, 0x03342338, 0x03372136, 0x03352037,
+        0x03312537, 0x03352135, 0x03302830, 0x0332282b, 0x03342c1d, 0x035d241d, 0x0364211f, 0x03652120,
+        0x035d241a, 0x0358251d, 0x03260b0d, 0x033f3c23, 0x03262b1c, 0x03352e22, 0x03485742, 0x03353038,
+        0x033b2036, 0x03382137, 0x03342335, 0x03342431, 0x03342233, 0x03362035, 0x03361e39, 0x03381e36,
+        0x03362134, 0x03302928, 0x034d2619, 0x035e201d, 0x035c241d, 0x035e221d, 0x0359241a, 0x034c291c,
+        0x034a2616, 0x03050302, 0x032a2e1b, 0x03443c30, 0x03343738, 0x03351b35, 0x03362235, 0x03371e37,
+        0x0331282e, 0x032e2e24, 0x0332282d, 0x03342332, 0x03342237, 0x03332238, 0x03342235, 0x03332337,
+        0x03332339, 0x03332338, 0x03342238, 0x03371e35, 0x03312434, 0x033a2919, 0x034b2215, 0x03472618,
+        0x03482313, 0x03492212, 0x03492414, 0x03432919, 0x033e2112, 0x03030001,
+    };
+
+    inline constexpr uint32_t rows[] = {
+        0, 86, 168, 246, 318, 388, 456, 525, 597, 665, 737, 810,
+        882, 958, 1034, 1110, 1187, 1266, 1344, 1424, 1503, 1582, 1659, 1735,
+        1813, 1885, 1955, 2025, 2091, 2155, 2219, 2287, 2353, 2419, 2485, 2550,
+        2614, 2677, 2734, 2793, 2854,
+    };
+
+    inline constexpr compiled_avatar::run runs[] = {
+        {0x23, 0, 1, 0, 1}, {0x23, 2, 1, 0, 1}, {0x23, 3, 1, 0, 1}, {0x23, 4, 1, 0, 1}, {0x23, 5, 1, 0, 1}, {0x23, 6, 1, 0, 1},
+        {0x23, 7, 1, 0, 1}, {0x23, 8, 1, 0, 1}, {0x23, 9, 1, 0, 1}, {0x23, 10, 1, 0, 1}, {0x23, 11, 1, 0, 1}, {0x23, 12, 1, 0, 1},
+        {0x23, 13, 1, 0, 1}, {0x23, 14, 1, 0, 1}, {0x23, 15, 1, 0, 1}, {0x23, 16, 1, 0, 1}, {0x23, 17, 1, 0, 1}, {0x23, 18, 1, 0, 1},
+        {0x23, 19, 1, 0, 1}, {0x23, 20, 1, 0, 1}, {0x23, 21, 1, 0, 1}, {0x23, 22, 1, 0, 1}, {0x23, 23, 1, 0, 1}, {0x23, 24, 1, 0, 1},
+        {0x23, 25, 1, 0, 1}, {0x23, 26, 1, 0, 1}, {0x23, 27, 1, 0, 2}, {0x23, 28, 1, 0, 1}, {0x23, 25, 1, 0, 1}, {0x23, 23, 1, 0, 1},
+        {0x23, 28, 1, 0, 1}, {0x23, 25, 1, 0, 1}, {0x23, 2, 1, 0, 1}, {0x23, 29, 1, 0, 1}, {0x23, 30, 1, 0, 1}, {0x23, 31, 1, 0, 1},
+        {0x23, 32, 1, 0, 1}, {0x23, 33, 1, 0, 1}, {0x23, 34, 1, 0, 1}, {0x23, 35, 1, 0, 1}, {0x23, 36, 1, 0, 1}, {0x23, 37, 1, 0, 1},
+        {0x23, 38, 1, 0, 1}, {0x23, 39, 1, 0, 1}, {0x23, 40, 1, 0, 1}, {0x23, 41, 1, 0, 1}, {0x23, 42, 1, 0, 1}, {0x23, 43, 1, 0, 1},
+        {0x23, 44, 1, 0, 1}, {0x23, 45, 1, 0, 1}, {0x23, 46, 1, 0, 1}, {0x23, 47, 1, 0, 1}, {0x23, 48, 1, 0, 1}, {0x23, 49, 1, 0, 1},
+        {0x23, 50, 1, 0, 1}, {0x23, 51, 1, 0, 1}, {0x23, 52, 1, 0, 3}, {0x23, 53, 1, 0, 1}, {0x23, 52, 1, 0, 2}, {0x23, 54, 1, 0, 1},
+        {0x23, 55, 1, 0, 1}, {0x23, 56, 1, 0, 1}, {0x23, 57, 1, 0, 1}, {0x23, 58, 1, 0, 1}, {0x23, 59, 1, 0, 1}, {0x23, 60, 1, 0, 1},
+        {0x23, 61, 1, 0, 1}, {0x23, 62, 1, 0, 1}, {0x23, 63, 1, 0, 1}, {0x23, 64, 1, 0, 1}, {0x23, 65, 1, 0, 1}, {0x23, 66, 1, 0, 1},
+        {0x23, 67, 1, 0, 1}, {0x23, 68, 1, 0, 1}, {0x23, 69, 1, 0, 1}, {0x23, 70, 1, 0, 1}, {0x23, 71, 1, 0, 1}, {0x23, 72, 1, 0, 1},
+        {0x23, 73, 1, 0, 1}, {0x23, 74, 1, 0, 1}, {0x23, 75, 1, 0, 1}, {0x23, 76, 1, 0, 1}, {0x23, 77, 1, 0, 1}, {0x23, 78, 1, 0, 1},
+        {0x23, 79, 1, 0, 1}, {0x23, 80, 1, 0, 1}, {0x23, 81, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 83, 1, 0, 1}, {0x23, 84, 1, 0, 1},
+        {0x23, 85, 1, 0, 1}, {0x23, 86, 1, 0, 1}, {0x23, 87, 1, 0, 1}, {0x23, 88, 1, 0, 1}, {0x23, 89, 1, 0, 1}, {0x23, 90, 1, 0, 1},
+        {0x23, 91, 1, 0, 1}, {0x23, 92, 1, 0, 1}, {0x23, 93, 1, 0, 1}, {0x23, 94, 1, 0, 1}, {0x23, 95, 1, 0, 1}, {0x23, 96, 1, 0, 1},
+        {0x23, 97, 1, 0, 1}, {0x23, 98, 1, 0, 1}, {0x23, 99, 1, 0, 1}, {0x23, 100, 1, 0, 1}, {0x23, 101, 1, 0, 1}, {0x23, 102, 1, 0, 1},
+        {0x23, 103, 1, 0, 1}, {0x23, 104, 1, 0, 1}, {0x23, 105, 1, 0, 1}, {0x23, 106, 1, 0, 1}, {0x23, 107, 1, 0, 1}, {0x23, 82, 1, 0, 1},
+        {0x23, 108, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 108, 1, 0, 1}, {0x23, 110, 1, 0, 1}, {0x23, 111, 1, 0, 1}, {0x23, 112, 1, 0, 1},
+        {0x23, 113, 1, 0, 1}, {0x23, 114, 1, 0, 1}, {0x23, 115, 1, 0, 1}, {0x23, 116, 1, 0, 1}, {0x23, 117, 1, 0, 1}, {0x23, 118, 1, 0, 1},
+        {0x23, 119, 1, 0, 1}, {0x23, 120, 1, 0, 1}, {0x23, 121, 1, 0, 1}, {0x23, 122, 1, 0, 1}, {0x23, 123, 1, 0, 1}, {0x23, 124, 1, 0, 1},
+        {0x23, 125, 1, 0, 1}, {0x23, 126, 1, 0, 1}, {0x23, 127, 1, 0, 1}, {0x23, 128, 1, 0, 1}, {0x23, 129, 1, 0, 1}, {0x23, 106, 1, 0, 1},
+        {0x23, 109, 1, 0, 1}, {0x23, 104, 1, 0, 1}, {0x23, 130, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4},
+        {0x23, 109, 1, 0, 1}, {0x23, 132, 1, 0, 1}, {0x23, 133, 1, 0, 1}, {0x23, 134, 1, 0, 1}, {0x23, 135, 1, 0, 1}, {0x23, 136, 1, 0, 1},
+        {0x23, 137, 1, 0, 1}, {0x23, 138, 1, 0, 1}, {0x23, 139, 1, 0, 1}, {0x23, 140, 1, 0, 1}, {0x23, 141, 1, 0, 1}, {0x23, 142, 1, 0, 1},
+        {0x23, 143, 1, 0, 1}, {0x23, 144, 1, 0, 1}, {0x23, 145, 1, 0, 1}, {0x23, 146, 1, 0, 1}, {0x23, 147, 1, 0, 1}, {0x23, 148, 1, 0, 1},
+        {0x23, 149, 1, 0, 1}, {0x23, 150, 1, 0, 1}, {0x23, 151, 1, 0, 1}, {0x23, 152, 1, 0, 1}, {0x23, 153, 1, 0, 1}, {0x20, 154, 1, 0, 2},
+        {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 155, 1, 0, 2}, {0x23, 105, 1, 0, 1}, {0x23, 156, 1, 0, 1}, {0x23, 157, 1, 0, 1},
+        {0x23, 158, 1, 0, 1}, {0x23, 159, 1, 0, 1}, {0x23, 160, 1, 0, 1}, {0x23, 161, 1, 0, 1}, {0x23, 162, 1, 0, 1}, {0x23, 163, 1, 0, 1},
+        {0x23, 164, 1, 0, 1}, {0x23, 165, 1, 0, 1}, {0x23, 166, 1, 0, 1}, {0x23, 167, 1, 0, 1}, {0x23, 168, 1, 0, 1}, {0x23, 169, 1, 0, 1},
+        {0x23, 170, 1, 0, 1}, {0x23, 171, 1, 0, 1}, {0x23, 172, 1, 0, 1}, {0x23, 173, 1, 0, 1}, {0x23, 100, 1, 0, 1}, {0x23, 174, 1, 0, 1},
+        {0x23, 175, 1, 0, 1}, {0x23, 176, 1, 0, 1}, {0x23, 177, 1, 0, 1}, {0x23, 178, 1, 0, 1}, {0x23, 179, 1, 0, 1}, {0x23, 27, 1, 0, 1},
+        {0x23, 180, 1, 0, 1}, {0x23, 181, 1, 0, 1}, {0x23, 182, 1, 0, 1}, {0x23, 183, 1, 0, 1}, {0x23, 184, 1, 0, 1}, {0x23, 185, 1, 0, 1},
+        {0x23, 186, 1, 0, 1}, {0x23, 187, 1, 0, 1}, {0x23, 188, 1, 0, 1}, {0x23, 189, 1, 0, 1}, {0x23, 190, 1, 0, 1}, {0x23, 191, 1, 0, 1},
+        {0x23, 131, 1, 0, 1}, {0x23, 192, 1, 0, 1}, {0x23, 193, 1, 0, 1}, {0x23, 194, 1, 0, 1}, {0x23, 178, 1, 0, 1}, {0x23, 195, 1, 0, 1},
+        {0x23, 196, 1, 0, 1}, {0x23, 176, 1, 0, 1}, {0x23, 107, 1, 0, 1}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2},
+        {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 82, 1, 0, 1}, {0x23, 197, 1, 0, 1}, {0x23, 178, 1, 0, 1}, {0x23, 198, 1, 0, 1},
+        {0x23, 44, 1, 0, 1}, {0x23, 199, 1, 0, 1}, {0x23, 200, 1, 0, 1}, {0x23, 201, 1, 0, 1}, {0x23, 202, 1, 0, 1}, {0x23, 203, 1, 0, 1},
+        {0x23, 204, 1, 0, 1}, {0x23, 205, 1, 0, 1}, {0x23, 206, 1, 0, 1}, {0x23, 207, 1, 0, 1}, {0x23, 208, 1, 0, 1}, {0x23, 209, 1, 0, 1},
+        {0x23, 210, 1, 0, 1}, {0x23, 211, 1, 0, 1}, {0x20, 212, 1, 0, 1}, {0x20, 154, 1, 0, 2}, {0x20, 213, 1, 0, 1}, {0x20, 154, 1, 0, 1},
+        {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 1}, {0x23, 214, 1, 0, 1}, {0x23, 132, 1, 0, 1}, {0x23, 155, 1, 0, 2},
+        {0x23, 106, 1, 0, 1}, {0x23, 215, 1, 0, 1}, {0x23, 216, 1, 0, 1}, {0x23, 217, 1, 0, 1}, {0x23, 218, 1, 0, 1}, {0x23, 219, 1, 0, 1},
+        {0x23, 220, 1, 0, 1}, {0x23, 221, 1, 0, 1}, {0x23, 222, 1, 0, 1}, {0x23, 223, 1, 0, 1}, {0x23, 224, 1, 0, 1}, {0x23, 225, 1, 0, 1},
+        {0x23, 226, 1, 0, 1}, {0x23, 227, 1, 0, 1}, {0x23, 228, 1, 0, 1}, {0x23, 229, 1, 0, 1}, {0x23, 230, 1, 0, 1}, {0x23, 54, 1, 0, 1},
+        {0x23, 231, 1, 0, 1}, {0x23, 232, 1, 0, 1}, {0x23, 233, 1, 0, 1}, {0x23, 234, 1, 0, 1}, {0x23, 235, 1, 0, 1}, {0x23, 236, 1, 0, 1},
+        {0x23, 237, 1, 0, 1}, {0x23, 81, 1, 0, 1}, {0x23, 130, 1, 0, 1}, {0x23, 238, 1, 0, 1}, {0x23, 239, 1, 0, 2}, {0x23, 155, 1, 0, 1},
+        {0x23, 240, 1, 0, 1}, {0x23, 105, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 241, 1, 0, 1}, {0x23, 242, 1, 0, 1}, {0x23, 243, 1, 0, 1},
+        {0x23, 244, 1, 0, 1}, {0x23, 245, 1, 0, 1}, {0x23, 242, 1, 0, 1}, {0x23, 130, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 2},
+        {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 2}, {0x23, 108, 1, 0, 1},
+        {0x23, 246, 1, 0, 1}, {0x23, 111, 1, 0, 1}, {0x23, 247, 1, 0, 1}, {0x23, 248, 1, 0, 1}, {0x23, 249, 1, 0, 1}, {0x23, 250, 1, 0, 1},
+        {0x23, 251, 1, 0, 1}, {0x23, 252, 1, 0, 1}, {0x23, 253, 1, 0, 1}, {0x23, 254, 1, 0, 1}, {0x23, 255, 1, 0, 1}, {0x23, 256, 1, 0, 1},
+        {0x23, 257, 1, 0, 1}, {0x20, 258, 1, 0, 1}, {0x20, 154, 1, 0, 2}, {0x20, 259, 1, 0, 1}, {0x20, 260, 1, 0, 1}, {0x20, 154, 1, 0, 2},
+        {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4}, {0x23, 214, 1, 0, 1}, {0x23, 239, 1, 0, 1},
+        {0x23, 261, 1, 0, 1}, {0x23, 179, 1, 0, 1}, {0x23, 262, 1, 0, 1}, {0x23, 263, 1, 0, 1}, {0x23, 264, 1, 0, 1}, {0x23, 265, 1, 0, 1},
+        {0x23, 266, 1, 0, 1}, {0x23, 267, 1, 0, 1}, {0x23, 268, 1, 0, 1}, {0x23, 269, 1, 0, 1}, {0x23, 270, 1, 0, 1}, {0x23, 271, 1, 0, 1},
+        {0x23, 272, 1, 0, 1}, {0x23, 273, 1, 0, 1}, {0x23, 274, 1, 0, 1}, {0x23, 275, 1, 0, 1}, {0x23, 276, 1, 0, 1}, {0x23, 277, 1, 0, 1},
+        {0x23, 278, 1, 0, 1}, {0x23, 279, 1, 0, 1}, {0x23, 280, 1, 0, 1}, {0x23, 281, 1, 0, 1}, {0x23, 282, 1, 0, 1}, {0x23, 283, 1, 0, 1},
+        {0x23, 284, 1, 0, 1}, {0x23, 285, 1, 0, 1}, {0x23, 286, 1, 0, 1}, {0x23, 287, 1, 0, 1}, {0x23, 288, 1, 0, 1}, {0x23, 289, 1, 0, 1},
+        {0x23, 290, 1, 0, 1}, {0x23, 291, 1, 0, 1}, {0x23, 219, 1, 0, 1}, {0x23, 292, 1, 0, 1}, {0x23, 293, 1, 0, 1}, {0x23, 294, 1, 0, 1},
+        {0x23, 155, 1, 0, 1}, {0x23, 107, 1, 0, 1}, {0x23, 178, 1, 0, 1}, {0x23, 132, 1, 0, 1}, {0x23, 295, 1, 0, 1}, {0x23, 296, 1, 0, 1},
+        {0x23, 17, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 1}, {0x23, 130, 1, 0, 1}, {0x23, 108, 1, 0, 1},
+        {0x23, 107, 1, 0, 3}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4}, {0x23, 109, 1, 0, 1}, {0x23, 297, 1, 0, 1}, {0x23, 298, 1, 0, 1},
+        {0x23, 299, 1, 0, 1}, {0x23, 300, 1, 0, 1}, {0x23, 301, 1, 0, 1}, {0x23, 302, 1, 0, 1}, {0x23, 303, 1, 0, 1}, {0x23, 304, 1, 0, 1},
+        {0x23, 305, 1, 0, 1}, {0x20, 154, 1, 0, 3}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 5}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4},
+        {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 3}, {0x23, 132, 1, 0, 1}, {0x23, 155, 1, 0, 1},
+        {0x23, 261, 1, 0, 1}, {0x23, 307, 1, 0, 1}, {0x23, 308, 1, 0, 1}, {0x23, 309, 1, 0, 1}, {0x23, 310, 1, 0, 1}, {0x23, 311, 1, 0, 1},
+        {0x23, 312, 1, 0, 1}, {0x23, 313, 1, 0, 1}, {0x23, 314, 1, 0, 1}, {0x23, 315, 1, 0, 1}, {0x23, 316, 1, 0, 1}, {0x23, 317, 1, 0, 1},
+        {0x23, 318, 1, 0, 1}, {0x23, 319, 1, 0, 1}, {0x23, 320, 1, 0, 1}, {0x23, 321, 1, 0, 1}, {0x23, 322, 1, 0, 1}, {0x23, 323, 1, 0, 1},
+        {0x23, 324, 1, 0, 1}, {0x23, 325, 1, 0, 1}, {0x23, 326, 1, 0, 1}, {0x23, 327, 1, 0, 1}, {0x23, 328, 1, 0, 1}, {0x23, 329, 1, 0, 1},
+        {0x23, 330, 1, 0, 1}, {0x23, 331, 1, 0, 1}, {0x23, 332, 1, 0, 1}, {0x23, 333, 1, 0, 1}, {0x23, 334, 1, 0, 1}, {0x23, 335, 1, 0, 1},
+        {0x23, 336, 1, 0, 1}, {0x23, 337, 1, 0, 1}, {0x23, 338, 1, 0, 1}, {0x23, 339, 1, 0, 1}, {0x23, 340, 1, 0, 1}, {0x23, 341, 1, 0, 1},
+        {0x23, 342, 1, 0, 1}, {0x23, 343, 1, 0, 1}, {0x23, 131, 1, 0, 1}, {0x23, 107, 1, 0, 1}, {0x23, 344, 1, 0, 1}, {0x23, 17, 1, 0, 1},
+        {0x23, 345, 1, 0, 1}, {0x23, 346, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4},
+        {0x23, 131, 1, 0, 1}, {0x23, 106, 1, 0, 1}, {0x23, 108, 1, 0, 1}, {0x23, 347, 1, 0, 1}, {0x23, 348, 1, 0, 1}, {0x23, 349, 1, 0, 1},
+        {0x23, 350, 1, 0, 1}, {0x20, 351, 1, 0, 1}, {0x20, 154, 1, 0, 2}, {0x20, 306, 1, 0, 1}, {0x20, 352, 1, 0, 1}, {0x20, 154, 1, 0, 7},
+        {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4},
+        {0x23, 109, 1, 0, 1}, {0x23, 353, 1, 0, 1}, {0x23, 354, 1, 0, 1}, {0x23, 355, 1, 0, 1}, {0x23, 356, 1, 0, 1}, {0x23, 357, 1, 0, 1},
+        {0x23, 358, 1, 0, 2}, {0x23, 106, 1, 0, 1}, {0x23, 359, 1, 0, 1}, {0x23, 360, 1, 0, 1}, {0x23, 361, 1, 0, 1}, {0x23, 362, 1, 0, 1},
+        {0x23, 27, 1, 0, 1}, {0x23, 363, 1, 0, 1}, {0x23, 364, 1, 0, 1}, {0x23, 365, 1, 0, 1}, {0x23, 366, 1, 0, 1}, {0x23, 367, 1, 0, 1},
+        {0x23, 368, 1, 0, 1}, {0x23, 369, 1, 0, 1}, {0x23, 370, 1, 0, 1}, {0x23, 371, 1, 0, 1}, {0x23, 372, 1, 0, 1}, {0x23, 373, 1, 0, 1},
+        {0x23, 374, 1, 0, 1}, {0x23, 375, 1, 0, 1}, {0x23, 376, 1, 0, 1}, {0x23, 377, 1, 0, 1}, {0x23, 378, 1, 0, 1}, {0x23, 379, 1, 0, 1},
+        {0x23, 380, 1, 0, 1}, {0x23, 381, 1, 0, 1}, {0x23, 382, 1, 0, 1}, {0x23, 383, 1, 0, 1}, {0x23, 384, 1, 0, 1}, {0x23, 385, 1, 0, 1},
+        {0x23, 386, 1, 0, 1}, {0x23, 387, 1, 0, 1}, {0x23, 196, 1, 0, 1}, {0x23, 388, 1, 0, 1}, {0x23, 106, 1, 0, 1}, {0x23, 389, 1, 0, 1},
+        {0x23, 390, 1, 0, 1}, {0x23, 391, 1, 0, 1}, {0x23, 214, 1, 0, 1}, {0x23, 392, 1, 0, 1}, {0x23, 296, 1, 0, 1}, {0x23, 131, 1, 0, 1},
+        {0x23, 53, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 130, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 1}, {0x23, 196, 1, 0, 1},
+        {0x23, 214, 1, 0, 1}, {0x23, 393, 1, 0, 1}, {0x23, 394, 1, 0, 1}, {0x23, 395, 1, 0, 1}, {0x23, 396, 1, 0, 1}, {0x20, 154, 1, 0, 1},
+        {0x20, 397, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 9}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2},
+        {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 2}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 1}, {0x23, 55, 1, 0, 1},
+        {0x23, 398, 1, 0, 1}, {0x23, 399, 1, 0, 1}, {0x23, 400, 1, 0, 1}, {0x23, 401, 1, 0, 1}, {0x23, 108, 1, 0, 1}, {0x23, 131, 1, 0, 2},
+        {0x23, 107, 1, 0, 1}, {0x23, 296, 1, 0, 1}, {0x23, 239, 1, 0, 1}, {0x23, 155, 1, 0, 1}, {0x23, 105, 1, 0, 1}, {0x23, 402, 1, 0, 1},
+        {0x23, 387, 1, 0, 1}, {0x23, 403, 1, 0, 1}, {0x23, 404, 1, 0, 1}, {0x23, 405, 1, 0, 1}, {0x23, 406, 1, 0, 1}, {0x23, 407, 1, 0, 1},
+        {0x23, 408, 1, 0, 1}, {0x23, 409, 1, 0, 1}, {0x23, 410, 1, 0, 1}, {0x23, 411, 1, 0, 1}, {0x23, 412, 1, 0, 1}, {0x23, 413, 1, 0, 1},
+        {0x23, 414, 1, 0, 1}, {0x23, 415, 1, 0, 1}, {0x23, 416, 1, 0, 1}, {0x23, 417, 1, 0, 1}, {0x23, 418, 1, 0, 1}, {0x23, 419, 1, 0, 1},
+        {0x23, 420, 1, 0, 1}, {0x23, 421, 1, 0, 1}, {0x23, 422, 1, 0, 1}, {0x23, 423, 1, 0, 1}, {0x23, 424, 1, 0, 1}, {0x23, 425, 1, 0, 1},
+        {0x23, 426, 1, 0, 1}, {0x23, 427, 1, 0, 1}, {0x23, 309, 1, 0, 1}, {0x23, 428, 1, 0, 1}, {0x23, 429, 1, 0, 1}, {0x23, 430, 1, 0, 1},
+        {0x23, 431, 1, 0, 1}, {0x23, 432, 1, 0, 1}, {0x23, 433, 1, 0, 1}, {0x23, 434, 1, 0, 1}, {0x23, 240, 1, 0, 1}, {0x23, 435, 1, 0, 1},
+        {0x23, 436, 1, 0, 1}, {0x23, 437, 1, 0, 1}, {0x23, 388, 1, 0, 1}, {0x23, 106, 1, 0, 1}, {0x23, 438, 1, 0, 1}, {0x23, 439, 1, 0, 1},
+        {0x23, 440, 1, 0, 1}, {0x23, 441, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 442, 1, 0, 1}, {0x23, 443, 1, 0, 1}, {0x23, 444, 1, 0, 1},
+        {0x20, 260, 1, 0, 1}, {0x20, 445, 1, 0, 1}, {0x20, 154, 1, 0, 9}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2},
+        {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 446, 1, 0, 1}, {0x23, 447, 1, 0, 1},
+        {0x23, 448, 1, 0, 1}, {0x23, 449, 1, 0, 1}, {0x23, 450, 1, 0, 1}, {0x23, 130, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 2},
+        {0x23, 107, 1, 0, 4}, {0x23, 108, 1, 0, 1}, {0x23, 451, 1, 0, 1}, {0x23, 452, 1, 0, 1}, {0x23, 453, 1, 0, 1}, {0x23, 454, 1, 0, 1},
+        {0x23, 455, 1, 0, 1}, {0x23, 456, 1, 0, 1}, {0x23, 457, 1, 0, 1}, {0x23, 458, 1, 0, 1}, {0x23, 459, 1, 0, 1}, {0x23, 460, 1, 0, 1},
+        {0x23, 461, 1, 0, 1}, {0x23, 462, 1, 0, 1}, {0x23, 463, 1, 0, 1}, {0x23, 464, 1, 0, 1}, {0x23, 465, 1, 0, 1}, {0x23, 466, 1, 0, 1},
+        {0x23, 467, 1, 0, 1}, {0x23, 468, 1, 0, 1}, {0x23, 469, 1, 0, 1}, {0x23, 470, 1, 0, 1}, {0x23, 471, 1, 0, 1}, {0x23, 472, 1, 0, 1},
+        {0x23, 473, 1, 0, 1}, {0x23, 474, 1, 0, 1}, {0x23, 475, 1, 0, 1}, {0x23, 476, 1, 0, 1}, {0x23, 477, 1, 0, 1}, {0x23, 478, 1, 0, 1},
+        {0x23, 479, 1, 0, 1}, {0x23, 480, 1, 0, 1}, {0x23, 481, 1, 0, 1}, {0x23, 482, 1, 0, 1}, {0x23, 483, 1, 0, 1}, {0x23, 484, 1, 0, 1},
+        {0x23, 485, 1, 0, 1}, {0x23, 486, 1, 0, 1}, {0x23, 487, 1, 0, 1}, {0x23, 488, 1, 0, 1}, {0x23, 489, 1, 0, 1}, {0x23, 490, 1, 0, 1},
+        {0x23, 286, 1, 0, 1}, {0x23, 491, 1, 0, 1}, {0x23, 492, 1, 0, 1}, {0x23, 493, 1, 0, 1}, {0x23, 494, 1, 0, 1}, {0x23, 495, 1, 0, 1},
+        {0x23, 496, 1, 0, 1}, {0x23, 497, 1, 0, 1}, {0x23, 498, 1, 0, 1}, {0x20, 258, 1, 0, 1}, {0x20, 154, 1, 0, 10}, {0x23, 109, 1, 0, 1},
+        {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 82, 1, 0, 1}, {0x23, 55, 1, 0, 1},
+        {0x23, 499, 1, 0, 1}, {0x23, 500, 1, 0, 1}, {0x23, 354, 1, 0, 1}, {0x23, 214, 1, 0, 1}, {0x23, 108, 1, 0, 1}, {0x23, 131, 1, 0, 1},
+        {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 2}, {0x23, 108, 1, 0, 1}, {0x23, 501, 1, 0, 1}, {0x23, 502, 1, 0, 1},
+        {0x23, 503, 1, 0, 1}, {0x23, 504, 1, 0, 1}, {0x23, 505, 1, 0, 1}, {0x23, 506, 1, 0, 1}, {0x23, 507, 1, 0, 1}, {0x23, 508, 1, 0, 1},
+        {0x23, 509, 1, 0, 1}, {0x23, 510, 1, 0, 1}, {0x23, 511, 1, 0, 1}, {0x23, 512, 1, 0, 1}, {0x23, 513, 1, 0, 1}, {0x23, 514, 1, 0, 1},
+        {0x23, 515, 1, 0, 1}, {0x23, 516, 1, 0, 1}, {0x23, 517, 1, 0, 1}, {0x23, 518, 1, 0, 1}, {0x23, 519, 1, 0, 1}, {0x23, 520, 1, 0, 1},
+        {0x23, 521, 1, 0, 1}, {0x23, 522, 1, 0, 1}, {0x23, 523, 1, 0, 1}, {0x23, 524, 1, 0, 1}, {0x23, 525, 1, 0, 1}, {0x23, 526, 1, 0, 1},
+        {0x23, 527, 1, 0, 1}, {0x23, 528, 1, 0, 1}, {0x23, 529, 1, 0, 1}, {0x23, 530, 1, 0, 1}, {0x23, 531, 1, 0, 1}, {0x23, 532, 1, 0, 1},
+        {0x23, 533, 1, 0, 1}, {0x23, 534, 1, 0, 1}, {0x23, 535, 1, 0, 1}, {0x23, 536, 1, 0, 1}, {0x23, 537, 1, 0, 1}, {0x23, 538, 1, 0, 1},
+        {0x23, 539, 1, 0, 1}, {0x23, 540, 1, 0, 1}, {0x23, 541, 1, 0, 1}, {0x23, 542, 1, 0, 1}, {0x23, 543, 1, 0, 1}, {0x23, 544, 1, 0, 1},
+        {0x23, 545, 1, 0, 1}, {0x23, 546, 1, 0, 1}, {0x23, 547, 1, 0, 1}, {0x23, 548, 1, 0, 1}, {0x23, 549, 1, 0, 1}, {0x23, 550, 1, 0, 1},
+        {0x23, 551, 1, 0, 1}, {0x23, 552, 1, 0, 1}, {0x20, 445, 1, 0, 1}, {0x20, 553, 1, 0, 1}, {0x20, 154, 1, 0, 8}, {0x23, 109, 1, 0, 1},
+        {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 194, 1, 0, 1},
+        {0x23, 554, 1, 0, 1}, {0x23, 555, 1, 0, 1}, {0x23, 68, 1, 0, 1}, {0x23, 130, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4},
+        {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 1}, {0x23, 556, 1, 0, 1}, {0x23, 240, 1, 0, 1}, {0x23, 557, 1, 0, 1}, {0x23, 558, 1, 0, 1},
+        {0x23, 559, 1, 0, 1}, {0x23, 560, 1, 0, 1}, {0x23, 561, 1, 0, 1}, {0x23, 562, 1, 0, 1}, {0x23, 563, 1, 0, 1}, {0x23, 564, 1, 0, 1},
+        {0x23, 565, 1, 0, 1}, {0x23, 566, 1, 0, 1}, {0x23, 567, 1, 0, 1}, {0x23, 568, 1, 0, 1}, {0x23, 569, 1, 0, 1}, {0x23, 570, 1, 0, 1},
+        {0x23, 571, 1, 0, 1}, {0x23, 572, 1, 0, 1}, {0x23, 573, 1, 0, 1}, {0x23, 574, 1, 0, 1}, {0x23, 575, 1, 0, 1}, {0x23, 576, 1, 0, 1},
+        {0x23, 577, 1, 0, 1}, {0x23, 578, 1, 0, 1}, {0x23, 579, 1, 0, 1}, {0x23, 580, 1, 0, 1}, {0x23, 581, 1, 0, 1}, {0x23, 582, 1, 0, 1},
+        {0x23, 583, 1, 0, 1}, {0x23, 584, 1, 0, 1}, {0x23, 585, 1, 0, 1}, {0x23, 586, 1, 0, 1}, {0x23, 587, 1, 0, 1}, {0x23, 588, 1, 0, 1},
+        {0x23, 589, 1, 0, 1}, {0x23, 590, 1, 0, 1}, {0x23, 591, 1, 0, 1}, {0x23, 592, 1, 0, 1}, {0x23, 593, 1, 0, 1}, {0x23, 594, 1, 0, 1},
+        {0x23, 595, 1, 0, 1}, {0x23, 596, 1, 0, 1}, {0x23, 597, 1, 0, 1}, {0x23, 598, 1, 0, 1}, {0x23, 599, 1, 0, 1}, {0x23, 600, 1, 0, 1},
+        {0x23, 601, 1, 0, 1}, {0x23, 602, 1, 0, 1}, {0x23, 603, 1, 0, 1}, {0x23, 604, 1, 0, 1}, {0x23, 605, 1, 0, 1}, {0x23, 606, 1, 0, 1},
+        {0x23, 607, 1, 0, 1}, {0x23, 608, 1, 0, 1}, {0x23, 609, 1, 0, 1}, {0x20, 610, 1, 0, 1}, {0x20, 213, 1, 0, 1}, {0x20, 154, 1, 0, 7},
+        {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4}, {0x23, 109, 1, 0, 1}, {0x23, 611, 1, 0, 1},
+        {0x23, 612, 1, 0, 1}, {0x23, 613, 1, 0, 1}, {0x23, 614, 1, 0, 1}, {0x23, 344, 1, 0, 1}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4},
+        {0x23, 131, 1, 0, 2}, {0x23, 108, 1, 0, 1}, {0x23, 615, 1, 0, 1}, {0x23, 0, 1, 0, 1}, {0x23, 616, 1, 0, 1}, {0x23, 617, 1, 0, 1},
+        {0x23, 618, 1, 0, 1}, {0x23, 619, 1, 0, 1}, {0x23, 620, 1, 0, 1}, {0x23, 621, 1, 0, 1}, {0x23, 622, 1, 0, 1}, {0x23, 623, 1, 0, 1},
+        {0x23, 624, 1, 0, 1}, {0x23, 625, 1, 0, 1}, {0x23, 626, 1, 0, 1}, {0x23, 627, 1, 0, 1}, {0x23, 628, 1, 0, 1}, {0x23, 623, 1, 0, 1},
+        {0x23, 629, 1, 0, 1}, {0x23, 630, 1, 0, 1}, {0x23, 631, 1, 0, 1}, {0x23, 632, 1, 0, 1}, {0x23, 633, 1, 0, 1}, {0x23, 634, 1, 0, 1},
+        {0x23, 635, 1, 0, 1}, {0x23, 636, 1, 0, 1}, {0x23, 637, 1, 0, 1}, {0x23, 638, 1, 0, 1}, {0x23, 639, 1, 0, 1}, {0x23, 640, 1, 0, 1},
+        {0x23, 641, 1, 0, 1}, {0x23, 642, 1, 0, 1}, {0x23, 643, 1, 0, 1}, {0x23, 644, 1, 0, 1}, {0x23, 645, 1, 0, 1}, {0x23, 646, 1, 0, 1},
+        {0x23, 647, 1, 0, 1}, {0x23, 648, 1, 0, 1}, {0x23, 649, 1, 0, 1}, {0x23, 650, 1, 0, 1}, {0x23, 651, 1, 0, 1}, {0x23, 652, 1, 0, 1},
+        {0x23, 653, 1, 0, 1}, {0x23, 654, 1, 0, 1}, {0x23, 655, 1, 0, 1}, {0x23, 656, 1, 0, 1}, {0x23, 657, 1, 0, 1}, {0x23, 658, 1, 0, 1},
+        {0x23, 659, 1, 0, 1}, {0x23, 660, 1, 0, 1}, {0x23, 661, 1, 0, 1}, {0x23, 662, 1, 0, 1}, {0x23, 663, 1, 0, 1}, {0x23, 664, 1, 0, 1},
+        {0x23, 665, 1, 0, 1}, {0x23, 666, 1, 0, 1}, {0x23, 667, 1, 0, 1}, {0x20, 668, 1, 0, 1}, {0x20, 260, 1, 0, 1}, {0x20, 154, 1, 0, 7},
+        {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 1}, {0x23, 556, 1, 0, 1},
+        {0x23, 238, 1, 0, 1}, {0x23, 669, 1, 0, 1}, {0x23, 670, 1, 0, 1}, {0x23, 671, 1, 0, 1}, {0x23, 237, 1, 0, 1}, {0x23, 344, 1, 0, 1},
+        {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 1}, {0x23, 393, 1, 0, 1}, {0x23, 672, 1, 0, 1}, {0x23, 673, 1, 0, 1},
+        {0x23, 674, 1, 0, 1}, {0x23, 675, 1, 0, 1}, {0x23, 676, 1, 0, 1}, {0x23, 125, 1, 0, 1}, {0x23, 677, 1, 0, 1}, {0x23, 678, 1, 0, 1},
+        {0x23, 679, 1, 0, 1}, {0x23, 680, 1, 0, 1}, {0x23, 681, 1, 0, 1}, {0x23, 682, 1, 0, 1}, {0x23, 683, 1, 0, 1}, {0x23, 684, 1, 0, 1},
+        {0x23, 685, 1, 0, 1}, {0x23, 686, 1, 0, 1}, {0x23, 577, 1, 0, 1}, {0x23, 687, 1, 0, 1}, {0x23, 688, 1, 0, 1}, {0x23, 689, 1, 0, 1},
+        {0x23, 690, 1, 0, 1}, {0x23, 691, 1, 0, 1}, {0x23, 692, 1, 0, 1}, {0x23, 693, 1, 0, 1}, {0x23, 694, 1, 0, 1}, {0x23, 695, 1, 0, 1},
+        {0x23, 696, 1, 0, 1}, {0x23, 697, 1, 0, 1}, {0x23, 698, 1, 0, 1}, {0x23, 699, 1, 0, 1}, {0x23, 51, 1, 0, 1}, {0x23, 700, 1, 0, 1},
+        {0x23, 701, 1, 0, 1}, {0x23, 438, 1, 0, 1}, {0x23, 702, 1, 0, 1}, {0x23, 703, 1, 0, 1}, {0x23, 704, 1, 0, 1}, {0x23, 705, 1, 0, 1},
+        {0x23, 706, 1, 0, 1}, {0x23, 707, 1, 0, 1}, {0x23, 708, 1, 0, 1}, {0x23, 709, 1, 0, 1}, {0x23, 710, 1, 0, 1}, {0x23, 711, 1, 0, 1},
+        {0x23, 712, 1, 0, 1}, {0x23, 713, 1, 0, 1}, {0x23, 714, 1, 0, 1}, {0x23, 715, 1, 0, 1}, {0x23, 716, 1, 0, 1}, {0x23, 717, 1, 0, 1},
+        {0x23, 718, 1, 0, 1}, {0x23, 719, 1, 0, 1}, {0x23, 720, 1, 0, 1}, {0x23, 721, 1, 0, 1}, {0x23, 722, 1, 0, 1}, {0x23, 723, 1, 0, 1},
+        {0x23, 724, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 6}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4},
+        {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 2}, {0x23, 106, 1, 0, 1}, {0x23, 392, 1, 0, 1}, {0x23, 725, 1, 0, 1}, {0x23, 726, 1, 0, 1},
+        {0x23, 727, 1, 0, 1}, {0x23, 193, 1, 0, 1}, {0x23, 176, 1, 0, 1}, {0x23, 107, 1, 0, 1}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 4},
+        {0x23, 237, 1, 0, 1}, {0x23, 728, 1, 0, 1}, {0x23, 729, 1, 0, 1}, {0x23, 730, 1, 0, 1}, {0x23, 731, 1, 0, 1}, {0x23, 732, 1, 0, 1},
+        {0x23, 733, 1, 0, 1}, {0x23, 734, 1, 0, 1}, {0x23, 735, 1, 0, 1}, {0x23, 736, 1, 0, 1}, {0x23, 737, 1, 0, 1}, {0x23, 738, 1, 0, 1},
+        {0x23, 739, 1, 0, 1}, {0x23, 740, 1, 0, 1}, {0x23, 741, 1, 0, 1}, {0x23, 742, 1, 0, 1}, {0x23, 743, 1, 0, 1}, {0x23, 744, 1, 0, 1},
+        {0x23, 745, 1, 0, 1}, {0x23, 635, 1, 0, 1}, {0x23, 746, 1, 0, 1}, {0x23, 747, 1, 0, 1}, {0x23, 748, 1, 0, 1}, {0x23, 749, 1, 0, 1},
+        {0x23, 750, 1, 0, 1}, {0x23, 751, 1, 0, 1}, {0x23, 752, 1, 0, 1}, {0x23, 753, 1, 0, 1}, {0x23, 754, 1, 0, 1}, {0x23, 755, 1, 0, 1},
+        {0x23, 756, 1, 0, 1}, {0x23, 757, 1, 0, 1}, {0x23, 758, 1, 0, 1}, {0x23, 759, 1, 0, 1}, {0x23, 760, 1, 0, 1}, {0x23, 761, 1, 0, 1},
+        {0x23, 762, 1, 0, 1}, {0x23, 763, 1, 0, 1}, {0x23, 764, 1, 0, 1}, {0x23, 765, 1, 0, 1}, {0x23, 766, 1, 0, 1}, {0x23, 767, 1, 0, 1},
+        {0x23, 343, 1, 0, 1}, {0x23, 105, 1, 0, 1}, {0x23, 557, 1, 0, 1}, {0x23, 768, 1, 0, 1}, {0x23, 769, 1, 0, 1}, {0x23, 770, 1, 0, 1},
+        {0x23, 771, 1, 0, 1}, {0x23, 772, 1, 0, 1}, {0x23, 773, 1, 0, 1}, {0x23, 774, 1, 0, 1}, {0x23, 775, 1, 0, 1}, {0x23, 776, 1, 0, 1},
+        {0x23, 777, 1, 0, 1}, {0x23, 778, 1, 0, 1}, {0x23, 779, 1, 0, 1}, {0x23, 780, 1, 0, 1}, {0x23, 781, 1, 0, 1}, {0x20, 154, 1, 0, 1},
+        {0x20, 782, 1, 0, 1}, {0x20, 154, 1, 0, 6}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 2},
+        {0x23, 81, 1, 0, 1}, {0x23, 783, 1, 0, 1}, {0x23, 784, 1, 0, 1}, {0x23, 785, 1, 0, 1}, {0x23, 786, 1, 0, 1}, {0x23, 81, 1, 0, 1},
+        {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 3}, {0x23, 82, 1, 0, 1}, {0x23, 54, 1, 0, 1}, {0x23, 787, 1, 0, 1},
+        {0x23, 788, 1, 0, 1}, {0x23, 789, 1, 0, 1}, {0x23, 790, 1, 0, 1}, {0x23, 791, 1, 0, 1}, {0x23, 792, 1, 0, 1}, {0x23, 793, 1, 0, 1},
+        {0x23, 794, 1, 0, 1}, {0x23, 795, 1, 0, 1}, {0x23, 796, 1, 0, 1}, {0x23, 797, 1, 0, 1}, {0x23, 798, 1, 0, 1}, {0x23, 799, 1, 0, 1},
+        {0x23, 800, 1, 0, 1}, {0x23, 801, 1, 0, 1}, {0x23, 802, 1, 0, 1}, {0x23, 803, 1, 0, 1}, {0x23, 804, 1, 0, 1}, {0x23, 805, 1, 0, 1},
+        {0x23, 806, 1, 0, 1}, {0x23, 807, 1, 0, 1}, {0x23, 808, 1, 0, 1}, {0x23, 809, 1, 0, 1}, {0x23, 810, 1, 0, 1}, {0x23, 811, 1, 0, 1},
+        {0x23, 812, 1, 0, 1}, {0x23, 813, 1, 0, 1}, {0x23, 814, 1, 0, 1}, {0x23, 815, 1, 0, 1}, {0x23, 816, 1, 0, 1}, {0x23, 817, 1, 0, 1},
+        {0x23, 818, 1, 0, 1}, {0x23, 819, 1, 0, 1}, {0x23, 820, 1, 0, 1}, {0x23, 821, 1, 0, 1}, {0x23, 822, 1, 0, 1}, {0x23, 823, 1, 0, 1},
+        {0x23, 824, 1, 0, 1}, {0x23, 825, 1, 0, 1}, {0x23, 826, 1, 0, 1}, {0x23, 827, 1, 0, 1}, {0x23, 828, 1, 0, 1}, {0x23, 155, 1, 0, 1},
+        {0x23, 829, 1, 0, 1}, {0x23, 830, 1, 0, 1}, {0x23, 831, 1, 0, 1}, {0x23, 832, 1, 0, 1}, {0x23, 61, 1, 0, 1}, {0x23, 833, 1, 0, 1},
+        {0x23, 834, 1, 0, 1}, {0x23, 835, 1, 0, 1}, {0x23, 836, 1, 0, 1}, {0x23, 837, 1, 0, 1}, {0x23, 838, 1, 0, 1}, {0x23, 839, 1, 0, 1},
+        {0x23, 840, 1, 0, 1}, {0x23, 841, 1, 0, 1}, {0x23, 842, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 352, 1, 0, 1}, {0x20, 154, 1, 0, 6},
+        {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 1}, {0x23, 106, 1, 0, 1}, {0x23, 501, 1, 0, 1},
+        {0x23, 843, 1, 0, 1}, {0x23, 844, 1, 0, 1}, {0x23, 845, 1, 0, 1}, {0x23, 846, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 2},
+        {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 2}, {0x23, 109, 1, 0, 2}, {0x23, 847, 1, 0, 1}, {0x23, 848, 1, 0, 1}, {0x23, 849, 1, 0, 1},
+        {0x23, 850, 1, 0, 1}, {0x23, 851, 1, 0, 1}, {0x23, 852, 1, 0, 1}, {0x23, 853, 1, 0, 1}, {0x23, 854, 1, 0, 1}, {0x23, 855, 1, 0, 1},
+        {0x23, 856, 1, 0, 1}, {0x23, 857, 1, 0, 1}, {0x23, 858, 1, 0, 1}, {0x23, 859, 1, 0, 1}, {0x23, 860, 1, 0, 1}, {0x23, 861, 1, 0, 1},
+        {0x23, 862, 1, 0, 1}, {0x23, 863, 1, 0, 1}, {0x23, 864, 1, 0, 1}, {0x23, 865, 1, 0, 1}, {0x23, 866, 1, 0, 1}, {0x23, 867, 1, 0, 1},
+        {0x23, 868, 1, 0, 1}, {0x23, 869, 1, 0, 1}, {0x23, 870, 1, 0, 1}, {0x23, 871, 1, 0, 1}, {0x23, 872, 1, 0, 1}, {0x23, 873, 1, 0, 1},
+        {0x23, 874, 1, 0, 1}, {0x23, 875, 1, 0, 1}, {0x23, 876, 1, 0, 1}, {0x23, 877, 1, 0, 1}, {0x23, 878, 1, 0, 1}, {0x23, 879, 1, 0, 1},
+        {0x23, 880, 1, 0, 1}, {0x23, 881, 1, 0, 1}, {0x23, 882, 1, 0, 1}, {0x23, 883, 1, 0, 1}, {0x23, 884, 1, 0, 1}, {0x23, 885, 1, 0, 1},
+        {0x23, 886, 1, 0, 1}, {0x23, 887, 1, 0, 1}, {0x23, 55, 1, 0, 1}, {0x23, 237, 1, 0, 1}, {0x23, 888, 1, 0, 1}, {0x23, 758, 1, 0, 1},
+        {0x23, 889, 1, 0, 1}, {0x23, 890, 1, 0, 1}, {0x23, 891, 1, 0, 1}, {0x23, 892, 1, 0, 1}, {0x23, 893, 1, 0, 1}, {0x23, 894, 1, 0, 1},
+        {0x23, 895, 1, 0, 1}, {0x23, 896, 1, 0, 1}, {0x23, 897, 1, 0, 1}, {0x23, 129, 1, 0, 1}, {0x23, 898, 1, 0, 1}, {0x23, 899, 1, 0, 1},
+        {0x23, 900, 1, 0, 1}, {0x23, 901, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 6}, {0x23, 109, 1, 0, 1},
+        {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 1}, {0x23, 902, 1, 0, 1}, {0x23, 903, 1, 0, 1}, {0x23, 904, 1, 0, 1},
+        {0x23, 905, 1, 0, 1}, {0x23, 400, 1, 0, 1}, {0x23, 262, 1, 0, 1}, {0x23, 131, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 2},
+        {0x23, 107, 1, 0, 2}, {0x23, 906, 1, 0, 1}, {0x23, 907, 1, 0, 1}, {0x23, 908, 1, 0, 1}, {0x23, 909, 1, 0, 1}, {0x23, 910, 1, 0, 1},
+        {0x23, 911, 1, 0, 1}, {0x23, 912, 1, 0, 1}, {0x23, 913, 1, 0, 1}, {0x23, 914, 1, 0, 1}, {0x23, 915, 1, 0, 1}, {0x23, 916, 1, 0, 1},
+        {0x23, 917, 1, 0, 1}, {0x23, 918, 1, 0, 1}, {0x23, 919, 1, 0, 1}, {0x23, 582, 1, 0, 1}, {0x23, 920, 1, 0, 1}, {0x23, 921, 1, 0, 1},
+        {0x23, 922, 1, 0, 1}, {0x23, 914, 1, 0, 1}, {0x23, 923, 1, 0, 1}, {0x23, 924, 1, 0, 1}, {0x23, 925, 1, 0, 1}, {0x23, 926, 1, 0, 1},
+        {0x23, 927, 1, 0, 1}, {0x23, 928, 1, 0, 1}, {0x23, 929, 1, 0, 1}, {0x23, 930, 1, 0, 1}, {0x23, 931, 1, 0, 1}, {0x23, 932, 1, 0, 1},
+        {0x23, 933, 1, 0, 1}, {0x23, 934, 1, 0, 1}, {0x23, 935, 1, 0, 1}, {0x23, 936, 1, 0, 1}, {0x23, 937, 1, 0, 1}, {0x23, 938, 1, 0, 1},
+        {0x23, 939, 1, 0, 1}, {0x23, 940, 1, 0, 1}, {0x23, 941, 1, 0, 1}, {0x23, 942, 1, 0, 1}, {0x23, 943, 1, 0, 1}, {0x23, 944, 1, 0, 1},
+        {0x23, 945, 1, 0, 1}, {0x23, 946, 1, 0, 1}, {0x23, 947, 1, 0, 1}, {0x23, 948, 1, 0, 1}, {0x23, 949, 1, 0, 1}, {0x23, 950, 1, 0, 1},
+        {0x23, 951, 1, 0, 1}, {0x23, 952, 1, 0, 1}, {0x23, 953, 1, 0, 1}, {0x23, 954, 1, 0, 1}, {0x23, 955, 1, 0, 1}, {0x23, 956, 1, 0, 1},
+        {0x23, 957, 1, 0, 1}, {0x23, 958, 1, 0, 1}, {0x23, 959, 1, 0, 1}, {0x23, 960, 1, 0, 1}, {0x23, 961, 1, 0, 1}, {0x23, 962, 1, 0, 1},
+        {0x23, 790, 1, 0, 1}, {0x23, 963, 1, 0, 1}, {0x23, 964, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 260, 1, 0, 1}, {0x20, 154, 1, 0, 5},
+        {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 2}, {0x23, 82, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 965, 1, 0, 1},
+        {0x23, 966, 1, 0, 1}, {0x23, 967, 1, 0, 1}, {0x23, 441, 1, 0, 1}, {0x23, 968, 1, 0, 1}, {0x23, 131, 1, 0, 1}, {0x23, 107, 1, 0, 2},
+        {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 1}, {0x23, 237, 1, 0, 1}, {0x23, 969, 1, 0, 1}, {0x23, 970, 1, 0, 1}, {0x23, 971, 1, 0, 1},
+        {0x23, 458, 1, 0, 1}, {0x23, 972, 1, 0, 1}, {0x23, 973, 1, 0, 1}, {0x23, 974, 1, 0, 1}, {0x23, 975, 1, 0, 1}, {0x23, 976, 1, 0, 1},
+        {0x23, 977, 1, 0, 1}, {0x23, 978, 1, 0, 1}, {0x23, 979, 1, 0, 1}, {0x23, 980, 1, 0, 1}, {0x23, 981, 1, 0, 1}, {0x23, 982, 1, 0, 1},
+        {0x23, 983, 1, 0, 1}, {0x23, 984, 1, 0, 1}, {0x23, 985, 1, 0, 1}, {0x23, 986, 1, 0, 1}, {0x23, 987, 1, 0, 1}, {0x23, 988, 1, 0, 1},
+        {0x23, 989, 1, 0, 1}, {0x23, 990, 1, 0, 1}, {0x23, 991, 1, 0, 1}, {0x23, 992, 1, 0, 1}, {0x23, 993, 1, 0, 1}, {0x23, 994, 1, 0, 1},
+        {0x23, 995, 1, 0, 1}, {0x23, 996, 1, 0, 1}, {0x23, 997, 1, 0, 1}, {0x23, 998, 1, 0, 1}, {0x23, 634, 1, 0, 1}, {0x23, 999, 1, 0, 1},
+        {0x23, 1000, 1, 0, 1}, {0x23, 1001, 1, 0, 1}, {0x23, 1002, 1, 0, 1}, {0x23, 1003, 1, 0, 1}, {0x23, 1004, 1, 0, 1}, {0x23, 1005, 1, 0, 1},
+        {0x23, 1006, 1, 0, 1}, {0x23, 1007, 1, 0, 1}, {0x23, 1008, 1, 0, 1}, {0x23, 1009, 1, 0, 1}, {0x23, 1010, 1, 0, 1}, {0x23, 1011, 1, 0, 1},
+        {0x23, 1012, 1, 0, 1}, {0x23, 747, 1, 0, 1}, {0x23, 1013, 1, 0, 1}, {0x23, 1014, 1, 0, 1}, {0x23, 1015, 1, 0, 1}, {0x23, 1016, 1, 0, 1},
+        {0x23, 1017, 1, 0, 1}, {0x23, 1018, 1, 0, 1}, {0x23, 1019, 1, 0, 1}, {0x23, 1020, 1, 0, 1}, {0x23, 1021, 1, 0, 1}, {0x23, 1022, 1, 0, 1},
+        {0x23, 1023, 1, 0, 1}, {0x23, 1024, 1, 0, 1}, {0x23, 1025, 1, 0, 1}, {0x23, 1026, 1, 0, 1}, {0x20, 1027, 1, 0, 1}, {0x20, 154, 1, 0, 7},
+        {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 296, 1, 0, 1}, {0x23, 790, 1, 0, 1},
+        {0x23, 1028, 1, 0, 1}, {0x23, 1029, 1, 0, 1}, {0x23, 1030, 1, 0, 1}, {0x23, 1031, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 109, 1, 0, 1},
+        {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 1}, {0x23, 108, 1, 0, 1}, {0x23, 1032, 1, 0, 1}, {0x23, 1033, 1, 0, 1},
+        {0x23, 886, 1, 0, 1}, {0x23, 1034, 1, 0, 1}, {0x23, 1035, 1, 0, 1}, {0x23, 1036, 1, 0, 1}, {0x23, 1037, 1, 0, 1}, {0x23, 1038, 1, 0, 1},
+        {0x23, 1039, 1, 0, 1}, {0x23, 1040, 1, 0, 1}, {0x23, 1041, 1, 0, 1}, {0x23, 1042, 1, 0, 1}, {0x23, 1043, 1, 0, 1}, {0x23, 1044, 1, 0, 1},
+        {0x23, 1045, 1, 0, 1}, {0x23, 1046, 1, 0, 1}, {0x23, 1047, 1, 0, 1}, {0x23, 1048, 1, 0, 1}, {0x23, 1049, 1, 0, 1}, {0x23, 1050, 1, 0, 1},
+        {0x23, 1051, 1, 0, 1}, {0x23, 1052, 1, 0, 1}, {0x23, 1053, 1, 0, 1}, {0x23, 1054, 1, 0, 1}, {0x23, 1055, 1, 0, 1}, {0x23, 1056, 1, 0, 1},
+        {0x23, 1057, 1, 0, 1}, {0x23, 1058, 1, 0, 1}, {0x23, 1059, 1, 0, 1}, {0x23, 1060, 1, 0, 1}, {0x23, 1061, 1, 0, 1}, {0x23, 1062, 1, 0, 1},
+        {0x23, 1063, 1, 0, 1}, {0x23, 1064, 1, 0, 1}, {0x23, 34, 1, 0, 1}, {0x23, 1065, 1, 0, 1}, {0x23, 1066, 1, 0, 1}, {0x23, 1067, 1, 0, 1},
+        {0x23, 1068, 1, 0, 1}, {0x23, 1069, 1, 0, 1}, {0x23, 1070, 1, 0, 1}, {0x23, 1071, 1, 0, 1}, {0x23, 1072, 1, 0, 1}, {0x23, 1073, 1, 0, 1},
+        {0x23, 1074, 1, 0, 1}, {0x23, 1075, 1, 0, 1}, {0x23, 1076, 1, 0, 1}, {0x23, 1077, 1, 0, 1}, {0x23, 1078, 1, 0, 1}, {0x23, 1079, 1, 0, 1},
+        {0x23, 1080, 1, 0, 1}, {0x23, 1081, 1, 0, 1}, {0x23, 1082, 1, 0, 1}, {0x23, 1083, 1, 0, 1}, {0x23, 1084, 1, 0, 1}, {0x23, 1085, 1, 0, 1},
+        {0x23, 1086, 1, 0, 1}, {0x20, 1087, 1, 0, 1}, {0x23, 1088, 1, 0, 1}, {0x23, 1089, 1, 0, 1}, {0x23, 1090, 1, 0, 1}, {0x20, 154, 1, 0, 1},
+        {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 6}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 131, 1, 0, 1}, {0x23, 106, 1, 0, 1},
+        {0x23, 1091, 1, 0, 1}, {0x23, 1092, 1, 0, 1}, {0x23, 1093, 1, 0, 1}, {0x23, 1094, 1, 0, 1}, {0x23, 1095, 1, 0, 1}, {0x23, 132, 1, 0, 1},
+        {0x23, 82, 1, 0, 1}, {0x23, 107, 1, 0, 3}, {0x23, 131, 1, 0, 2}, {0x23, 82, 1, 0, 1}, {0x23, 701, 1, 0, 1}, {0x23, 1096, 1, 0, 1},
+        {0x23, 1097, 1, 0, 1}, {0x23, 1098, 1, 0, 1}, {0x23, 1099, 1, 0, 1}, {0x23, 1100, 1, 0, 1}, {0x23, 1101, 1, 0, 1}, {0x23, 1102, 1, 0, 1},
+        {0x23, 1103, 1, 0, 1}, {0x23, 1104, 1, 0, 1}, {0x23, 1105, 1, 0, 1}, {0x23, 1106, 1, 0, 1}, {0x23, 1107, 1, 0, 1}, {0x23, 1108, 1, 0, 1},
+        {0x23, 1109, 1, 0, 1}, {0x23, 1110, 1, 0, 1}, {0x23, 1111, 1, 0, 1}, {0x23, 1112, 1, 0, 1}, {0x23, 1113, 1, 0, 1}, {0x23, 1114, 1, 0, 1},
+        {0x23, 1115, 1, 0, 1}, {0x23, 1116, 1, 0, 1}, {0x23, 1117, 1, 0, 1}, {0x23, 1118, 1, 0, 1}, {0x23, 1119, 1, 0, 1}, {0x23, 1120, 1, 0, 1},
+        {0x23, 1121, 1, 0, 1}, {0x23, 1122, 1, 0, 1}, {0x23, 1123, 1, 0, 1}, {0x23, 1124, 1, 0, 1}, {0x23, 1125, 1, 0, 1}, {0x23, 1126, 1, 0, 1},
+        {0x23, 1127, 1, 0, 1}, {0x23, 1128, 1, 0, 1}, {0x23, 1129, 1, 0, 1}, {0x23, 1130, 1, 0, 1}, {0x23, 1131, 1, 0, 1}, {0x23, 1132, 1, 0, 1},
+        {0x23, 1133, 1, 0, 1}, {0x23, 1134, 1, 0, 1}, {0x23, 1135, 1, 0, 1}, {0x23, 1136, 1, 0, 1}, {0x23, 1137, 1, 0, 1}, {0x23, 1138, 1, 0, 1},
+        {0x23, 1139, 1, 0, 1}, {0x23, 1140, 1, 0, 1}, {0x23, 1141, 1, 0, 1}, {0x23, 1142, 1, 0, 1}, {0x23, 1143, 1, 0, 1}, {0x23, 1144, 1, 0, 1},
+        {0x23, 1145, 1, 0, 1}, {0x23, 1146, 1, 0, 1}, {0x23, 1147, 1, 0, 1}, {0x23, 1148, 1, 0, 1}, {0x23, 1149, 1, 0, 1}, {0x23, 726, 1, 0, 1},
+        {0x23, 1150, 1, 0, 1}, {0x23, 1151, 1, 0, 1}, {0x20, 1152, 1, 0, 1}, {0x23, 1153, 1, 0, 1}, {0x23, 1154, 1, 0, 1}, {0x23, 1155, 1, 0, 1},
+        {0x20, 154, 1, 0, 1}, {0x20, 782, 1, 0, 1}, {0x20, 154, 1, 0, 6}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 4}, {0x23, 109, 1, 0, 1},
+        {0x23, 295, 1, 0, 1}, {0x23, 1156, 1, 0, 1}, {0x23, 1157, 1, 0, 1}, {0x23, 1158, 1, 0, 1}, {0x23, 1159, 1, 0, 1}, {0x23, 1160, 1, 0, 1},
+        {0x23, 132, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 107, 1, 0, 3}, {0x23, 131, 1, 0, 2}, {0x23, 82, 1, 0, 1}, {0x23, 46, 1, 0, 1},
+        {0x23, 1161, 1, 0, 1}, {0x23, 1162, 1, 0, 1}, {0x23, 1163, 1, 0, 1}, {0x23, 1164, 1, 0, 1}, {0x23, 1165, 1, 0, 1}, {0x23, 1166, 1, 0, 1},
+        {0x23, 1167, 1, 0, 1}, {0x23, 1168, 1, 0, 1}, {0x23, 1169, 1, 0, 1}, {0x23, 1170, 1, 0, 1}, {0x23, 1171, 1, 0, 1}, {0x23, 1172, 1, 0, 1},
+        {0x23, 1173, 1, 0, 1}, {0x23, 1174, 1, 0, 1}, {0x23, 1175, 1, 0, 1}, {0x23, 1176, 1, 0, 1}, {0x23, 1177, 1, 0, 1}, {0x23, 1178, 1, 0, 1},
+        {0x23, 1179, 1, 0, 1}, {0x23, 1180, 1, 0, 1}, {0x23, 1181, 1, 0, 1}, {0x23, 1182, 1, 0, 1}, {0x23, 1183, 1, 0, 1}, {0x23, 1184, 1, 0, 1},
+        {0x23, 1185, 1, 0, 1}, {0x23, 1186, 1, 0, 1}, {0x23, 1187, 1, 0, 1}, {0x23, 1188, 1, 0, 1}, {0x23, 1189, 1, 0, 1}, {0x23, 1190, 1, 0, 1},
+        {0x23, 1191, 1, 0, 1}, {0x23, 1192, 1, 0, 1}, {0x23, 1193, 1, 0, 1}, {0x23, 1194, 1, 0, 1}, {0x23, 1195, 1, 0, 1}, {0x23, 1196, 1, 0, 1},
+        {0x23, 1197, 1, 0, 1}, {0x23, 1198, 1, 0, 1}, {0x23, 1199, 1, 0, 1}, {0x23, 1200, 1, 0, 1}, {0x23, 1201, 1, 0, 1}, {0x23, 1202, 1, 0, 1},
+        {0x23, 1203, 1, 0, 1}, {0x23, 1204, 1, 0, 1}, {0x23, 1205, 1, 0, 1}, {0x23, 1206, 1, 0, 1}, {0x23, 1207, 1, 0, 1}, {0x23, 1208, 1, 0, 1},
+        {0x23, 1209, 1, 0, 1}, {0x23, 1210, 1, 0, 1}, {0x23, 1211, 1, 0, 1}, {0x23, 1212, 1, 0, 1}, {0x23, 1213, 1, 0, 1}, {0x23, 1214, 1, 0, 1},
+        {0x23, 1215, 1, 0, 1}, {0x23, 1216, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x23, 1217, 1, 0, 1}, {0x23, 1218, 1, 0, 1}, {0x23, 1219, 1, 0, 1},
+        {0x20, 1220, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 6}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 3},
+        {0x23, 108, 1, 0, 1}, {0x23, 132, 1, 0, 1}, {0x23, 1221, 1, 0, 1}, {0x23, 1222, 1, 0, 1}, {0x23, 1223, 1, 0, 1}, {0x23, 1224, 1, 0, 1},
+        {0x23, 1225, 1, 0, 1}, {0x23, 1226, 1, 0, 1}, {0x23, 1227, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 107, 1, 0, 3}, {0x23, 109, 1, 0, 3},
+        {0x23, 1228, 1, 0, 1}, {0x23, 1229, 1, 0, 1}, {0x23, 1230, 1, 0, 1}, {0x23, 1231, 1, 0, 1}, {0x23, 1232, 1, 0, 1}, {0x23, 1233, 1, 0, 1},
+        {0x23, 1234, 1, 0, 1}, {0x23, 1235, 1, 0, 1}, {0x23, 1133, 1, 0, 1}, {0x23, 1236, 1, 0, 1}, {0x23, 1237, 1, 0, 1}, {0x23, 1238, 1, 0, 1},
+        {0x23, 1239, 1, 0, 1}, {0x23, 1240, 1, 0, 1}, {0x23, 1241, 1, 0, 1}, {0x23, 1242, 1, 0, 1}, {0x23, 1243, 1, 0, 1}, {0x23, 1244, 1, 0, 1},
+        {0x23, 1245, 1, 0, 1}, {0x23, 1246, 1, 0, 1}, {0x23, 1247, 1, 0, 1}, {0x23, 1248, 1, 0, 1}, {0x23, 1249, 1, 0, 1}, {0x23, 1250, 1, 0, 1},
+        {0x23, 1251, 1, 0, 1}, {0x23, 1252, 1, 0, 1}, {0x23, 1253, 1, 0, 1}, {0x23, 1254, 1, 0, 1}, {0x23, 1255, 1, 0, 1}, {0x23, 1256, 1, 0, 1},
+        {0x23, 1257, 1, 0, 1}, {0x23, 1258, 1, 0, 1}, {0x23, 1259, 1, 0, 1}, {0x23, 1260, 1, 0, 1}, {0x23, 1261, 1, 0, 1}, {0x23, 1262, 1, 0, 1},
+        {0x23, 1263, 1, 0, 1}, {0x23, 1264, 1, 0, 1}, {0x23, 1265, 1, 0, 1}, {0x23, 1266, 1, 0, 1}, {0x23, 1267, 1, 0, 1}, {0x23, 1268, 1, 0, 1},
+        {0x23, 1269, 1, 0, 1}, {0x23, 1270, 1, 0, 1}, {0x23, 1271, 1, 0, 1}, {0x23, 1272, 1, 0, 1}, {0x23, 1273, 1, 0, 1}, {0x23, 1274, 1, 0, 1},
+        {0x23, 1275, 1, 0, 1}, {0x23, 1276, 1, 0, 1}, {0x23, 1277, 1, 0, 1}, {0x23, 1278, 1, 0, 1}, {0x23, 1279, 1, 0, 1}, {0x23, 1280, 1, 0, 1},
+        {0x23, 1281, 1, 0, 1}, {0x20, 1282, 1, 0, 1}, {0x20, 154, 1, 0, 2}, {0x23, 1283, 1, 0, 1}, {0x23, 1284, 1, 0, 1}, {0x23, 1285, 1, 0, 1},
+        {0x20, 610, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 7}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 1},
+        {0x23, 344, 1, 0, 1}, {0x23, 97, 1, 0, 1}, {0x23, 1286, 1, 0, 1}, {0x23, 1287, 1, 0, 1}, {0x23, 1288, 1, 0, 1}, {0x23, 571, 1, 0, 1},
+        {0x23, 1289, 1, 0, 1}, {0x23, 1290, 1, 0, 1}, {0x23, 131, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 107, 1, 0, 3}, {0x23, 131, 1, 0, 1},
+        {0x23, 109, 1, 0, 1}, {0x23, 1291, 1, 0, 1}, {0x23, 1292, 1, 0, 1}, {0x23, 1293, 1, 0, 1}, {0x23, 1294, 1, 0, 1}, {0x23, 1295, 1, 0, 1},
+        {0x23, 1296, 1, 0, 1}, {0x23, 1297, 1, 0, 1}, {0x23, 1298, 1, 0, 1}, {0x23, 1299, 1, 0, 1}, {0x23, 1300, 1, 0, 1}, {0x23, 1189, 1, 0, 1},
+        {0x23, 1301, 1, 0, 1}, {0x23, 1302, 1, 0, 1}, {0x23, 1303, 1, 0, 1}, {0x23, 1304, 1, 0, 1}, {0x23, 1305, 1, 0, 1}, {0x23, 1306, 1, 0, 1},
+        {0x23, 1307, 1, 0, 1}, {0x23, 1308, 1, 0, 1}, {0x23, 1309, 1, 0, 1}, {0x23, 1310, 1, 0, 1}, {0x23, 1311, 1, 0, 1}, {0x23, 1312, 1, 0, 1},
+        {0x23, 1313, 1, 0, 1}, {0x23, 1314, 1, 0, 1}, {0x23, 1315, 1, 0, 1}, {0x23, 1316, 1, 0, 1}, {0x23, 1317, 1, 0, 1}, {0x23, 1256, 1, 0, 1},
+        {0x23, 1318, 1, 0, 1}, {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1321, 1, 0, 1}, {0x23, 1322, 1, 0, 1},
+        {0x23, 1323, 1, 0, 1}, {0x23, 1324, 1, 0, 1}, {0x23, 1325, 1, 0, 1}, {0x23, 1326, 1, 0, 1}, {0x23, 1327, 1, 0, 1}, {0x23, 1328, 1, 0, 1},
+        {0x23, 1329, 1, 0, 1}, {0x23, 1330, 1, 0, 1}, {0x23, 1331, 1, 0, 1}, {0x23, 1332, 1, 0, 1}, {0x23, 1333, 1, 0, 1}, {0x23, 1334, 1, 0, 1},
+        {0x23, 1335, 1, 0, 1}, {0x20, 154, 1, 0, 2}, {0x20, 1336, 1, 0, 1}, {0x23, 1337, 1, 0, 1}, {0x23, 1338, 1, 0, 1}, {0x23, 1339, 1, 0, 1},
+        {0x20, 154, 1, 0, 3}, {0x23, 1340, 1, 0, 1}, {0x23, 1341, 1, 0, 1}, {0x23, 1342, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 352, 1, 0, 1},
+        {0x20, 154, 1, 0, 8}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 81, 1, 0, 1}, {0x23, 615, 1, 0, 1}, {0x23, 1343, 1, 0, 1},
+        {0x23, 1344, 1, 0, 1}, {0x23, 1345, 1, 0, 1}, {0x23, 1346, 1, 0, 1}, {0x23, 1347, 1, 0, 1}, {0x23, 1348, 1, 0, 1}, {0x23, 1349, 1, 0, 1},
+        {0x23, 1350, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 131, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 1}, {0x23, 109, 1, 0, 1},
+        {0x23, 611, 1, 0, 1}, {0x23, 1351, 1, 0, 1}, {0x23, 1352, 1, 0, 1}, {0x23, 1353, 1, 0, 1}, {0x23, 1354, 1, 0, 1}, {0x23, 1355, 1, 0, 1},
+        {0x23, 1356, 1, 0, 1}, {0x23, 1357, 1, 0, 1}, {0x23, 1358, 1, 0, 1}, {0x23, 1359, 1, 0, 1}, {0x23, 1360, 1, 0, 1}, {0x23, 1361, 1, 0, 1},
+        {0x23, 1362, 1, 0, 1}, {0x23, 1361, 1, 0, 1}, {0x23, 1363, 1, 0, 1}, {0x23, 1364, 1, 0, 1}, {0x23, 1365, 1, 0, 1}, {0x23, 1366, 1, 0, 1},
+        {0x23, 1367, 1, 0, 1}, {0x23, 1368, 1, 0, 1}, {0x23, 1369, 1, 0, 1}, {0x23, 1370, 1, 0, 1}, {0x23, 1371, 1, 0, 1}, {0x23, 1372, 1, 0, 1},
+        {0x23, 1259, 1, 0, 1}, {0x23, 1373, 1, 0, 1}, {0x23, 1374, 1, 0, 1}, {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1},
+        {0x23, 1320, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1375, 1, 0, 1}, {0x23, 1376, 1, 0, 1}, {0x23, 1377, 1, 0, 1}, {0x23, 1378, 1, 0, 1},
+        {0x23, 1379, 1, 0, 1}, {0x23, 1380, 1, 0, 1}, {0x23, 1381, 1, 0, 1}, {0x23, 1382, 1, 0, 1}, {0x23, 1383, 1, 0, 1}, {0x23, 1384, 1, 0, 1},
+        {0x23, 1385, 1, 0, 1}, {0x23, 1386, 1, 0, 1}, {0x23, 1387, 1, 0, 1}, {0x23, 1388, 1, 0, 1}, {0x23, 1389, 1, 0, 1}, {0x20, 260, 1, 0, 1},
+        {0x20, 213, 1, 0, 1}, {0x23, 1390, 1, 0, 1}, {0x23, 1391, 1, 0, 1}, {0x20, 1392, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 213, 1, 0, 1},
+        {0x20, 154, 1, 0, 1}, {0x23, 1393, 1, 0, 1}, {0x23, 1394, 1, 0, 1}, {0x23, 1395, 1, 0, 1}, {0x20, 1336, 1, 0, 1}, {0x20, 352, 1, 0, 1},
+        {0x20, 154, 1, 0, 9}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 446, 1, 0, 1}, {0x23, 1396, 1, 0, 1}, {0x23, 1397, 1, 0, 1},
+        {0x23, 1398, 1, 0, 1}, {0x23, 1399, 1, 0, 1}, {0x23, 875, 1, 0, 1}, {0x23, 1163, 1, 0, 1}, {0x23, 1400, 1, 0, 1}, {0x23, 1401, 1, 0, 1},
+        {0x23, 829, 1, 0, 1}, {0x23, 262, 1, 0, 1}, {0x23, 131, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 1}, {0x23, 106, 1, 0, 1},
+        {0x23, 193, 1, 0, 1}, {0x23, 1402, 1, 0, 1}, {0x23, 1079, 1, 0, 1}, {0x23, 1403, 1, 0, 1}, {0x23, 1404, 1, 0, 1}, {0x23, 21, 1, 0, 1},
+        {0x23, 1405, 1, 0, 1}, {0x23, 1406, 1, 0, 1}, {0x23, 1407, 1, 0, 1}, {0x23, 1408, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1},
+        {0x23, 1320, 1, 0, 1}, {0x23, 1359, 1, 0, 1}, {0x23, 1408, 1, 0, 1}, {0x23, 1361, 1, 0, 1}, {0x23, 1409, 1, 0, 1}, {0x23, 1410, 1, 0, 1},
+        {0x23, 1411, 1, 0, 1}, {0x23, 1412, 1, 0, 1}, {0x23, 1413, 1, 0, 1}, {0x23, 1414, 1, 0, 1}, {0x23, 1415, 1, 0, 1}, {0x23, 1319, 1, 0, 1},
+        {0x23, 1320, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2}, {0x23, 1256, 1, 0, 1},
+        {0x23, 1321, 1, 0, 1}, {0x23, 1416, 1, 0, 1}, {0x23, 1417, 1, 0, 1}, {0x23, 1418, 1, 0, 1}, {0x23, 1419, 1, 0, 1}, {0x23, 1420, 1, 0, 1},
+        {0x23, 1421, 1, 0, 1}, {0x23, 1422, 1, 0, 1}, {0x23, 1423, 1, 0, 1}, {0x23, 1424, 1, 0, 1}, {0x23, 1425, 1, 0, 1}, {0x23, 485, 1, 0, 1},
+        {0x23, 1426, 1, 0, 1}, {0x23, 1427, 1, 0, 1}, {0x20, 610, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 1428, 1, 0, 1},
+        {0x20, 154, 1, 0, 2}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x23, 1429, 1, 0, 1}, {0x23, 1430, 1, 0, 1}, {0x23, 1431, 1, 0, 1},
+        {0x20, 154, 1, 0, 12}, {0x23, 107, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 196, 1, 0, 1}, {0x23, 1432, 1, 0, 1}, {0x23, 1433, 1, 0, 1},
+        {0x23, 1434, 1, 0, 1}, {0x23, 1435, 1, 0, 1}, {0x23, 1436, 1, 0, 1}, {0x23, 1437, 1, 0, 1}, {0x23, 1438, 1, 0, 1}, {0x23, 1439, 1, 0, 1},
+        {0x23, 1440, 1, 0, 1}, {0x23, 282, 1, 0, 1}, {0x23, 83, 1, 0, 1}, {0x23, 353, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 1},
+        {0x23, 109, 1, 0, 1}, {0x23, 1441, 1, 0, 1}, {0x23, 1442, 1, 0, 1}, {0x23, 793, 1, 0, 1}, {0x23, 1443, 1, 0, 1}, {0x23, 768, 1, 0, 1},
+        {0x23, 1444, 1, 0, 1}, {0x23, 85, 1, 0, 1}, {0x23, 1445, 1, 0, 1}, {0x23, 1446, 1, 0, 1}, {0x23, 1408, 1, 0, 1}, {0x23, 1318, 1, 0, 2},
+        {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1374, 1, 0, 1}, {0x23, 1321, 1, 0, 1},
+        {0x23, 1373, 1, 0, 1}, {0x23, 1362, 1, 0, 1}, {0x23, 1447, 1, 0, 1}, {0x23, 1318, 1, 0, 1}, {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2},
+        {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2}, {0x23, 1259, 1, 0, 1}, {0x23, 1448, 1, 0, 1},
+        {0x23, 1449, 1, 0, 1}, {0x23, 1450, 1, 0, 1}, {0x23, 1451, 1, 0, 1}, {0x23, 1452, 1, 0, 1}, {0x23, 1453, 1, 0, 1}, {0x23, 1454, 1, 0, 1},
+        {0x23, 1455, 1, 0, 1}, {0x23, 1456, 1, 0, 1}, {0x23, 630, 1, 0, 1}, {0x23, 1457, 1, 0, 1}, {0x23, 1458, 1, 0, 1}, {0x23, 1459, 1, 0, 1},
+        {0x23, 1460, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 352, 1, 0, 1}, {0x20, 154, 1, 0, 4}, {0x20, 1461, 1, 0, 1}, {0x23, 1462, 1, 0, 1},
+        {0x23, 1463, 1, 0, 1}, {0x20, 1464, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 11}, {0x23, 402, 1, 0, 1},
+        {0x23, 1291, 1, 0, 1}, {0x23, 54, 1, 0, 1}, {0x23, 1465, 1, 0, 1}, {0x23, 1466, 1, 0, 1}, {0x23, 1467, 1, 0, 1}, {0x23, 1468, 1, 0, 1},
+        {0x23, 1469, 1, 0, 1}, {0x23, 1470, 1, 0, 1}, {0x23, 1471, 1, 0, 1}, {0x23, 1472, 1, 0, 1}, {0x23, 1473, 1, 0, 1}, {0x23, 1474, 1, 0, 1},
+        {0x23, 188, 1, 0, 1}, {0x23, 130, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 701, 1, 0, 1},
+        {0x23, 1475, 1, 0, 1}, {0x23, 890, 1, 0, 1}, {0x23, 1077, 1, 0, 1}, {0x23, 1476, 1, 0, 1}, {0x23, 1477, 1, 0, 1}, {0x23, 1478, 1, 0, 1},
+        {0x23, 1479, 1, 0, 1}, {0x23, 1480, 1, 0, 1}, {0x23, 1481, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2},
+        {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2},
+        {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1317, 1, 0, 1},
+        {0x23, 1482, 1, 0, 1}, {0x23, 1483, 1, 0, 1}, {0x23, 1484, 1, 0, 1}, {0x23, 1485, 1, 0, 1}, {0x23, 1486, 1, 0, 1}, {0x23, 1487, 1, 0, 1},
+        {0x23, 1488, 1, 0, 1}, {0x23, 1489, 1, 0, 1}, {0x23, 1490, 1, 0, 1}, {0x23, 1491, 1, 0, 1}, {0x23, 1492, 1, 0, 1}, {0x23, 1493, 1, 0, 1},
+        {0x23, 392, 1, 0, 1}, {0x23, 1494, 1, 0, 1}, {0x23, 1495, 1, 0, 1}, {0x20, 1496, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 2},
+        {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x23, 1497, 1, 0, 1}, {0x23, 1498, 1, 0, 1}, {0x23, 1499, 1, 0, 1}, {0x20, 1500, 1, 0, 1},
+        {0x20, 154, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 12}, {0x23, 51, 1, 0, 1}, {0x23, 1501, 1, 0, 1}, {0x23, 1502, 1, 0, 1},
+        {0x23, 1503, 1, 0, 1}, {0x23, 1504, 1, 0, 1}, {0x23, 1505, 1, 0, 1}, {0x23, 802, 1, 0, 1}, {0x23, 1506, 1, 0, 1}, {0x23, 1507, 1, 0, 1},
+        {0x23, 1470, 1, 0, 1}, {0x23, 1508, 1, 0, 1}, {0x23, 1509, 1, 0, 1}, {0x23, 1510, 1, 0, 1}, {0x23, 1511, 1, 0, 1}, {0x23, 237, 1, 0, 1},
+        {0x23, 107, 1, 0, 2}, {0x23, 131, 1, 0, 1}, {0x23, 106, 1, 0, 1}, {0x23, 1512, 1, 0, 1}, {0x23, 1513, 1, 0, 1}, {0x23, 697, 1, 0, 1},
+        {0x23, 814, 1, 0, 1}, {0x23, 1514, 1, 0, 1}, {0x23, 1515, 1, 0, 1}, {0x23, 1516, 1, 0, 1}, {0x23, 1517, 1, 0, 1}, {0x23, 1518, 1, 0, 1},
+        {0x23, 1519, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2},
+        {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2},
+        {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1520, 1, 0, 1}, {0x23, 1521, 1, 0, 1}, {0x23, 1522, 1, 0, 1},
+        {0x23, 1523, 1, 0, 1}, {0x23, 1524, 1, 0, 1}, {0x23, 1525, 1, 0, 1}, {0x23, 1526, 1, 0, 1}, {0x23, 1527, 1, 0, 1}, {0x23, 1528, 1, 0, 1},
+        {0x23, 1529, 1, 0, 1}, {0x23, 1530, 1, 0, 1}, {0x23, 1531, 1, 0, 1}, {0x23, 1532, 1, 0, 1}, {0x23, 728, 1, 0, 1}, {0x23, 171, 1, 0, 1},
+        {0x23, 1533, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 4}, {0x20, 1282, 1, 0, 1}, {0x20, 1534, 1, 0, 1},
+        {0x20, 154, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 14}, {0x23, 1535, 1, 0, 1}, {0x23, 1536, 1, 0, 1}, {0x23, 1537, 1, 0, 1},
+        {0x23, 630, 1, 0, 1}, {0x23, 1538, 1, 0, 1}, {0x23, 1539, 1, 0, 1}, {0x23, 1507, 1, 0, 1}, {0x23, 1540, 1, 0, 1}, {0x23, 1471, 1, 0, 1},
+        {0x23, 1080, 1, 0, 1}, {0x23, 1541, 1, 0, 1}, {0x23, 1542, 1, 0, 1}, {0x23, 1543, 1, 0, 1}, {0x23, 1544, 1, 0, 1}, {0x23, 846, 1, 0, 1},
+        {0x23, 176, 1, 0, 1}, {0x23, 107, 1, 0, 1}, {0x23, 131, 1, 0, 2}, {0x23, 107, 1, 0, 1}, {0x23, 1545, 1, 0, 1}, {0x23, 1546, 1, 0, 1},
+        {0x23, 1547, 1, 0, 1}, {0x23, 1548, 1, 0, 1}, {0x23, 1549, 1, 0, 1}, {0x23, 1550, 1, 0, 1}, {0x23, 1551, 1, 0, 1}, {0x23, 1552, 1, 0, 1},
+        {0x23, 1553, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2},
+        {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 1},
+        {0x23, 1373, 1, 0, 1}, {0x23, 1362, 1, 0, 1}, {0x23, 1447, 1, 0, 1}, {0x23, 1554, 1, 0, 1}, {0x23, 1555, 1, 0, 1}, {0x23, 1259, 1, 0, 1},
+        {0x23, 1556, 1, 0, 1}, {0x23, 1557, 1, 0, 1}, {0x23, 1558, 1, 0, 1}, {0x23, 1559, 1, 0, 1}, {0x23, 1560, 1, 0, 1}, {0x23, 1561, 1, 0, 1},
+        {0x23, 1562, 1, 0, 1}, {0x23, 1563, 1, 0, 1}, {0x23, 1564, 1, 0, 1}, {0x23, 238, 1, 0, 1}, {0x23, 1222, 1, 0, 1}, {0x23, 1565, 1, 0, 1},
+        {0x23, 1566, 1, 0, 1}, {0x23, 1567, 1, 0, 1}, {0x20, 1568, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 7}, {0x20, 306, 1, 0, 1},
+        {0x20, 154, 1, 0, 15}, {0x23, 1569, 1, 0, 1}, {0x23, 1570, 1, 0, 1}, {0x23, 1571, 1, 0, 1}, {0x23, 1572, 1, 0, 1}, {0x23, 1573, 1, 0, 1},
+        {0x23, 876, 1, 0, 1}, {0x23, 1574, 1, 0, 1}, {0x23, 1575, 1, 0, 1}, {0x23, 1507, 1, 0, 1}, {0x23, 1576, 1, 0, 1}, {0x23, 1577, 1, 0, 1},
+        {0x23, 1578, 1, 0, 1}, {0x23, 1579, 1, 0, 1}, {0x23, 1580, 1, 0, 1}, {0x23, 1581, 1, 0, 1}, {0x23, 108, 1, 0, 1}, {0x23, 344, 1, 0, 1},
+        {0x23, 131, 1, 0, 2}, {0x23, 262, 1, 0, 1}, {0x23, 1582, 1, 0, 1}, {0x23, 1583, 1, 0, 1}, {0x23, 1584, 1, 0, 1}, {0x23, 1585, 1, 0, 1},
+        {0x23, 1586, 1, 0, 1}, {0x23, 1587, 1, 0, 1}, {0x23, 1588, 1, 0, 1}, {0x23, 1589, 1, 0, 1}, {0x23, 1590, 1, 0, 1}, {0x23, 1591, 1, 0, 1},
+        {0x23, 1447, 1, 0, 1}, {0x23, 1362, 1, 0, 1}, {0x23, 1373, 1, 0, 1}, {0x23, 1520, 1, 0, 1}, {0x23, 1362, 1, 0, 1}, {0x23, 1592, 1, 0, 2},
+        {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1318, 1, 0, 2}, {0x23, 1319, 1, 0, 1}, {0x23, 1320, 1, 0, 1},
+        {0x23, 1411, 1, 0, 1}, {0x23, 1593, 1, 0, 1}, {0x23, 1262, 1, 0, 1}, {0x23, 1594, 1, 0, 1}, {0x23, 1595, 1, 0, 1}, {0x23, 1596, 1, 0, 1},
+        {0x23, 1597, 1, 0, 1}, {0x23, 1598, 1, 0, 1}, {0x23, 1599, 1, 0, 1}, {0x23, 1600, 1, 0, 1}, {0x23, 1601, 1, 0, 1}, {0x23, 1602, 1, 0, 1},
+        {0x23, 1603, 1, 0, 1}, {0x23, 1604, 1, 0, 1}, {0x23, 1605, 1, 0, 1}, {0x23, 295, 1, 0, 1}, {0x23, 1222, 1, 0, 1}, {0x23, 1606, 1, 0, 1},
+        {0x23, 1607, 1, 0, 1}, {0x23, 1608, 1, 0, 1}, {0x20, 1609, 1, 0, 1}, {0x20, 260, 1, 0, 1}, {0x20, 154, 1, 0, 23}, {0x23, 1610, 1, 0, 1},
+        {0x23, 1611, 1, 0, 1}, {0x23, 1612, 1, 0, 1}, {0x23, 814, 1, 0, 1}, {0x23, 1613, 1, 0, 1}, {0x23, 1614, 1, 0, 1}, {0x23, 1615, 1, 0, 1},
+        {0x23, 875, 1, 0, 1}, {0x23, 1616, 1, 0, 1}, {0x23, 1617, 1, 0, 1}, {0x23, 1618, 1, 0, 1}, {0x23, 1619, 1, 0, 1}, {0x23, 1620, 1, 0, 1},
+        {0x23, 1585, 1, 0, 1}, {0x23, 1621, 1, 0, 1}, {0x23, 1622, 1, 0, 1}, {0x23, 1623, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 131, 1, 0, 1},
+        {0x23, 82, 1, 0, 1}, {0x23, 106, 1, 0, 1}, {0x23, 1624, 1, 0, 1}, {0x23, 1625, 1, 0, 1}, {0x23, 1626, 1, 0, 1}, {0x23, 1627, 1, 0, 1},
+        {0x23, 1628, 1, 0, 1}, {0x23, 1629, 1, 0, 1}, {0x23, 1630, 1, 0, 1}, {0x23, 1631, 1, 0, 1}, {0x23, 1632, 1, 0, 1}, {0x23, 1633, 1, 0, 1},
+        {0x23, 1634, 1, 0, 1}, {0x23, 1635, 1, 0, 1}, {0x23, 1636, 1, 0, 1}, {0x23, 1637, 1, 0, 1}, {0x23, 1638, 1, 0, 1}, {0x23, 1639, 1, 0, 1},
+        {0x23, 1320, 1, 0, 1}, {0x23, 1640, 1, 0, 1}, {0x23, 1641, 1, 0, 1}, {0x23, 1359, 1, 0, 1}, {0x23, 1591, 1, 0, 1}, {0x23, 1447, 1, 0, 1},
+        {0x23, 1642, 1, 0, 1}, {0x23, 1643, 1, 0, 1}, {0x23, 1644, 1, 0, 1}, {0x23, 1645, 1, 0, 1}, {0x23, 1646, 1, 0, 1}, {0x23, 1647, 1, 0, 1},
+        {0x23, 1648, 1, 0, 1}, {0x23, 1649, 1, 0, 1}, {0x23, 1650, 1, 0, 1}, {0x23, 1651, 1, 0, 1}, {0x23, 1652, 1, 0, 1}, {0x23, 1653, 1, 0, 1},
+        {0x23, 1654, 1, 0, 1}, {0x23, 1655, 1, 0, 1}, {0x23, 1656, 1, 0, 1}, {0x23, 105, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 611, 1, 0, 1},
+        {0x23, 845, 1, 0, 1}, {0x23, 290, 1, 0, 1}, {0x23, 1657, 1, 0, 1}, {0x23, 1658, 1, 0, 1}, {0x20, 1500, 1, 0, 1}, {0x20, 306, 1, 0, 1},
+        {0x20, 154, 1, 0, 23}, {0x23, 1659, 1, 0, 1}, {0x23, 1660, 1, 0, 1}, {0x23, 1661, 1, 0, 1}, {0x23, 875, 1, 0, 1}, {0x23, 1662, 1, 0, 1},
+        {0x23, 1663, 1, 0, 1}, {0x23, 1664, 1, 0, 1}, {0x23, 1665, 1, 0, 1}, {0x23, 1666, 1, 0, 1}, {0x23, 1667, 1, 0, 1}, {0x23, 1668, 1, 0, 1},
+        {0x23, 126, 1, 0, 1}, {0x23, 1669, 1, 0, 1}, {0x23, 1670, 1, 0, 1}, {0x23, 1671, 1, 0, 1}, {0x23, 1672, 1, 0, 1}, {0x23, 1673, 1, 0, 1},
+        {0x23, 106, 1, 0, 1}, {0x23, 81, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 237, 1, 0, 1}, {0x23, 1674, 1, 0, 1}, {0x23, 1675, 1, 0, 1},
+        {0x23, 1676, 1, 0, 1}, {0x23, 1677, 1, 0, 1}, {0x23, 1438, 1, 0, 1}, {0x23, 1228, 1, 0, 1}, {0x23, 1678, 1, 0, 1}, {0x23, 1679, 1, 0, 1},
+        {0x23, 1680, 1, 0, 1}, {0x23, 1681, 1, 0, 1}, {0x23, 1682, 1, 0, 1}, {0x23, 1683, 1, 0, 1}, {0x23, 1684, 1, 0, 1}, {0x23, 1685, 1, 0, 1},
+        {0x23, 1686, 1, 0, 1}, {0x23, 1687, 1, 0, 1}, {0x23, 1688, 1, 0, 1}, {0x23, 1689, 1, 0, 1}, {0x23, 1690, 1, 0, 1}, {0x23, 1691, 1, 0, 1},
+        {0x23, 1692, 1, 0, 1}, {0x23, 1693, 1, 0, 1}, {0x23, 1694, 1, 0, 1}, {0x23, 1695, 1, 0, 1}, {0x23, 1696, 1, 0, 1}, {0x23, 1697, 1, 0, 1},
+        {0x23, 1698, 1, 0, 1}, {0x23, 1699, 1, 0, 1}, {0x23, 1700, 1, 0, 1}, {0x23, 1701, 1, 0, 1}, {0x23, 1702, 1, 0, 1}, {0x23, 1703, 1, 0, 1},
+        {0x23, 1704, 1, 0, 1}, {0x23, 1705, 1, 0, 1}, {0x23, 1706, 1, 0, 1}, {0x23, 1707, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 1},
+        {0x23, 131, 1, 0, 1}, {0x23, 1708, 1, 0, 1}, {0x23, 1709, 1, 0, 1}, {0x23, 1710, 1, 0, 1}, {0x23, 1711, 1, 0, 1}, {0x20, 1712, 1, 0, 1},
+        {0x20, 154, 1, 0, 25}, {0x23, 1713, 1, 0, 1}, {0x23, 1230, 1, 0, 1}, {0x23, 875, 1, 0, 1}, {0x23, 1714, 1, 0, 1}, {0x23, 1715, 1, 0, 1},
+        {0x23, 1716, 1, 0, 1}, {0x23, 1717, 1, 0, 1}, {0x23, 1718, 1, 0, 1}, {0x23, 1719, 1, 0, 1}, {0x23, 1720, 1, 0, 1}, {0x23, 1721, 1, 0, 1},
+        {0x23, 1722, 1, 0, 1}, {0x23, 1723, 1, 0, 1}, {0x23, 1724, 1, 0, 1}, {0x23, 1725, 1, 0, 1}, {0x23, 1726, 1, 0, 1}, {0x23, 1727, 1, 0, 1},
+        {0x23, 761, 1, 0, 1}, {0x23, 1728, 1, 0, 1}, {0x23, 354, 1, 0, 1}, {0x23, 1729, 1, 0, 1}, {0x23, 1730, 1, 0, 1}, {0x23, 1731, 1, 0, 1},
+        {0x23, 1732, 1, 0, 1}, {0x23, 1733, 1, 0, 1}, {0x23, 1734, 1, 0, 1}, {0x23, 1735, 1, 0, 1}, {0x23, 1736, 1, 0, 1}, {0x23, 1737, 1, 0, 1},
+        {0x23, 1738, 1, 0, 1}, {0x23, 1739, 1, 0, 1}, {0x23, 1740, 1, 0, 1}, {0x23, 1741, 1, 0, 1}, {0x23, 1742, 1, 0, 1}, {0x23, 1743, 1, 0, 1},
+        {0x23, 1744, 1, 0, 1}, {0x23, 1745, 1, 0, 1}, {0x23, 1746, 1, 0, 1}, {0x23, 1747, 1, 0, 1}, {0x23, 1748, 1, 0, 1}, {0x23, 1749, 1, 0, 1},
+        {0x23, 1750, 1, 0, 1}, {0x23, 1751, 1, 0, 1}, {0x23, 1752, 1, 0, 1}, {0x23, 1753, 1, 0, 1}, {0x23, 1754, 1, 0, 1}, {0x23, 1755, 1, 0, 1},
+        {0x23, 1756, 1, 0, 1}, {0x23, 1757, 1, 0, 1}, {0x23, 1758, 1, 0, 1}, {0x23, 1759, 1, 0, 1}, {0x23, 1760, 1, 0, 1}, {0x23, 1761, 1, 0, 1},
+        {0x23, 1762, 1, 0, 1}, {0x23, 1763, 1, 0, 1}, {0x23, 176, 1, 0, 1}, {0x23, 296, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 295, 1, 0, 1},
+        {0x23, 569, 1, 0, 1}, {0x23, 1764, 1, 0, 1}, {0x23, 1765, 1, 0, 1}, {0x23, 1766, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 352, 1, 0, 1},
+        {0x20, 154, 1, 0, 24}, {0x23, 1767, 1, 0, 1}, {0x23, 1768, 1, 0, 1}, {0x23, 1769, 1, 0, 1}, {0x23, 1770, 1, 0, 1}, {0x23, 1771, 1, 0, 1},
+        {0x23, 1772, 1, 0, 1}, {0x23, 1773, 1, 0, 1}, {0x23, 1774, 1, 0, 1}, {0x23, 1775, 1, 0, 1}, {0x23, 1776, 1, 0, 1}, {0x23, 1777, 1, 0, 1},
+        {0x23, 1778, 1, 0, 1}, {0x23, 1779, 1, 0, 1}, {0x23, 1780, 1, 0, 1}, {0x23, 1781, 1, 0, 1}, {0x23, 1782, 1, 0, 1}, {0x23, 1783, 1, 0, 1},
+        {0x23, 1784, 1, 0, 1}, {0x23, 1785, 1, 0, 1}, {0x23, 1786, 1, 0, 1}, {0x23, 1787, 1, 0, 1}, {0x23, 1788, 1, 0, 1}, {0x23, 1789, 1, 0, 1},
+        {0x23, 1790, 1, 0, 1}, {0x23, 1791, 1, 0, 1}, {0x23, 1792, 1, 0, 1}, {0x23, 1793, 1, 0, 1}, {0x23, 1794, 1, 0, 1}, {0x23, 1795, 1, 0, 1},
+        {0x23, 1796, 1, 0, 1}, {0x23, 1797, 1, 0, 1}, {0x23, 1798, 1, 0, 1}, {0x23, 1799, 1, 0, 1}, {0x23, 1798, 1, 0, 2}, {0x23, 1800, 1, 0, 1},
+        {0x23, 1801, 1, 0, 1}, {0x23, 1802, 1, 0, 1}, {0x23, 1803, 1, 0, 1}, {0x23, 1804, 1, 0, 1}, {0x23, 1805, 1, 0, 1}, {0x23, 1806, 1, 0, 1},
+        {0x23, 1807, 1, 0, 1}, {0x23, 1808, 1, 0, 1}, {0x23, 1809, 1, 0, 1}, {0x23, 1810, 1, 0, 1}, {0x23, 1811, 1, 0, 1}, {0x23, 1812, 1, 0, 1},
+        {0x23, 1813, 1, 0, 1}, {0x23, 1814, 1, 0, 1}, {0x23, 1815, 1, 0, 1}, {0x23, 1816, 1, 0, 1}, {0x23, 1029, 1, 0, 1}, {0x23, 37, 1, 0, 1},
+        {0x23, 1817, 1, 0, 1}, {0x23, 1818, 1, 0, 1}, {0x23, 131, 1, 0, 1}, {0x23, 107, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 1441, 1, 0, 1},
+        {0x23, 1819, 1, 0, 1}, {0x23, 1820, 1, 0, 1}, {0x23, 1821, 1, 0, 1}, {0x23, 1822, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 352, 1, 0, 1},
+        {0x20, 154, 1, 0, 24}, {0x23, 1823, 1, 0, 1}, {0x23, 1824, 1, 0, 1}, {0x23, 1825, 1, 0, 1}, {0x23, 1826, 1, 0, 1}, {0x23, 1827, 1, 0, 1},
+        {0x23, 1828, 1, 0, 1}, {0x23, 1829, 1, 0, 1}, {0x23, 1830, 1, 0, 1}, {0x23, 1831, 1, 0, 1}, {0x23, 1832, 1, 0, 1}, {0x23, 1833, 1, 0, 1},
+        {0x23, 1834, 1, 0, 1}, {0x23, 1835, 1, 0, 1}, {0x23, 1836, 1, 0, 1}, {0x23, 1837, 1, 0, 1}, {0x23, 1838, 1, 0, 1}, {0x23, 1839, 1, 0, 1},
+        {0x23, 1840, 1, 0, 1}, {0x23, 1841, 1, 0, 1}, {0x23, 1842, 1, 0, 1}, {0x23, 1843, 1, 0, 1}, {0x23, 1844, 1, 0, 1}, {0x23, 1845, 1, 0, 1},
+        {0x23, 1843, 1, 0, 1}, {0x23, 1846, 1, 0, 1}, {0x23, 1795, 1, 0, 1}, {0x23, 1847, 1, 0, 1}, {0x23, 1848, 1, 0, 1}, {0x23, 1849, 1, 0, 1},
+        {0x23, 1850, 1, 0, 1}, {0x23, 1851, 1, 0, 1}, {0x23, 1852, 1, 0, 1}, {0x23, 1850, 1, 0, 2}, {0x23, 1853, 1, 0, 1}, {0x23, 1851, 1, 0, 1},
+        {0x23, 1854, 1, 0, 1}, {0x23, 1855, 1, 0, 1}, {0x23, 1856, 1, 0, 1}, {0x23, 1857, 1, 0, 1}, {0x23, 1858, 1, 0, 1}, {0x23, 1859, 1, 0, 1},
+        {0x23, 1860, 1, 0, 1}, {0x23, 1861, 1, 0, 1}, {0x23, 1862, 1, 0, 1}, {0x23, 1863, 1, 0, 1}, {0x23, 1864, 1, 0, 1}, {0x23, 1865, 1, 0, 1},
+        {0x23, 1866, 1, 0, 1}, {0x23, 1867, 1, 0, 1}, {0x23, 1868, 1, 0, 1}, {0x23, 1869, 1, 0, 1}, {0x23, 1870, 1, 0, 1}, {0x23, 1871, 1, 0, 1},
+        {0x23, 614, 1, 0, 1}, {0x23, 902, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 1}, {0x23, 82, 1, 0, 1}, {0x23, 1872, 1, 0, 1},
+        {0x23, 1873, 1, 0, 1}, {0x23, 1874, 1, 0, 1}, {0x23, 1875, 1, 0, 1}, {0x20, 1876, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 25},
+        {0x23, 1877, 1, 0, 1}, {0x23, 1878, 1, 0, 1}, {0x23, 1879, 1, 0, 1}, {0x23, 1880, 1, 0, 1}, {0x23, 1881, 1, 0, 1}, {0x23, 1882, 1, 0, 1},
+        {0x23, 1883, 1, 0, 1}, {0x23, 1884, 1, 0, 1}, {0x23, 1885, 1, 0, 1}, {0x23, 1886, 1, 0, 1}, {0x23, 1887, 1, 0, 1}, {0x23, 1888, 1, 0, 1},
+        {0x23, 1889, 1, 0, 1}, {0x23, 1788, 1, 0, 1}, {0x23, 1890, 1, 0, 1}, {0x23, 1891, 1, 0, 1}, {0x23, 1892, 1, 0, 1}, {0x23, 1848, 1, 0, 1},
+        {0x23, 1854, 1, 0, 1}, {0x23, 1893, 1, 0, 1}, {0x23, 1894, 1, 0, 1}, {0x23, 1895, 1, 0, 1}, {0x23, 1896, 1, 0, 1}, {0x23, 1897, 1, 0, 1},
+        {0x23, 1898, 1, 0, 1}, {0x23, 1795, 1, 0, 1}, {0x23, 1898, 1, 0, 1}, {0x23, 1899, 1, 0, 1}, {0x23, 1849, 1, 0, 1}, {0x23, 1900, 1, 0, 1},
+        {0x23, 1901, 1, 0, 1}, {0x23, 1891, 1, 0, 1}, {0x23, 1898, 1, 0, 1}, {0x23, 1902, 1, 0, 1}, {0x23, 1903, 1, 0, 1}, {0x23, 1898, 1, 0, 1},
+        {0x23, 1901, 1, 0, 1}, {0x23, 1891, 1, 0, 1}, {0x23, 1901, 1, 0, 2}, {0x23, 1891, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1850, 1, 0, 1},
+        {0x23, 1904, 1, 0, 1}, {0x23, 1905, 1, 0, 1}, {0x23, 1906, 1, 0, 1}, {0x23, 1907, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1908, 1, 0, 1},
+        {0x23, 1909, 1, 0, 1}, {0x23, 1910, 1, 0, 1}, {0x23, 1911, 1, 0, 1}, {0x23, 1912, 1, 0, 1}, {0x23, 1158, 1, 0, 1}, {0x23, 1913, 1, 0, 1},
+        {0x23, 262, 1, 0, 1}, {0x23, 107, 1, 0, 2}, {0x23, 82, 1, 0, 1}, {0x23, 1914, 1, 0, 1}, {0x23, 1915, 1, 0, 1}, {0x23, 1916, 1, 0, 1},
+        {0x23, 1917, 1, 0, 1}, {0x20, 1918, 1, 0, 1}, {0x20, 306, 1, 0, 1}, {0x20, 154, 1, 0, 25}, {0x23, 1919, 1, 0, 1}, {0x23, 1920, 1, 0, 1},
+        {0x23, 1921, 1, 0, 1}, {0x23, 1922, 1, 0, 1}, {0x23, 1923, 1, 0, 1}, {0x23, 1924, 1, 0, 1}, {0x23, 1925, 1, 0, 1}, {0x23, 1926, 1, 0, 1},
+        {0x23, 1927, 1, 0, 1}, {0x23, 1928, 1, 0, 1}, {0x23, 1929, 1, 0, 1}, {0x23, 1852, 1, 0, 1}, {0x23, 1930, 1, 0, 1}, {0x23, 1848, 1, 0, 1},
+        {0x23, 1931, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1932, 1, 0, 1}, {0x23, 1898, 1, 0, 1}, {0x23, 1933, 1, 0, 1}, {0x23, 1934, 1, 0, 1},
+        {0x23, 1935, 1, 0, 1}, {0x23, 1936, 1, 0, 2}, {0x23, 1898, 1, 0, 1}, {0x23, 1937, 1, 0, 1}, {0x23, 1795, 1, 0, 1}, {0x23, 1900, 1, 0, 1},
+        {0x23, 1854, 1, 0, 1}, {0x23, 1891, 1, 0, 1}, {0x23, 1898, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1849, 1, 0, 1}, {0x23, 1891, 1, 0, 1},
+        {0x23, 1898, 1, 0, 1}, {0x23, 1891, 1, 0, 1}, {0x23, 1898, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1849, 1, 0, 1}, {0x23, 1899, 1, 0, 1},
+        {0x23, 1898, 1, 0, 1}, {0x23, 1938, 1, 0, 1}, {0x23, 1901, 1, 0, 2}, {0x23, 1891, 1, 0, 1}, {0x23, 1898, 1, 0, 2}, {0x23, 1891, 1, 0, 1},
+        {0x23, 1901, 1, 0, 1}, {0x23, 1891, 1, 0, 1}, {0x23, 1939, 1, 0, 1}, {0x23, 1940, 1, 0, 1}, {0x23, 1941, 1, 0, 1}, {0x23, 1942, 1, 0, 1},
+        {0x23, 1943, 1, 0, 1}, {0x23, 1944, 1, 0, 1}, {0x23, 176, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 107, 1, 0, 1}, {0x23, 82, 1, 0, 1},
+        {0x23, 1945, 1, 0, 1}, {0x23, 1946, 1, 0, 1}, {0x23, 1947, 1, 0, 1}, {0x23, 1948, 1, 0, 1}, {0x20, 1609, 1, 0, 1}, {0x20, 352, 1, 0, 1},
+        {0x20, 154, 1, 0, 25}, {0x23, 1949, 1, 0, 1}, {0x23, 1950, 1, 0, 1}, {0x23, 1951, 1, 0, 1}, {0x23, 1952, 1, 0, 1}, {0x23, 1953, 1, 0, 1},
+        {0x23, 1954, 1, 0, 1}, {0x23, 1955, 1, 0, 1}, {0x23, 1956, 1, 0, 1}, {0x23, 1957, 1, 0, 1}, {0x23, 1853, 1, 0, 1}, {0x23, 1958, 1, 0, 1},
+        {0x23, 1898, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1959, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1959, 1, 0, 1}, {0x23, 1960, 1, 0, 1},
+        {0x23, 1961, 1, 0, 1}, {0x23, 1899, 1, 0, 1}, {0x23, 1849, 1, 0, 1}, {0x23, 1898, 1, 0, 2}, {0x23, 1891, 1, 0, 1}, {0x23, 1901, 1, 0, 2},
+        {0x23, 1891, 1, 0, 1}, {0x23, 1898, 1, 0, 2}, {0x23, 1891, 1, 0, 1}, {0x23, 1901, 1, 0, 2}, {0x23, 1891, 1, 0, 1}, {0x23, 1898, 1, 0, 2},
+        {0x23, 1891, 1, 0, 1}, {0x23, 1901, 1, 0, 2}, {0x23, 1891, 1, 0, 1}, {0x23, 1898, 1, 0, 2}, {0x23, 1891, 1, 0, 1}, {0x23, 1901, 1, 0, 2},
+        {0x23, 1891, 1, 0, 1}, {0x23, 1898, 1, 0, 2}, {0x23, 1891, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1898, 1, 0, 1}, {0x23, 1849, 1, 0, 1},
+        {0x23, 1901, 1, 0, 1}, {0x23, 1962, 1, 0, 1}, {0x23, 1963, 1, 0, 1}, {0x23, 1964, 1, 0, 1}, {0x23, 1965, 1, 0, 1}, {0x23, 1966, 1, 0, 1},
+        {0x23, 197, 1, 0, 1}, {0x23, 132, 1, 0, 1}, {0x23, 109, 1, 0, 1}, {0x23, 1967, 1, 0, 1}, {0x23, 1968, 1, 0, 1}, {0x23, 1969, 1, 0, 1},
+        {0x23, 1970, 1, 0, 1}, {0x20, 154, 1, 0, 1}, {0x20, 397, 1, 0, 1}, {0x20, 154, 1, 0, 25}, {0x23, 1971, 1, 0, 1}, {0x23, 1972, 1, 0, 1},
+        {0x23, 1973, 1, 0, 1}, {0x23, 1974, 1, 0, 1}, {0x23, 1975, 1, 0, 1}, {0x23, 1799, 1, 0, 1}, {0x23, 1976, 1, 0, 1}, {0x23, 1977, 1, 0, 1},
+        {0x23, 1931, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1849, 1, 0, 1}, {0x23, 1898, 1, 0, 1}, {0x23, 1900, 1, 0, 1}, {0x23, 1961, 1, 0, 1},
+        {0x23, 1900, 1, 0, 1}, {0x23, 1978, 1, 0, 1}, {0x23, 1979, 1, 0, 1}, {0x23, 1980, 1, 0, 1}, {0x23, 1981, 1, 0, 1}, {0x23, 1982, 1, 0, 2},
+        {0x23, 1899, 1, 0, 1}, {0x23, 1891, 1, 0, 1}, {0x23, 1901, 1, 0, 2}, {0x23, 1891, 1, 0, 1}, {0x23, 1898, 1, 0, 2}, {0x23, 1891, 1, 0, 1},
+        {0x23, 1983, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1938, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1984, 1, 0, 1}, {0x23, 1891, 1, 0, 1},
+        {0x23, 1901, 1, 0, 2}, {0x23, 1898, 1, 0, 2}, {0x23, 1847, 1, 0, 1}, {0x23, 1854, 1, 0, 1}, {0x23, 1848, 1, 0, 1}, {0x23, 1847, 1, 0, 1},
+        {0x23, 1899, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1931, 1, 0, 1}, {0x23, 1898, 1, 0, 1}, {0x23, 1848, 1, 0, 1}, {0x23, 1847, 1, 0, 1},
+        {0x23, 1849, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1892, 1, 0, 1}, {0x23, 1847, 1, 0, 1}, {0x23, 1985, 1, 0, 1}, {0x23, 1986, 1, 0, 1},
+        {0x23, 1987, 1, 0, 1}, {0x23, 440, 1, 0, 1}, {0x23, 1988, 1, 0, 1}, {0x23, 1989, 1, 0, 1}, {0x23, 1990, 1, 0, 1}, {0x23, 1991, 1, 0, 1},
+        {0x23, 1992, 1, 0, 1}, {0x20, 1993, 1, 0, 1}, {0x20, 154, 1, 0, 27}, {0x23, 1994, 1, 0, 1}, {0x23, 1617, 1, 0, 1}, {0x23, 1995, 1, 0, 1},
+        {0x23, 1996, 1, 0, 1}, {0x23, 1997, 1, 0, 1}, {0x23, 1998, 1, 0, 1}, {0x23, 1981, 1, 0, 1}, {0x23, 1938, 1, 0, 1}, {0x23, 1849, 1, 0, 1},
+        {0x23, 1901, 1, 0, 1}, {0x23, 1849, 1, 0, 1}, {0x23, 1898, 1, 0, 2}, {0x23, 1849, 1, 0, 1}, {0x23, 1999, 1, 0, 1}, {0x23, 2000, 1, 0, 1},
+        {0x23, 2001, 1, 0, 1}, {0x23, 2002, 1, 0, 1}, {0x23, 2003, 1, 0, 1}, {0x23, 1935, 1, 0, 1}, {0x23, 1898, 1, 0, 1}, {0x23, 1854, 1, 0, 1},
+        {0x23, 1899, 1, 0, 1}, {0x23, 1936, 1, 0, 1}, {0x23, 2004, 1, 0, 1}, {0x23, 1891, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 1898, 1, 0, 1},
+        {0x23, 2004, 1, 0, 1}, {0x23, 2005, 1, 0, 1}, {0x23, 1896, 1, 0, 1}, {0x23, 1848, 1, 0, 1}, {0x23, 2006, 1, 0, 1}, {0x23, 2007, 1, 0, 1},
+        {0x23, 2008, 1, 0, 1}, {0x23, 1896, 1, 0, 2}, {0x23, 2009, 1, 0, 1}, {0x23, 2010, 1, 0, 2}, {0x23, 2009, 1, 0, 1}, {0x23, 2004, 1, 0, 1},
+        {0x23, 2005, 1, 0, 1}, {0x23, 2007, 1, 0, 1}, {0x23, 2004, 1, 0, 1}, {0x23, 2010, 1, 0, 1}, {0x23, 2005, 1, 0, 1}, {0x23, 2004, 1, 0, 1},
+        {0x23, 2005, 1, 0, 1}, {0x23, 1849, 1, 0, 1}, {0x23, 1854, 1, 0, 1}, {0x23, 1901, 1, 0, 1}, {0x23, 2011, 1, 0, 1}, {0x23, 2012, 1, 0, 1},
+        {0x23, 2013, 1, 0, 1}, {0x23, 2014, 1, 0, 1}, {0x23, 2015, 1, 0, 1}, {0x23, 2016, 1, 0, 1}, {0x23, 2017, 1, 0, 1}, {0x23, 2018, 1, 0, 1},
+        {0x23, 2019, 1, 0, 1}, {0x23, 2020, 1, 0, 1}, {0x20, 2021, 1, 0, 1}, {0x20, 154, 1, 0, 27},
+    };
+
+    static_assert(std::size(rows) == height + 1 && rows[0] == 0 && rows[height] == std::size(runs));
+    static_assert([] {
+        for (uint32_t y = 0; y < height; ++y) {
+            if (rows[y] > rows[y + 1])
+                return false;
+        }
+        for (const auto& r : runs) {
+            if (r.fg >= std::size(palette) || r.bg >= std::size(palette) || r.length == 0)
+                return false;
+        }
+        return true;
+    }());
+
+} // namespace holofetch::assets::default_avatar_data
+
+namespace holofetch::assets {
+
+    inline compiled_avatar default_avatar() noexcept {
+        using namespace default_avatar_data;
+        return compiled_avatar::embedded(width, height, flags, palette, rows, runs);
+    }
+
+} // namespace holofetch::assets
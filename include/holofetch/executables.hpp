@@ -0,0 +1,60 @@
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace holofetch {
+
+    /*
+     * In-process replacement for WHERE.EXE/which
+     * PATH (and PATHEXT on Windows) are split once, every directory is listed at most once
+     * and the listing is shared by all following lookups
+     * On Windows names compare case-insensitively, elsewhere a match must be executable
+     */
+    class executable_index {
+        struct directory {
+            std::filesystem::path path;
+            std::optional<std::unordered_set<std::string>> entries; // listed on first use
+        };
+
+        std::vector<directory> directories_;
+        std::vector<std::string> extensions_;
+        mutable std::mutex mutex_;
+        size_t scans_{0};
+
+    public:
+        /*
+         * Index of PATH/PATHEXT of the current environment
+         */
+        executable_index();
+        executable_index(std::string_view path, std::string_view pathext);
+        ~executable_index() = default;
+
+        executable_index(const executable_index&) = delete;
+        executable_index& operator=(const executable_index&) = delete;
+
+        /*
+         * Empty path if not found
+         */
+        std::filesystem::path resolve(std::string_view name);
+        std::vector<std::filesystem::path> resolve(std::span<const std::string_view> names);
+
+        size_t directory_scans() const noexcept;
+
+        /*
+         * Process-wide index, built on first use
+         */
+        static executable_index& shared();
+
+    private:
+        std::filesystem::path resolve_locked(std::string_view name);
+        const std::unordered_set<std::string>& entries(directory& dir);
+    };
+
+} // namespace holofetch
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <chrono>
 
+#include "holofetch/probe.hpp"
+#include "holofetch/cache.hpp"
+
 namespace holofetch {
 
     std::string convert_to_utf8(std::wstring_view wstr);
@@ -29,6 +34,7 @@ namespace holofetch {
         uint64_t totalMB{0};
         uint32_t percent{0};
         char id{'C'};
+        std::string path;   // mount point, empty where disks are drive letters
     };
 
     struct swap_info {
@@ -58,6 +64,7 @@ namespace holofetch {
     struct software_info {
         std::string os;
         std::string pwsh;
+        std::string cc;         // C/C++ compiler reported in c, empty when c names it itself
         std::string c;
         std::string py;
         std::string rust;
@@ -76,9 +83,21 @@ namespace holofetch {
         std::chrono::milliseconds uptime{0};
     };
 
+    /*
+     * PATH lookups go through executable_index::shared(), no process is spawned
+     * Empty string if not found
+     */
     std::string find_executable_path(std::string_view command) noexcept;
+    std::vector<std::string> find_executable_paths(std::span<const std::string_view> commands);
     std::string find_env_var(std::string_view name) noexcept;
 
+    /*
+     * One probe per independent collector, each filling its own part of info
+     * Slow-changing facts are taken from cache when possible
+     * info and cache must outlive the probes
+     */
+    std::vector<probe> host_probes(host_info& info, fact_cache& cache);
+
     host_info query_host_info();
 
 } // namespace holofetch
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace holofetch {
+
+    struct extent {
+        size_t width{0};
+        size_t height{0};
+    };
+
+    struct position {
+        size_t x{0};
+        size_t y{0};
+    };
+
+    /*
+     * What a layout is worked out from: sizes only, nothing has to be rendered for it
+     * The header is drawn with different borders next to the avatar and above the sections
+     */
+    struct layout_input {
+        extent console;
+        extent avatar;
+        extent landscape_header;
+        extent portrait_header;
+        std::span<const extent> sections;
+        size_t max_columns{1};
+        bool portrait_only{false};
+    };
+
+    /*
+     * Where the avatar, the header and every section go, nothing for what is not drawn
+     */
+    struct layout {
+        bool portrait{false};
+        size_t columns{1};
+        extent size;
+        std::optional<position> avatar;
+        std::optional<position> header;
+        std::pmr::vector<position> sections;
+
+        explicit layout(std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+            : sections{memory} {}
+    };
+
+    /*
+     * Tries the sections next to the avatar (landscape) and below it (portrait), packed 1 up to
+     * max_columns to a row, and keeps the best candidate: the one that fits the console width,
+     * then its height, landscape over portrait, then the lowest and the one with fewer columns
+     * Landscape only counts when the sections are no taller than the avatar
+     */
+    layout solve_layout(const layout_input& input, std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+
+} // namespace holofetch
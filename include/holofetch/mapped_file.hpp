@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace holofetch {
+
+    /*
+     * Read-only memory mapping of a whole file
+     * Evaluates to false if the file could not be opened, is empty or could not be mapped
+     */
+    class mapped_file {
+        const std::byte* data_{nullptr};
+        size_t size_{0};
+#ifdef _WIN32
+        void* mapping_{nullptr};
+#endif
+    public:
+        mapped_file() = default;
+        explicit mapped_file(const std::filesystem::path& file) noexcept;
+        ~mapped_file();
+
+        mapped_file(mapped_file&& other) noexcept;
+        mapped_file& operator=(mapped_file&& other) noexcept;
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+
+        operator bool() const noexcept { return data_ != nullptr; }
+
+        std::span<const std::byte> bytes() const noexcept { return {data_, size_}; }
+        size_t size() const noexcept { return size_; }
+
+    private:
+        void unmap() noexcept;
+    };
+
+} // namespace holofetch
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace holofetch::metadata {
+
+    /*
+     * Version resource (VS_VERSIONINFO) of a PE image
+     */
+    struct pe_version {
+        uint16_t major{0};
+        uint16_t minor{0};
+        uint16_t build{0};
+        uint16_t revision{0};
+        std::string product_version;    // StringFileInfo "ProductVersion", may be empty
+        std::string file_version;       // StringFileInfo "FileVersion", may be empty
+        std::string_view machine;       // "x64", "x86", "ARM64" or empty
+    };
+
+    /*
+     * Plain byte parsers, they never read outside of image and return nothing on malformed input
+     */
+    std::optional<pe_version> read_pe_version(std::span<const std::byte> image) noexcept;
+    std::optional<std::span<const std::byte>> find_elf_section(std::span<const std::byte> image, std::string_view name) noexcept;
+    std::vector<std::string_view> read_elf_comments(std::span<const std::byte> image);
+
+    /*
+     * Same as above, but memory-map the file first
+     */
+    std::optional<pe_version> read_pe_version(const std::filesystem::path& file) noexcept;
+    std::vector<std::string> read_elf_comments(const std::filesystem::path& file);
+
+} // namespace holofetch::metadata
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <span>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace holofetch::network {
@@ -19,4 +23,23 @@ namespace holofetch::network {
 
     network_info query_network_info();
 
+#ifndef _WIN32
+    /*
+     * Adapters from the answers to an RTM_GETLINK dump followed by an RTM_GETADDR dump,
+     * query_network_info feeds it what the kernel sends
+     * Every message is a whole netlink message, header included; loopback and virtual links
+     * are skipped, and so are the addresses of links that were
+     */
+    class rtnetlink_adapters {
+        network_info info_;
+        std::unordered_map<int, size_t> by_index_;
+
+    public:
+        void add_link(std::span<const std::byte> message);
+        void add_address(std::span<const std::byte> message);
+
+        network_info take() noexcept { return std::move(info_); }
+    };
+#endif
+
 } // namespace holofetch::network
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace holofetch {
+
+    /*
+     * Independent collector (cpu, swap, rustc version, ...)
+     * Each probe writes into its own part of host_info/network_info,
+     * so running them concurrently needs no merge step
+     */
+    struct probe {
+        std::string_view name;
+        std::function<void()> run;
+    };
+
+    struct probe_timing {
+        std::string_view name;
+        std::chrono::microseconds elapsed{0};
+        std::string error;
+    };
+
+    /*
+     * Runs every added probe on a small pool of worker threads
+     * Wall time is set by the slowest probe instead of the sum of all of them
+     * Probes are started in the order they were added, so slow ones should go first
+     */
+    class probe_scheduler {
+        std::vector<probe> probes_;
+        size_t threads_{0};
+    public:
+        explicit probe_scheduler(size_t threads = 0) noexcept : threads_(threads) {}
+        ~probe_scheduler() = default;
+
+        void add(probe p);
+        void add(std::vector<probe>&& ps);
+
+        /*
+         * Blocks until every probe has finished
+         * Exceptions thrown by a probe are reported in its timing and do not stop the others
+         */
+        std::vector<probe_timing> run();
+    };
+
+} // namespace holofetch
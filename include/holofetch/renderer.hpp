@@ -1,39 +1,77 @@
 #pragma once
 
 #include <compare>
+#include <string>
 #include <string_view>
 #include <span>
 #include <map>
+#include <memory_resource>
+#include <optional>
 #include <vector>
 #include <filesystem>
 #include <format>
 
+#include "holofetch/arena.hpp"
+#include "holofetch/avatar.hpp"
+#include "holofetch/canvas.hpp"
+#include "holofetch/console.hpp"
+#include "holofetch/layout.hpp"
+
 namespace holofetch {
 
-    struct console {
-        void* handle{nullptr};
-        uint32_t width{0};
-        uint32_t height{0};
+    /*
+     * Output of one draw, composed in memory and handed to the console at once
+     */
+    class frame {
+        std::string buffer_;
+    public:
+        void put(std::string_view str) {
+            buffer_.append(str);
+        }
 
-        ~console() = default;
-        console();
+        /*
+         * Appends the cells of c with colors downsampled to depth, see canvas::encode
+         */
+        void put(const canvas& c, sgr::color_depth depth = sgr::color_depth::truecolor) {
+            c.encode(buffer_, depth);
+        }
 
-        operator bool() const noexcept { return handle != nullptr; }
+        /*
+         * Appends what turns previous into c on the screen, see canvas::encode_changes
+         */
+        void put(const canvas& c, const canvas& previous, sgr::color_depth depth = sgr::color_depth::truecolor) {
+            c.encode_changes(previous, buffer_, depth);
+        }
 
-        void put(std::string_view str) const;
-        void put(std::wstring_view wstr) const;
+        void reserve(size_t size) {
+            buffer_.reserve(size);
+        }
 
-        template <class... Args>
-        void print(std::string_view fmt, Args&&... args) const {
-            std::string str = std::vformat(fmt, std::make_format_args(std::forward<Args>(args)...));
-            put(str);
+        void clear() noexcept {
+            buffer_.clear();
         }
 
-        template <class... Args>
-        void print(std::wstring_view fmt, Args&&... args) const {
-            std::wstring wstr = std::vformat(fmt, std::make_wformat_args(std::forward<Args>(args)...));
-            put(wstr);
+        size_t size() const noexcept {
+            return buffer_.size();
         }
+
+        /*
+         * Drops what was put after the frame was size bytes long
+         */
+        void truncate(size_t size) noexcept {
+            if (size < buffer_.size())
+                buffer_.resize(size);
+        }
+
+        std::string_view view() const noexcept {
+            return buffer_;
+        }
+
+        /*
+         * Writes the frame to the console and empties it, capacity is kept for the next one
+         * Returns the number of write calls it took
+         */
+        size_t flush(const console& out);
     };
 
     namespace ANSI {
@@ -127,83 +165,199 @@ namespace holofetch {
     };
 
 
-    struct prerender {
-        std::string data;
-        std::vector<std::string_view> lines;
-        uint32_t width{0};
-        uint32_t height{0};
-        
-        /*
-         * Similar to print/println
-         * Centers the image if width is greater than this->width
-         * Returns false if nothing to draw
-         */
-        bool draw(const console& out, std::string_view tab);
-        bool drawln(const console& out, std::string_view tab);
-        bool draw(const console& out, size_t width = 0);
-        bool drawln(const console& out, size_t width = 0);
-        bool filldrawln(std::string_view color, const console& out, size_t width = 0);
-        
-    private:
-        size_t _drawn_lines{0};
-    };
-
     struct image {
         std::string data;
+        std::optional<compiled_avatar> cells;   // drawn instead of data when present
         std::string texture;
         std::string border_left;
         std::string border_right;
         std::string border_top;
         std::string border_bottom;
 
-        prerender render(const palette& p) const;
+        /*
+         * Every line starts in style base, like it was printed right after base was set
+         */
+        canvas render(const palette& p, const sgr::style& base = {}, std::pmr::memory_resource* memory = std::pmr::get_default_resource()) const;
     };
 
+    /*
+     * Allocator-aware so that the properties of the sections in a std::pmr::vector come from
+     * its memory resource too
+     */
     struct section {
+        using allocator_type = std::pmr::polymorphic_allocator<>;
+
         std::string_view header;
-        std::vector<std::pair<std::string, std::string>> properties;
+        std::pmr::vector<std::pair<std::pmr::string, std::pmr::string>> properties;
+
+        explicit section(std::string_view header, const allocator_type& allocator = {})
+            : header{header}, properties{allocator} {}
+
+        section(const section& other, const allocator_type& allocator)
+            : header{other.header}, properties{other.properties, allocator}, lengths_{other.lengths_} {}
+
+        section(section&& other, const allocator_type& allocator)
+            : header{other.header}, properties{std::move(other.properties), allocator}, lengths_{other.lengths_} {}
+
+        section(const section&) = default;
+        section(section&&) noexcept = default;
+        section& operator=(const section&) = default;
+        section& operator=(section&&) = default;
         
+        /*
+         * Widest key and widest value, measured on first use: the properties are not to change
+         * once the section is laid out
+         */
         std::pair<size_t, size_t> max_lengths() const noexcept;
         
-        size_t width() const noexcept {
-            auto [m1, m2] = max_lengths();
-            return m1+m2+2;
-        }
+        /*
+         * Columns of the rendered section, the header included
+         */
+        size_t width() const noexcept;
 
         size_t height() const noexcept {
             return 1 + properties.size();
         }
 
-        prerender render(const palette& p, size_t mkl = 0) const;
+        canvas render(const palette& p, size_t mkl = 0, std::pmr::memory_resource* memory = std::pmr::get_default_resource()) const;
+
+    private:
+        mutable std::optional<std::pair<size_t, size_t>> lengths_;
+    };
+
+    struct frame_stats {
+        size_t columns{0};
+        size_t rows{0};
+        size_t bytes{0};
+        size_t writes{0};
     };
 
     class renderer {
         image avatar_;
         image header_;
         console con_;
+        canvas canvas_;
+        canvas screen_;         // canvas_ cut to the console, for redraw
+        canvas previous_;       // what redraw left on the screen
+        frame frame_;
+        frame_arena arena_;
+        frame_stats stats_;
         palette palette_;
-        bool portrait_mode_{false};
+        canvas avatar_sprite_;
+        canvas landscape_header_sprite_;    // framed, next to the avatar
+        canvas portrait_header_sprite_;     // above the sections
+        // of the last frame, laid out again on resize; in the arena, so gone before it is reset
+        std::optional<std::pmr::vector<canvas>> section_sprites_;
+        std::optional<std::pmr::vector<extent>> section_extents_;
+        bool sprites_ready_{false};
+        bool portrait_mode_{false};         // never lay the sections out next to the avatar
+        bool live_{false};
     public:
         renderer() = default;
-        ~renderer() = default;
+        ~renderer();
 
         void set_palette(palette p) noexcept { 
             palette_ = p; 
+            sprites_ready_ = false;
         }
 
         void set_avatar(image&& img) noexcept;
 
         void set_header(image&& img) noexcept {
             header_ = std::forward<image>(img);
+            sprites_ready_ = false;
         }
 
         void set_portrait_mode(bool enabled) {
             portrait_mode_ = enabled;
         }
 
-        void draw(const std::vector<section>& sections);
+        /*
+         * Lays out for width x height instead of the console size, 0 keeps the detected dimension
+         */
+        void set_console_size(uint32_t width, uint32_t height) noexcept {
+            con_.fix_size(width, height);
+        }
+
+        /*
+         * Overrides the color depth guessed for the console
+         */
+        void set_color_depth(sgr::color_depth depth) noexcept {
+            con_.colors = depth;
+        }
+
+        /*
+         * Memory for the sections of the next frame, its sprites and everything else drawing it
+         * takes come from there too; what the previous frame took is released, so its sections
+         * must be gone by now
+         * Once frames stop growing, drawing them does not touch the heap
+         */
+        std::pmr::memory_resource* begin_frame() {
+            section_sprites_.reset();
+            section_extents_.reset();
+            arena_.reset();
+            return arena_.resource();
+        }
+
+        void draw(std::span<const section> sections);
+
+        /*
+         * Draws sections over the frame drawn by the previous redraw, writing only the cells that
+         * changed; the first one switches to the alternate screen and hides the cursor
+         * A frame goes out as one synchronized update when the terminal takes them
+         */
+        void redraw(std::span<const section> sections);
+
+        /*
+         * Waits until the terminal is resized, console::wake() is called or timeout passes, and
+         * returns whether it was resized; it is watched from the first redraw on
+         */
+        bool wait_resize(std::chrono::milliseconds timeout) noexcept {
+            return con_.wait_resize(timeout);
+        }
+
+        /*
+         * Lays the frame of the last redraw out again for the console size, from the sections
+         * rendered for it, and redraws what moved; nothing is rendered or probed again
+         * Returns false, drawing nothing, if the size did not change or begin_frame() was called
+         * since
+         */
+        bool relayout();
+
+        /*
+         * Gives the terminal back the way redraw found it, nothing if redraw was not called
+         */
+        void end_redraw();
+
+        /*
+         * Cells of the last frame, its size as written and the writes it took to reach the console
+         */
+        const frame_stats& stats() const noexcept {
+            return stats_;
+        }
 
     private:
+        /*
+         * Renders the avatar and both headers unless they are rendered already, they are kept
+         * until one of them or the palette is set again
+         */
+        void prepare_sprites();
+
+        /*
+         * Renders sections and lays them out into out
+         */
+        void compose(canvas& out, std::span<const section> sections);
+
+        /*
+         * Lays out the sprites of the last compose into out for the console size
+         */
+        void arrange(canvas& out);
+
+        /*
+         * Writes what changed between the last redraw and canvas_ cut to the console
+         */
+        void present();
+
         size_t console_left_offset(size_t content_width);
         size_t landscape_mode_top_offset(size_t content_height);
         size_t portrait_mode_left_offset(size_t content_width);
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace holofetch::sgr {
+
+    /*
+     * What the terminal can show: nothing, the 16 basic colors, the 256 color palette or 24 bit RGB
+     */
+    enum class color_depth : uint8_t {
+        none,
+        basic,
+        indexed,
+        truecolor
+    };
+
+    /*
+     * 0 is the terminal's default color, otherwise the top byte tells the kind:
+     * 1 - the code of a 16 color SGR (30-37/90-97 or 40-47/100-107), 2 - 256 color index, 3 - 24 bit RGB
+     */
+    using color = uint32_t;
+
+    enum attribute : uint16_t {
+        bold = 1 << 0,
+        dim = 1 << 1,
+        italic = 1 << 2,
+        underline = 1 << 3,
+        blink = 1 << 4,
+        inverse = 1 << 5,
+        hidden = 1 << 6,
+        strike = 1 << 7,
+    };
+
+    /*
+     * Everything an SGR sequence can change that is modelled here
+     */
+    struct style {
+        color fg{0};
+        color bg{0};
+        uint16_t attributes{0};
+
+        bool operator==(const style&) const noexcept = default;
+    };
+
+    /*
+     * Applies the parameters of one SGR sequence (what is between "ESC[" and "m") to s
+     * Returns false if they hold anything style does not model, s is unspecified then
+     */
+    bool apply(style& s, std::string_view parameters) noexcept;
+
+    /*
+     * Appends the shorter of a delta or a reset plus the full style, nothing if from and to are equal
+     */
+    void append_transition(std::string& out, const style& from, const style& to);
+
+    /*
+     * "none", "16", "256", "truecolor" or "24bit"
+     */
+    std::optional<color_depth> parse_color_depth(std::string_view name) noexcept;
+
+    /*
+     * Writes cells to out with as few SGR sequences as it takes
+     * set() only records the style wanted for the next cell, it reaches out when a cell shows it;
+     * blanks skip what only glyphs show (foreground, bold, italic, ...), what is left is emitted
+     * as the shorter of a delta or a reset plus the full state
+     * Styles are downsampled to depth, color_depth::none emits no SGR at all
+     */
+    class encoder {
+        std::string& out_;
+        color_depth depth_;
+        style current_;
+        style wanted_;
+
+    public:
+        encoder(std::string& out, color_depth depth) noexcept;
+
+        void set(const style& s);
+
+        void blank();
+
+        /*
+         * One glyph, a control character or an escape sequence drawn in the wanted style
+         */
+        void glyph(std::string_view bytes);
+
+        /*
+         * Leaves the terminal in the wanted style
+         */
+        void finish();
+
+    private:
+        void sync(const style& target);
+    };
+
+} // namespace holofetch::sgr
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+namespace holofetch {
+
+    /*
+     * Named memory segment shared between processes of the same user
+     * The creator owns the name and removes it again when destroyed,
+     * other processes open it read-only
+     * Evaluates to false if the segment could not be created or opened
+     */
+    class shared_memory {
+        std::byte* data_{nullptr};
+        size_t size_{0};
+        std::string name_;
+        bool owner_{false};
+#ifdef _WIN32
+        void* mapping_{nullptr};
+#endif
+    public:
+        shared_memory() = default;
+        ~shared_memory();
+
+        shared_memory(shared_memory&& other) noexcept;
+        shared_memory& operator=(shared_memory&& other) noexcept;
+
+        shared_memory(const shared_memory&) = delete;
+        shared_memory& operator=(const shared_memory&) = delete;
+
+        /*
+         * Creates the segment zero filled
+         * On POSIX a stale segment of the same name is replaced, on Windows an existing one means failure
+         */
+        static shared_memory create(std::string name, size_t size) noexcept;
+
+        /*
+         * Opens an existing segment read-only, the size is whatever its creator made it
+         * Segments created by another user are refused
+         */
+        static shared_memory open(std::string name) noexcept;
+
+        operator bool() const noexcept { return data_ != nullptr; }
+
+        std::span<std::byte> bytes() noexcept { return {data_, size_}; }
+        std::span<const std::byte> bytes() const noexcept { return {data_, size_}; }
+        size_t size() const noexcept { return size_; }
+
+    private:
+        void unmap() noexcept;
+    };
+
+} // namespace holofetch
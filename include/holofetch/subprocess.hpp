@@ -6,9 +6,15 @@
 #include <sstream>
 #include <string_view>
 #include <thread>
+#include <chrono>
+#include <stop_token>
 #include <expected>
 #include <stdexcept>
 #include <filesystem>
+#include <functional>
+#include <optional>
+#include <span>
+#include <vector>
 
 namespace holofetch::subprocess {
 
@@ -18,10 +24,64 @@ namespace holofetch::subprocess {
         int code;
     };
 
+    constexpr std::chrono::milliseconds infinite{std::chrono::milliseconds::max()};
+
+    enum class channel {
+        out,
+        err
+    };
+
+    /*
+     * Receives output as it arrives, returning false ends the run right away
+     * A handler that throws ends the run the same way
+     */
+    using output_handler = std::function<bool(channel, std::string_view)>;
+
     /*
      * Passing command by value is intentional
+     * The child (and everything it spawned) is killed when timeout expires or stop is requested,
+     * in which case std::errc::timed_out or std::errc::operation_canceled is returned
      */
-    auto run(std::string_view command, const std::filesystem::path& working_directory = std::filesystem::current_path()) noexcept 
+    auto run(std::string_view command, 
+             std::chrono::milliseconds timeout = infinite, 
+             std::stop_token stop = {}, 
+             const std::filesystem::path& working_directory = std::filesystem::current_path()) noexcept 
         -> std::expected<result, std::errc>;
 
+    /*
+     * Launches every command at once and waits for all of them on a single event loop
+     * (epoll on Linux, an I/O completion port on Windows), so the number of threads
+     * does not grow with the number of children
+     * One result per command, in order; timeout and stop apply to the batch as a whole,
+     * children that finished before either keep their results
+     */
+    auto run_all(std::span<const std::string_view> commands,
+                 std::chrono::milliseconds timeout = infinite,
+                 std::stop_token stop = {},
+                 const std::filesystem::path& working_directory = std::filesystem::current_path())
+        -> std::vector<std::expected<result, std::errc>>;
+
+    /*
+     * Like run, but output goes to on_output instead of being buffered
+     * Once the handler is done the pipes are closed and the child (with everything it spawned) is killed,
+     * so tools that linger after printing what we need do not cost their full runtime
+     * Returns the exit code, or std::nullopt when the handler ended the run first
+     */
+    auto stream(std::string_view command,
+                const output_handler& on_output,
+                std::chrono::milliseconds timeout = infinite,
+                std::stop_token stop = {},
+                const std::filesystem::path& working_directory = std::filesystem::current_path()) noexcept
+        -> std::expected<std::optional<int>, std::errc>;
+
+    /*
+     * First line the command writes to the given channel, without the line break
+     * Whatever was written is returned if the child exits before finishing a line
+     */
+    auto first_line(std::string_view command,
+                    channel from = channel::out,
+                    std::chrono::milliseconds timeout = infinite,
+                    std::stop_token stop = {}) noexcept
+        -> std::expected<std::string, std::errc>;
+
 } // namespace holofetch::subprocess
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace holofetch::unicode {
+
+    /*
+     * Decodes the UTF-8 sequence at the start of text (not empty) and sets length to its size,
+     * broken sequences, overlong forms, surrogates and values past U+10FFFF come out as U+FFFD
+     * one byte at a time
+     */
+    char32_t decode_utf8(std::string_view text, size_t& length) noexcept;
+
+    /*
+     * Columns a terminal gives the code point: 0 for control characters, combining marks and
+     * other zero width characters, 2 for East Asian wide and fullwidth ones, 1 otherwise
+     */
+    int codepoint_width(char32_t cp) noexcept;
+
+    /*
+     * Length of the run of printable ASCII (0x20-0x7E) at the start of text, a vector at a time
+     * where the CPU has them
+     */
+    size_t ascii_run(std::string_view text) noexcept;
+
+} // namespace holofetch::unicode
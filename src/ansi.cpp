@@ -0,0 +1,241 @@
+#include "holofetch/ansi.hpp"
+#include "holofetch/unicode.hpp"
+
+#include <algorithm>
+
+namespace {
+
+    constexpr unsigned char ESC = 0x1B;
+    constexpr unsigned char BEL = 0x07;
+    constexpr unsigned char CAN = 0x18;
+    constexpr unsigned char SUB = 0x1A;
+    constexpr unsigned char DEL = 0x7F;
+
+    constexpr bool printable_ascii(unsigned char c) noexcept {
+        return c >= 0x20 && c < 0x7F;
+    }
+
+    constexpr bool intermediate(unsigned char c) noexcept {
+        return c >= 0x20 && c <= 0x2F;
+    }
+
+    constexpr bool final_byte(unsigned char c) noexcept {
+        return c >= 0x30 && c <= 0x7E;
+    }
+
+    /*
+     * Digits, ':' and ';', the parameters SGR can have; '<' to '?' mark private ones
+     */
+    constexpr bool plain_parameter(unsigned char c) noexcept {
+        return c >= 0x30 && c <= 0x3B;
+    }
+
+} // namespace
+
+namespace holofetch::ansi {
+
+    token parser::next() noexcept {
+        const auto* p = reinterpret_cast<const unsigned char*>(text_.data());
+        const size_t size = text_.size();
+
+        while (position_ < size) {
+            const size_t at = position_;
+            const unsigned char c = p[at];
+
+            if (state_ == state::ground) {
+                if (printable_ascii(c)) {
+                    // avatars color every cell, a vector is wasted on runs of one
+                    size_t n = at + 1 == size || !printable_ascii(p[at + 1]) ? 1 : unicode::ascii_run(text_.substr(at));
+                    position_ += n;
+                    return {token_kind::text, text_.substr(at, n), 0, n};
+                }
+
+                if (c >= 0x80) {
+                    size_t n = 0;
+                    char32_t cp = unicode::decode_utf8(text_.substr(at), n);
+                    position_ += n;
+                    return {token_kind::glyph, text_.substr(at, n), cp, static_cast<size_t>(unicode::codepoint_width(cp))};
+                }
+
+                ++position_;
+                if (c == ESC) {
+                    start_ = at;
+                    state_ = state::escape;
+
+                    // nearly every sequence in ANSI art is CSI, it is entered straight away
+                    if (position_ < size && p[position_] == '[') {
+                        ++position_;
+                        state_ = state::csi;
+                        plain_csi_ = true;
+                    }
+                    continue;
+                }
+                return {c == '\n' ? token_kind::newline : token_kind::control, text_.substr(at, 1)};
+            }
+
+            // inside a sequence
+            ++position_;
+
+            if (c == CAN || c == SUB) {
+                state_ = state::ground;
+                continue;
+            }
+
+            if (c == ESC) {
+                if (state_ == state::string) {
+                    state_ = state::string_escape;
+                } else {
+                    start_ = at;
+                    state_ = state::escape;
+                }
+                continue;
+            }
+
+            if (c < 0x20 && state_ != state::string && state_ != state::string_escape) {
+                plain_csi_ = false;
+                return {c == '\n' ? token_kind::newline : token_kind::control, text_.substr(at, 1)};
+            }
+
+            // not part of any 7-bit sequence, the terminal gives up on it and prints the byte
+            if (c >= 0x80 && state_ != state::string) {
+                state_ = state::ground;
+                position_ = at;
+                continue;
+            }
+
+            switch (state_) {
+            case state::escape:
+                if (c == '[') {
+                    state_ = state::csi;
+                    plain_csi_ = true;
+                } else if (c == ']' || c == 'P' || c == 'X' || c == '^' || c == '_') {
+                    state_ = state::string;
+                    osc_ = c == ']';
+                } else if (intermediate(c)) {
+                    state_ = state::escape_intermediate;
+                } else if (final_byte(c)) {
+                    return complete(token_kind::sequence);
+                }
+                break;
+
+            case state::escape_intermediate:
+                if (final_byte(c))
+                    return complete(token_kind::sequence);
+                break;
+
+            case state::csi:
+                if (c >= 0x40 && c <= 0x7E)
+                    return complete_csi(c);
+
+                if (plain_parameter(c)) {
+                    // colors are most of an avatar, their parameters are skipped in one go
+                    while (position_ < size && plain_parameter(p[position_])) {
+                        ++position_;
+                    }
+                    if (position_ < size && p[position_] >= 0x40 && p[position_] <= 0x7E)
+                        return complete_csi(p[position_++]);
+                } else if (c != DEL) {
+                    plain_csi_ = false;
+                }
+                break;
+
+            case state::string:
+                if (c == BEL && osc_)
+                    return complete(token_kind::sequence);
+
+                // nothing but its terminators matters inside a string
+                position_ = std::min(text_.find_first_of("\x07\x18\x1A\x1B", position_), size);
+                break;
+
+            case state::string_escape:
+                if (c == '\\')
+                    return complete(token_kind::sequence);
+
+                // the string is abandoned and ESC starts another sequence
+                start_ = at - 1;
+                state_ = state::escape;
+                position_ = at;
+                break;
+
+            case state::ground:
+                break;
+            }
+        }
+
+        return {};
+    }
+
+    token parser::complete(token_kind kind) noexcept {
+        state_ = state::ground;
+        return {kind, text_.substr(start_, position_ - start_)};
+    }
+
+    token parser::complete_csi(unsigned char last) noexcept {
+        token t = complete(token_kind::sequence);
+
+        if (last == 'm' && plain_csi_) {
+            if (!styled_) {
+                t.kind = token_kind::sgr;
+                return t;
+            }
+
+            sgr::style next = style_;
+            if (sgr::apply(next, t.bytes.substr(2, t.bytes.size() - 3))) {
+                style_ = next;
+                t.kind = token_kind::sgr;
+            }
+        }
+
+        return t;
+    }
+
+    line_index::line_index(std::string_view text, const sgr::style& initial, std::pmr::memory_resource* memory)
+        : text_{text}, lines_{memory} {
+        // counting newlines is a vectorized byte search, sizing the index once beats growing it
+        lines_.reserve(static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + 1);
+
+        parser p{text, initial};
+        size_t start = 0;
+        size_t width = 0;
+
+        auto end_line = [&](size_t end) {
+            size_t length = end - start;
+            if (length > 0 && text[end - 1] == '\r')
+                --length;
+
+            lines_.push_back({start, length, width, p.style()});
+            width_ = std::max(width_, width);
+        };
+
+        for (token t = p.next(); t.kind != token_kind::end; t = p.next()) {
+            if (t.kind == token_kind::newline) {
+                end_line(p.position() - 1);
+                start = p.position();
+                width = 0;
+            } else {
+                width += t.width;
+            }
+        }
+
+        if (start < text.size())
+            end_line(text.size());
+    }
+
+    size_t width(std::string_view text) noexcept {
+        auto p = parser::unstyled(text);
+        size_t widest = 0;
+        size_t width = 0;
+
+        for (token t = p.next(); t.kind != token_kind::end; t = p.next()) {
+            if (t.kind == token_kind::newline) {
+                widest = std::max(widest, width);
+                width = 0;
+            } else {
+                width += t.width;
+            }
+        }
+
+        return std::max(widest, width);
+    }
+
+} // namespace holofetch::ansi
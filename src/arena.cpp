@@ -0,0 +1,38 @@
+#include "holofetch/arena.hpp"
+
+namespace holofetch {
+
+    void* frame_arena::overflow_resource::do_allocate(size_t bytes, size_t alignment) {
+        allocated_ += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void frame_arena::overflow_resource::do_deallocate(void* p, size_t bytes, size_t alignment) {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool frame_arena::overflow_resource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+    frame_arena::frame_arena(size_t capacity)
+        : buffer_{std::make_unique_for_overwrite<std::byte[]>(capacity)}, capacity_{capacity} {
+        resource_.emplace(buffer_.get(), capacity_, &overflow_);
+    }
+
+    void frame_arena::reset() {
+        const size_t spilled = overflow_.allocated();
+
+        // gives the overflow back to the heap
+        resource_.reset();
+        overflow_.clear();
+
+        if (spilled > 0) {
+            capacity_ += spilled;
+            buffer_ = std::make_unique_for_overwrite<std::byte[]>(capacity_);
+        }
+
+        resource_.emplace(buffer_.get(), capacity_, &overflow_);
+    }
+
+} // namespace holofetch
@@ -0,0 +1,372 @@
+#include "holofetch/avatar.hpp"
+#include "holofetch/ansi.hpp"
+#include "holofetch/cache.hpp"
+#include "holofetch/unicode.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+
+namespace {
+
+    using run = holofetch::compiled_avatar::run;
+
+    constexpr uint32_t byte_order_mark = 0x01020304;
+
+    struct file_header {
+        char magic[8];
+        uint32_t version;
+        uint32_t byte_order;    // byte_order_mark as the compiling machine wrote it
+        uint32_t width;
+        uint32_t height;
+        uint32_t palette_size;
+        uint32_t run_count;
+        uint32_t flags;
+        uint32_t reserved;
+    };
+
+    static_assert(sizeof(file_header) == 40);
+    static_assert(sizeof(run) == 12);
+
+    /*
+     * FNV-1a, only has to tell avatar files apart
+     */
+    uint64_t content_hash(std::span<const std::byte> bytes) noexcept {
+        uint64_t h = 0xcbf29ce484222325ull;
+        for (std::byte b : bytes) {
+            h ^= std::to_integer<uint64_t>(b);
+            h *= 0x100000001b3ull;
+        }
+        return h;
+    }
+
+    std::string to_hex(uint64_t v) {
+        constexpr std::string_view digits{"0123456789abcdef"};
+        std::string s(16, '0');
+        for (size_t i = 16; i-- > 0; v >>= 4) {
+            s[i] = digits[v & 0xF];
+        }
+        return s;
+    }
+
+    template <class T>
+    void append_bytes(std::vector<std::byte>& out, const T* data, size_t count) {
+        auto* p = reinterpret_cast<const std::byte*>(data);
+        out.insert(out.end(), p, p + count * sizeof(T));
+    }
+
+    /*
+     * Writes values as a braced C++ initializer list, per_line of them to a line
+     */
+    template <class T, class Write>
+    void write_array(std::ostream& out, std::span<const T> values, size_t per_line, Write&& write) {
+        for (size_t i = 0; i < values.size(); ++i) {
+            out << (i % per_line == 0 ? "\n        " : " ");
+            write(values[i]);
+            out << ',';
+        }
+        out << "\n    ";
+    }
+
+} // namespace
+
+namespace holofetch {
+
+    std::optional<compiled_avatar> compiled_avatar::compile(std::string_view ans) {
+        std::vector<uint32_t> palette;
+        std::unordered_map<sgr::color, uint16_t> palette_index;
+        std::vector<uint32_t> rows{0};
+        std::vector<run> runs;
+        uint32_t width = 0;
+        uint32_t flags = 0;
+
+        auto index_of = [&](sgr::color c) -> std::optional<uint16_t> {
+            if (auto it = palette_index.find(c); it != palette_index.end())
+                return it->second;
+            if (palette.size() > 0xFFFF)
+                return std::nullopt;
+            auto index = static_cast<uint16_t>(palette.size());
+            palette.push_back(c);
+            palette_index.emplace(c, index);
+            return index;
+        };
+
+        // colors carry over from one line to the next, like they do on the terminal
+        ansi::parser parser{ans};
+        uint32_t length = 0;
+        size_t row_start = 0;
+
+        auto end_row = [&] {
+            rows.push_back(static_cast<uint32_t>(runs.size()));
+            width = std::max(width, length);
+            length = 0;
+        };
+
+        auto add_cell = [&](char32_t cp, int columns) {
+            const sgr::style& current = parser.style();
+            auto fg = index_of(current.fg);
+            auto bg = index_of(current.bg);
+            if (!fg || !bg)
+                return false;
+
+            if (cp == '#')
+                flags |= textured;
+
+            length += columns;
+            if (runs.size() > rows.back()) {
+                auto& last = runs.back();
+                if (last.codepoint == cp && last.fg == *fg && last.bg == *bg && last.attributes == current.attributes && last.length < 0xFFFF) {
+                    ++last.length;
+                    return true;
+                }
+            }
+
+            runs.push_back({cp, *fg, *bg, current.attributes, 1});
+            return true;
+        };
+
+        for (ansi::token t = parser.next(); t.kind != ansi::token_kind::end; t = parser.next()) {
+            switch (t.kind) {
+            case ansi::token_kind::text:
+                for (char c : t.bytes) {
+                    if (!add_cell(static_cast<unsigned char>(c), 1))
+                        return std::nullopt;
+                }
+                break;
+
+            // a cell holds one code point, combining marks have none
+            case ansi::token_kind::glyph:
+                if (t.width > 0 && !add_cell(t.codepoint, static_cast<int>(t.width)))
+                    return std::nullopt;
+                break;
+
+            case ansi::token_kind::newline:
+                end_row();
+                row_start = parser.position();
+                break;
+
+            case ansi::token_kind::sequence:
+                return std::nullopt;
+
+            default:
+                break;
+            }
+        }
+
+        // text after the last newline is a row of its own, same as ansi::line_index has it
+        if (row_start < ans.size())
+            end_row();
+
+        file_header header{};
+        std::memcpy(header.magic, magic.data(), sizeof(header.magic));
+        header.version = format_version;
+        header.byte_order = byte_order_mark;
+        header.width = width;
+        header.height = static_cast<uint32_t>(rows.size() - 1);
+        header.palette_size = static_cast<uint32_t>(palette.size());
+        header.run_count = static_cast<uint32_t>(runs.size());
+        header.flags = flags;
+
+        compiled_avatar avatar;
+        auto& image = avatar.owned_;
+        image.reserve(sizeof(header) + 4 * palette.size() + 4 * rows.size() + sizeof(run) * runs.size());
+        append_bytes(image, &header, 1);
+        append_bytes(image, palette.data(), palette.size());
+        append_bytes(image, rows.data(), rows.size());
+        append_bytes(image, runs.data(), runs.size());
+
+        if (!avatar.attach(image))
+            return std::nullopt;
+        return avatar;
+    }
+
+    std::optional<compiled_avatar> compiled_avatar::load(const std::filesystem::path& file) noexcept {
+        compiled_avatar avatar;
+        avatar.file_ = mapped_file{file};
+        if (!avatar.file_ || !avatar.attach(avatar.file_.bytes()))
+            return std::nullopt;
+        return avatar;
+    }
+
+    std::optional<compiled_avatar> compiled_avatar::load_or_compile(const std::filesystem::path& source, const std::filesystem::path& cache_directory) {
+        mapped_file source_file{source};
+        if (!source_file)
+            return std::nullopt;
+
+        auto bytes = source_file.bytes();
+        std::string_view text{reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+        if (text.starts_with(magic))
+            return load(source);
+
+        std::filesystem::path cached;
+        if (!cache_directory.empty()) {
+            cached = cache_directory / (to_hex(content_hash(bytes)) + std::string{extension});
+            if (auto avatar = load(cached))
+                return avatar;
+        }
+
+        auto avatar = compile(text);
+
+        // if it cannot be stored it is compiled again next time, nothing worse
+        if (avatar && !cached.empty())
+            avatar->save(cached);
+
+        return avatar;
+    }
+
+    std::filesystem::path compiled_avatar::default_cache_directory() {
+        return fact_cache::default_path().parent_path() / "avatars";
+    }
+
+    bool compiled_avatar::save(const std::filesystem::path& file) const {
+        auto image = bytes();
+        if (image.empty())
+            return false;
+
+        return write_replacing(file, {reinterpret_cast<const char*>(image.data()), image.size()});
+    }
+
+    bool compiled_avatar::save_header(const std::filesystem::path& file, std::string_view name, std::string_view generator) const {
+        if (rows_.empty())
+            return false;
+
+        std::ostringstream out;
+        out << std::setfill('0');
+
+        out << "#pragma once\n\n"
+            << "/*\n"
+            << " * Generated by " << generator << "\n"
+            << " * Do not edit, compile the avatar again instead\n"
+            << " */\n\n"
+            << "#include <cstdint>\n"
+            << "#include <iterator>\n\n"
+            << "#include \"holofetch/avatar.hpp\"\n\n"
+            << "namespace holofetch::assets::" << name << "_data {\n\n"
+            << "    inline constexpr uint32_t width{" << width_ << "};\n"
+            << "    inline constexpr uint32_t height{" << height_ << "};\n"
+            << "    inline constexpr uint32_t flags{" << flags_ << "};\n\n";
+
+        out << "    inline constexpr uint32_t palette[] = {";
+        write_array(out, palette_, 8, [&](uint32_t c) { out << "0x" << std::hex << std::setw(8) << c << std::dec; });
+        out << "};\n\n";
+
+        out << "    inline constexpr uint32_t rows[] = {";
+        write_array(out, rows_, 12, [&](uint32_t r) { out << r; });
+        out << "};\n\n";
+
+        out << "    inline constexpr compiled_avatar::run runs[] = {";
+        write_array(out, runs_, 6, [&](const run& r) {
+            out << "{0x" << std::hex << r.codepoint << std::dec << ", " << r.fg << ", " << r.bg << ", " << r.attributes << ", " << r.length << '}';
+        });
+        out << "};\n\n";
+
+        // what attach() checks at run time, except that row lengths fit the width
+        out << "    static_assert(std::size(rows) == height + 1 && rows[0] == 0 && rows[height] == std::size(runs));\n"
+            << "    static_assert([] {\n"
+            << "        for (uint32_t y = 0; y < height; ++y) {\n"
+            << "            if (rows[y] > rows[y + 1])\n"
+            << "                return false;\n"
+            << "        }\n"
+            << "        for (const auto& r : runs) {\n"
+            << "            if (r.fg >= std::size(palette) || r.bg >= std::size(palette) || r.length == 0)\n"
+            << "                return false;\n"
+            << "        }\n"
+            << "        return true;\n"
+            << "    }());\n\n"
+            << "} // namespace holofetch::assets::" << name << "_data\n\n"
+            << "namespace holofetch::assets {\n\n"
+            << "    inline compiled_avatar " << name << "() noexcept {\n"
+            << "        using namespace " << name << "_data;\n"
+            << "        return compiled_avatar::embedded(width, height, flags, palette, rows, runs);\n"
+            << "    }\n\n"
+            << "} // namespace holofetch::assets\n";
+
+        return write_replacing(file, out.str());
+    }
+
+    compiled_avatar compiled_avatar::embedded(uint32_t width, uint32_t height, uint32_t flags, std::span<const uint32_t> palette, std::span<const uint32_t> rows, std::span<const run> runs) noexcept {
+        compiled_avatar avatar;
+        avatar.width_ = width;
+        avatar.height_ = height;
+        avatar.flags_ = flags;
+        avatar.palette_ = palette;
+        avatar.rows_ = rows;
+        avatar.runs_ = runs;
+        return avatar;
+    }
+
+    size_t compiled_avatar::row_length(size_t y) const noexcept {
+        size_t length = 0;
+        for (const auto& r : row(y)) {
+            length += r.length * static_cast<size_t>(unicode::codepoint_width(r.codepoint));
+        }
+        return length;
+    }
+
+    std::span<const std::byte> compiled_avatar::bytes() const noexcept {
+        if (file_)
+            return file_.bytes();
+        return owned_;
+    }
+
+    /*
+     * Validates image and points the spans into it, every index is checked here so that
+     * drawing never has to
+     */
+    bool compiled_avatar::attach(std::span<const std::byte> image) noexcept {
+        if (image.size() < sizeof(file_header))
+            return false;
+
+        file_header header;
+        std::memcpy(&header, image.data(), sizeof(header));
+
+        if (std::string_view{header.magic, sizeof(header.magic)} != magic
+            || header.version != format_version
+            || header.byte_order != byte_order_mark)
+            return false;
+
+        const uint64_t palette_offset = sizeof(file_header);
+        const uint64_t rows_offset = palette_offset + 4ull * header.palette_size;
+        const uint64_t runs_offset = rows_offset + 4ull * (uint64_t{header.height} + 1);
+        const uint64_t end = runs_offset + uint64_t{sizeof(run)} * header.run_count;
+        if (end != image.size())
+            return false;
+
+        // the image is either mapped or heap allocated, both are aligned well enough
+        auto* base = image.data();
+        std::span<const uint32_t> palette{reinterpret_cast<const uint32_t*>(base + palette_offset), header.palette_size};
+        std::span<const uint32_t> rows{reinterpret_cast<const uint32_t*>(base + rows_offset), header.height + size_t{1}};
+        std::span<const run> runs{reinterpret_cast<const run*>(base + runs_offset), header.run_count};
+
+        if (rows.front() != 0 || rows.back() != header.run_count)
+            return false;
+
+        for (size_t y = 0; y < header.height; ++y) {
+            // rows.back() is run_count, but a row before it may point past it
+            if (rows[y] > rows[y + 1] || rows[y + 1] > header.run_count)
+                return false;
+
+            uint64_t length = 0;
+            for (size_t i = rows[y]; i < rows[y + 1]; ++i) {
+                const auto& r = runs[i];
+                if (r.fg >= palette.size() || r.bg >= palette.size() || r.length == 0)
+                    return false;
+                length += uint64_t{r.length} * static_cast<uint64_t>(unicode::codepoint_width(r.codepoint));
+            }
+            if (length > header.width)
+                return false;
+        }
+
+        width_ = header.width;
+        height_ = header.height;
+        flags_ = header.flags;
+        palette_ = palette;
+        rows_ = rows;
+        runs_ = runs;
+        return true;
+    }
+
+} // namespace holofetch
@@ -0,0 +1,324 @@
+#include "holofetch/cache.hpp"
+#include "holofetch/info.hpp"
+
+#include <fstream>
+#include <charconv>
+#include <random>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+    int64_t now_seconds() noexcept {
+        return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    /*
+     * Entries are stored one per line as name\texpires\tkey\tvalue,
+     * so tabs, newlines and backslashes inside fields are escaped
+     */
+    void append_escaped(std::string& out, std::string_view field) {
+        for (char c : field) {
+            switch (c) {
+                case '\\': out += "\\\\"; break;
+                case '\t': out += "\\t"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                default: out += c; break;
+            }
+        }
+    }
+
+    std::string unescape(std::string_view field) {
+        std::string out;
+        out.reserve(field.size());
+        for (size_t i = 0; i < field.size(); ++i) {
+            if (field[i] != '\\' || i + 1 == field.size()) {
+                out += field[i];
+                continue;
+            }
+            switch (field[++i]) {
+                case 't': out += '\t'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                default: out += field[i]; break;
+            }
+        }
+        return out;
+    }
+
+    /*
+     * Next to file so the rename stays on one filesystem, named by pid and a random suffix
+     * so concurrent writers never share or truncate each other's temp file
+     */
+    std::filesystem::path temp_beside(const std::filesystem::path& file) {
+#ifdef _WIN32
+        const auto pid = ::_getpid();
+#else
+        const auto pid = ::getpid();
+#endif
+        std::random_device random;
+        const uint64_t suffix = (uint64_t{random()} << 32) | random();
+
+        auto temp = file;
+        temp += "." + std::to_string(pid) + "." + std::to_string(suffix) + ".tmp";
+        return temp;
+    }
+
+    /*
+     * First line of a command's output, without the line break
+     */
+    std::string_view first_line(std::string_view output) noexcept {
+        output = output.substr(0, output.find('\n'));
+        if (output.ends_with('\r'))
+            output.remove_suffix(1);
+        return output;
+    }
+
+    std::string_view next_field(std::string_view& line) noexcept {
+        auto pos = line.find('\t');
+        auto field = line.substr(0, pos);
+        line = pos == std::string_view::npos ? std::string_view{} : line.substr(pos + 1);
+        return field;
+    }
+
+} // namespace
+
+namespace holofetch {
+
+    fact_cache::fact_cache(std::filesystem::path file, cache_mode mode)
+        : file_(std::move(file))
+        , mode_(mode)
+    {
+        if (mode_ == cache_mode::enabled) {
+            load();
+        }
+    }
+
+    void fact_cache::load() {
+        std::ifstream in(file_, std::ios::binary);
+        if (!in)
+            return;
+
+        std::string line;
+        if (!std::getline(in, line) || line != format_version)
+            return; // unknown or older format, start from scratch
+
+        while (std::getline(in, line)) {
+            std::string_view rest{line};
+
+            auto name = next_field(rest);
+            auto expires = next_field(rest);
+            auto key = next_field(rest);
+            auto value = rest;
+
+            entry e;
+            if (name.empty() || std::from_chars(expires.data(), expires.data() + expires.size(), e.expires).ec != std::errc{})
+                continue;
+
+            e.key = unescape(key);
+            e.value = unescape(value);
+            entries_.insert_or_assign(unescape(name), std::move(e));
+        }
+    }
+
+    std::optional<std::string> fact_cache::get(std::string_view name, std::string_view key) {
+        if (mode_ != cache_mode::enabled) {
+            ++misses_;
+            return std::nullopt;
+        }
+
+        std::lock_guard lock(mutex_);
+
+        auto it = entries_.find(std::string{name});
+        if (it == entries_.end() || it->second.key != key || it->second.expires <= now_seconds()) {
+            ++misses_;
+            return std::nullopt;
+        }
+
+        ++hits_;
+        return it->second.value;
+    }
+
+    void fact_cache::put(std::string_view name, std::string value, std::chrono::seconds ttl, std::string_view key) {
+        if (mode_ == cache_mode::disabled)
+            return;
+
+        std::lock_guard lock(mutex_);
+
+        entries_.insert_or_assign(std::string{name}, entry{
+            .value = std::move(value),
+            .key = std::string{key},
+            .expires = now_seconds() + ttl.count()
+        });
+        dirty_ = true;
+    }
+
+    bool fact_cache::save() {
+        if (mode_ == cache_mode::disabled)
+            return true;
+
+        std::lock_guard lock(mutex_);
+        if (!dirty_)
+            return true;
+
+        std::string content{format_version};
+        content += '\n';
+
+        const auto now = now_seconds();
+        for (const auto& [name, e] : entries_) {
+            if (e.expires <= now)
+                continue;
+
+            append_escaped(content, name);
+            content += '\t';
+            content += std::to_string(e.expires);
+            content += '\t';
+            append_escaped(content, e.key);
+            content += '\t';
+            append_escaped(content, e.value);
+            content += '\n';
+        }
+
+        if (!write_replacing(file_, content))
+            return false;
+
+        dirty_ = false;
+        return true;
+    }
+
+    bool write_replacing(const std::filesystem::path& file, std::string_view content) {
+        std::error_code ec;
+        if (file.has_parent_path())
+            std::filesystem::create_directories(file.parent_path(), ec);
+
+        std::filesystem::path temp;
+        try {
+            temp = temp_beside(file);
+        } catch (...) {
+            return false;
+        }
+
+        {
+            std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+            if (!out || !out.write(content.data(), static_cast<std::streamsize>(content.size()))) {
+                out.close();
+                std::filesystem::remove(temp, ec);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temp, file, ec);
+        if (ec) {
+            std::filesystem::remove(temp, ec);
+            return false;
+        }
+        return true;
+    }
+
+    std::vector<std::string> cached_tool_versions(fact_cache& cache, std::span<const tool_version_query> tools, std::chrono::seconds ttl, std::chrono::milliseconds timeout) {
+        std::vector<std::string> versions(tools.size());
+        std::vector<std::filesystem::path> binaries(tools.size());
+        std::vector<std::string> keys(tools.size());
+
+        auto store = [&](size_t i) {
+            if (!versions[i].empty() || keys[i] == "missing")
+                cache.put("version." + std::string{tools[i].tool}, versions[i], ttl, keys[i]);
+        };
+
+        // the tools whose commands still have to run, and those commands
+        std::vector<size_t> asked;
+        std::vector<std::string> commands;
+
+        for (size_t i = 0; i < tools.size(); ++i) {
+            const auto& t = tools[i];
+
+            binaries[i] = executable_index::shared().resolve(t.tool);
+            if (!binaries[i].empty() && t.resolve)
+                binaries[i] = t.resolve(binaries[i]);
+
+            keys[i] = file_fingerprint(binaries[i]);
+            if (keys[i].empty())
+                keys[i] = "missing";
+
+            if (auto cached = cache.get("version." + std::string{t.tool}, keys[i]); cached) {
+                versions[i] = std::move(*cached);
+                continue;
+            }
+
+            if (!binaries[i].empty() && t.read)
+                versions[i] = t.read(binaries[i]);
+
+            if (versions[i].empty() && !binaries[i].empty() && t.command && t.parse) {
+                if (auto command = t.command(binaries[i]); !command.empty()) {
+                    asked.push_back(i);
+                    commands.push_back(std::move(command));
+                    continue;
+                }
+            }
+
+            store(i);
+        }
+
+        if (commands.empty())
+            return versions;
+
+        const std::vector<std::string_view> views(commands.begin(), commands.end());
+        auto results = subprocess::run_all(views, timeout);
+
+        for (size_t j = 0; j < asked.size(); ++j) {
+            const size_t i = asked[j];
+            std::string_view line;
+            if (results[j].has_value())
+                line = first_line(tools[i].channel == subprocess::channel::out ? results[j]->out : results[j]->err);
+
+            versions[i] = tools[i].parse(binaries[i], line);
+            store(i);
+        }
+
+        return versions;
+    }
+
+    std::filesystem::path fact_cache::default_path() {
+        std::filesystem::path dir;
+#ifdef _WIN32
+        dir = find_env_var("LOCALAPPDATA");
+#else
+        dir = find_env_var("XDG_CACHE_HOME");
+        if (dir.empty()) {
+            if (auto home = find_env_var("HOME"); !home.empty()) {
+                dir = std::filesystem::path{home} / ".cache";
+            }
+        }
+#endif
+        if (dir.empty()) {
+            dir = std::filesystem::temp_directory_path();
+        }
+        return dir / "holofetch" / "facts.cache";
+    }
+
+    std::string file_fingerprint(const std::filesystem::path& path) noexcept {
+        std::error_code ec;
+        if (path.empty())
+            return {};
+
+        auto size = std::filesystem::file_size(path, ec);
+        if (ec)
+            return {};
+
+        auto mtime = std::filesystem::last_write_time(path, ec);
+        if (ec)
+            return {};
+
+        try {
+            return path.string() + "|" + std::to_string(mtime.time_since_epoch().count()) + "|" + std::to_string(size);
+        } catch (...) {
+            return {};
+        }
+    }
+
+} // namespace holofetch
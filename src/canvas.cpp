@@ -0,0 +1,250 @@
+#include "holofetch/canvas.hpp"
+#include "holofetch/ansi.hpp"
+
+#include <algorithm>
+
+namespace {
+
+    size_t encode_utf8(char32_t c, char* out) noexcept {
+        if (c < 0x80) {
+            out[0] = static_cast<char>(c);
+            return 1;
+        }
+        if (c < 0x800) {
+            out[0] = static_cast<char>(0xC0 | (c >> 6));
+            out[1] = static_cast<char>(0x80 | (c & 0x3F));
+            return 2;
+        }
+        if (c < 0x10000) {
+            out[0] = static_cast<char>(0xE0 | (c >> 12));
+            out[1] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            out[2] = static_cast<char>(0x80 | (c & 0x3F));
+            return 3;
+        }
+        if (c < 0x110000) {
+            out[0] = static_cast<char>(0xF0 | (c >> 18));
+            out[1] = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+            out[2] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            out[3] = static_cast<char>(0x80 | (c & 0x3F));
+            return 4;
+        }
+        out[0] = '\xEF';
+        out[1] = '\xBF';
+        out[2] = '\xBD';
+        return 3;
+    }
+
+} // namespace
+
+namespace holofetch {
+
+    void canvas::resize(size_t width, size_t height) {
+        width_ = width;
+        height_ = height;
+
+        const size_t cells = width * height;
+        codepoints_.assign(cells, 0);
+        fg_.assign(cells, 0);
+        bg_.assign(cells, 0);
+        attributes_.assign(cells, 0);
+    }
+
+    void canvas::reserve(size_t width, size_t height) {
+        const size_t cells = width * height;
+        codepoints_.reserve(cells);
+        fg_.reserve(cells);
+        bg_.reserve(cells);
+        attributes_.reserve(cells);
+    }
+
+    void canvas::clear() noexcept {
+        std::fill(codepoints_.begin(), codepoints_.end(), 0);
+        std::fill(fg_.begin(), fg_.end(), 0);
+        std::fill(bg_.begin(), bg_.end(), 0);
+        std::fill(attributes_.begin(), attributes_.end(), 0);
+    }
+
+    void canvas::set(size_t x, size_t y, char32_t codepoint, const sgr::style& s) noexcept {
+        if (x >= width_ || y >= height_)
+            return;
+
+        size_t i = y * width_ + x;
+        codepoints_[i] = codepoint;
+        fg_[i] = s.fg;
+        bg_[i] = s.bg;
+        attributes_[i] = s.attributes;
+    }
+
+    size_t canvas::print(size_t x, size_t y, std::string_view text, sgr::style& current) {
+        size_t column = x;
+        ansi::parser parser{text, current};
+
+        for (ansi::token t = parser.next(); t.kind != ansi::token_kind::end; t = parser.next()) {
+            switch (t.kind) {
+            case ansi::token_kind::text:
+                for (char c : t.bytes) {
+                    set(column++, y, static_cast<unsigned char>(c), parser.style());
+                }
+                break;
+
+            // combining marks a cell has no room for are dropped
+            case ansi::token_kind::glyph:
+                if (t.width == 0)
+                    break;
+                set(column++, y, t.codepoint, parser.style());
+                if (t.width == 2) {
+                    set(column++, y, wide_tail, parser.style());
+                }
+                break;
+
+            case ansi::token_kind::newline:
+                column = x;
+                ++y;
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        current = parser.style();
+        return column;
+    }
+
+    size_t canvas::columns(std::string_view text) noexcept {
+        return ansi::width(text);
+    }
+
+    void canvas::blit(const canvas& source, size_t x, size_t y) noexcept {
+        if (x >= width_ || y >= height_)
+            return;
+
+        const size_t columns = std::min(source.width_, width_ - x);
+        const size_t rows = std::min(source.height_, height_ - y);
+
+        for (size_t sy = 0; sy < rows; ++sy) {
+            const size_t from = sy * source.width_;
+            const size_t to = (y + sy) * width_ + x;
+
+            for (size_t sx = 0; sx < columns; ++sx) {
+                if (char32_t cp = source.codepoints_[from + sx]; cp != 0) {
+                    codepoints_[to + sx] = cp;
+                    fg_[to + sx] = source.fg_[from + sx];
+                    bg_[to + sx] = source.bg_[from + sx];
+                    attributes_[to + sx] = source.attributes_[from + sx];
+                }
+            }
+
+            // a wide glyph cut in half by the right edge would wrap
+            if (columns > 0 && columns < source.width_ && source.codepoints_[from + columns] == wide_tail) {
+                codepoints_[to + columns - 1] = ' ';
+            }
+        }
+    }
+
+    void canvas::encode(std::string& out, sgr::color_depth depth) const {
+        sgr::encoder e{out, depth};
+
+        for (size_t y = 0; y < height_; ++y) {
+            const size_t row = y * width_;
+
+            // blanks that show nothing but the default background need not be written
+            size_t end = width_;
+            while (end > 0 && blank_at(row + end - 1)) {
+                --end;
+            }
+
+            for (size_t x = 0; x < end; ++x) {
+                encode_cell(e, row + x);
+            }
+
+            e.set({});
+            e.glyph("\n");
+        }
+
+        e.finish();
+    }
+
+    void canvas::encode_changes(const canvas& previous, std::string& out, sgr::color_depth depth) const {
+        // a cursor move takes at least "ESC[y;xH", rewriting fewer cells than that is cheaper
+        constexpr size_t max_rewrite = 5;
+        constexpr size_t unknown = static_cast<size_t>(-1);
+
+        sgr::encoder e{out, depth};
+        size_t cursor_x = unknown;
+        size_t cursor_y = unknown;
+
+        for (size_t y = 0; y < height_; ++y) {
+            const size_t row = y * width_;
+
+            for (size_t x = 0; x < width_; ++x) {
+                if (same_at(previous, row + x))
+                    continue;
+
+                // the right half of a wide glyph is written by its left one
+                size_t start = x > 0 && codepoints_[row + x] == wide_tail ? x - 1 : x;
+
+                if (cursor_y == y && cursor_x <= start && start - cursor_x <= max_rewrite) {
+                    for (; cursor_x < start; ++cursor_x) {
+                        encode_cell(e, row + cursor_x);
+                    }
+                } else {
+                    out += "\033[";
+                    out += std::to_string(y + 1);
+                    out += ';';
+                    out += std::to_string(start + 1);
+                    out += 'H';
+                }
+
+                for (size_t i = start; i <= x; ++i) {
+                    encode_cell(e, row + i);
+                }
+                cursor_x = x + 1;
+                cursor_y = y;
+            }
+        }
+
+        e.set({});
+        e.finish();
+    }
+
+    /*
+     * Shows nothing but the default background
+     */
+    bool canvas::blank_at(size_t i) const noexcept {
+        using enum sgr::attribute;
+        return codepoints_[i] == 0
+            || (codepoints_[i] == ' ' && bg_[i] == 0 && !(attributes_[i] & (underline | inverse | strike)));
+    }
+
+    bool canvas::same_at(const canvas& other, size_t i) const noexcept {
+        if (blank_at(i))
+            return other.blank_at(i);
+        return codepoints_[i] == other.codepoints_[i]
+            && fg_[i] == other.fg_[i]
+            && bg_[i] == other.bg_[i]
+            && attributes_[i] == other.attributes_[i];
+    }
+
+    void canvas::encode_cell(sgr::encoder& e, size_t i) const {
+        const char32_t cp = codepoints_[i];
+
+        if (cp == wide_tail)
+            return;
+
+        if (cp == 0) {
+            e.set({});
+            e.blank();
+            return;
+        }
+
+        e.set({fg_[i], bg_[i], attributes_[i]});
+        if (cp == ' ') {
+            e.blank();
+        } else {
+            char bytes[4];
+            e.glyph({bytes, encode_utf8(cp, bytes)});
+        }
+    }
+
+} // namespace holofetch
@@ -0,0 +1,210 @@
+#include "holofetch/console.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iterator>
+
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+
+namespace {
+
+    uint32_t env_size(const char* name) noexcept {
+        const char* v = getenv(name);
+        if (!v)
+            return 0;
+        long n = strtol(v, nullptr, 10);
+        return n > 0 ? static_cast<uint32_t>(n) : 0;
+    }
+
+    // set by console::wake, which runs on the thread the CRT delivers SIGINT on
+    const HANDLE wake_event = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+
+} // namespace
+
+namespace holofetch {
+
+    console::console() {
+        _setmode(_fileno(stdout), _O_U8TEXT);
+
+        handle = GetStdHandle(STD_OUTPUT_HANDLE);
+        if (handle == INVALID_HANDLE_VALUE)
+            handle = nullptr;
+
+        // redirected to a file or a pipe, there is no console buffer to ask
+        DWORD mode = 0;
+        tty = handle && GetConsoleMode(handle, &mode);
+
+        // conhost has taken 24 bit colors since Windows 10 1703, Windows Terminal always did
+        colors = tty && !getenv("NO_COLOR") ? sgr::color_depth::truecolor : sgr::color_depth::none;
+
+        update_size();
+    }
+
+    void console::fix_size(uint32_t fixed_width, uint32_t fixed_height) noexcept {
+        fixed_width_ = fixed_width;
+        fixed_height_ = fixed_height;
+        update_size();
+    }
+
+    bool console::update_size() noexcept {
+        uint32_t w = 0;
+        uint32_t h = 0;
+
+        if (CONSOLE_SCREEN_BUFFER_INFO csbi; tty && GetConsoleScreenBufferInfo(handle, &csbi)) {
+            w = csbi.srWindow.Right - csbi.srWindow.Left + 1;
+            h = csbi.srWindow.Bottom - csbi.srWindow.Top + 1;
+        }
+
+        if (w == 0)
+            w = env_size("COLUMNS");
+        if (h == 0)
+            h = env_size("LINES");
+
+        if (fixed_width_)
+            w = fixed_width_;
+        if (fixed_height_)
+            h = fixed_height_;
+
+        if (w == 0)
+            w = 80;
+        if (h == 0)
+            h = 24;
+
+        bool changed = w != width || h != height;
+        width = w;
+        height = h;
+        return changed;
+    }
+
+    void console::watch_resize() noexcept {
+        if (!tty || input_)
+            return;
+
+        HANDLE in = GetStdHandle(STD_INPUT_HANDLE);
+        DWORD mode = 0;
+        if (in == INVALID_HANDLE_VALUE || !in || !GetConsoleMode(in, &mode))
+            return;
+
+        // conhost only queues WINDOW_BUFFER_SIZE_EVENT records with window input enabled
+        if (SetConsoleMode(in, mode | ENABLE_WINDOW_INPUT))
+            input_ = in;
+    }
+
+    bool console::resized() noexcept {
+        if (!input_)
+            return false;
+
+        // the records are drained without blocking, nothing else reads the console input while
+        // holofetch is watching
+        bool changed = false;
+        INPUT_RECORD records[16];
+        DWORD count = 0;
+        while (GetNumberOfConsoleInputEvents(input_, &count) && count > 0) {
+            if (!ReadConsoleInputW(input_, records, static_cast<DWORD>(std::size(records)), &count))
+                break;
+            for (DWORD i = 0; i < count; ++i) {
+                changed = changed || records[i].EventType == WINDOW_BUFFER_SIZE_EVENT;
+            }
+        }
+        return changed;
+    }
+
+    bool console::wait_resize(std::chrono::milliseconds timeout) noexcept {
+        const auto until = std::chrono::steady_clock::now() + timeout;
+
+        HANDLE handles[2];
+        DWORD count = 0;
+        if (wake_event)
+            handles[count++] = wake_event;
+        if (input_)
+            handles[count++] = input_;
+
+        for (;;) {
+            auto left = std::chrono::ceil<std::chrono::milliseconds>(until - std::chrono::steady_clock::now());
+            if (left < std::chrono::milliseconds::zero())
+                left = std::chrono::milliseconds::zero();
+
+            if (count == 0) {
+                Sleep(static_cast<DWORD>(left.count()));
+                return false;
+            }
+
+            // woken, timed out or failed
+            const DWORD signaled = WaitForMultipleObjects(count, handles, FALSE, static_cast<DWORD>(left.count()));
+            if (!input_ || signaled != WAIT_OBJECT_0 + count - 1)
+                return resized();
+
+            // key and mouse records signal the input as well, they are drained and waited past
+            if (resized())
+                return true;
+            if (left.count() == 0)
+                return false;
+        }
+    }
+
+    void console::wake() noexcept {
+        if (wake_event)
+            SetEvent(wake_event);
+    }
+
+    bool console::detect_synchronized_output() noexcept {
+        // conhost does not know mode 2026 and asking Windows Terminal needs VT input on stdin,
+        // frames go out in as few WriteConsole calls as conhost takes instead
+        synchronized_output = false;
+        return false;
+    }
+
+    void console::put(std::string_view str) const {
+        write(str);
+    }
+
+    void console::put(std::wstring_view wstr) const {
+        if (wstr.empty() || !handle)
+            return;
+
+        if (tty) {
+            DWORD dummy = 0;
+            WriteConsoleW(handle, (const void*)wstr.data(), (DWORD)wstr.size(), &dummy, NULL);
+            return;
+        }
+
+        int size = WideCharToMultiByte(CP_UTF8, 0, wstr.data(), (int)wstr.size(), nullptr, 0, nullptr, nullptr);
+        if (size <= 0)
+            return;
+        std::string str(size, '\0');
+        WideCharToMultiByte(CP_UTF8, 0, wstr.data(), (int)wstr.size(), str.data(), size, nullptr, nullptr);
+        write(str);
+    }
+
+    size_t console::write(std::string_view str) const {
+        if (!handle)
+            return 0;
+
+        // conhost refuses single writes past its 64 KiB shared heap, stay well below it
+        constexpr size_t max_chunk = 32 * 1024;
+
+        size_t writes = 0;
+        while (!str.empty()) {
+            size_t chunk = str.size();
+            if (chunk > max_chunk) {
+                chunk = max_chunk;
+                // do not cut a UTF-8 sequence in half
+                while (chunk > 0 && (static_cast<unsigned char>(str[chunk]) & 0xC0) == 0x80)
+                    --chunk;
+            }
+
+            DWORD written = 0;
+            ++writes;
+            BOOL ok = tty
+                ? WriteConsoleA(handle, (const void*)str.data(), (DWORD)chunk, &written, NULL)
+                : WriteFile(handle, str.data(), (DWORD)chunk, &written, NULL);
+            if (!ok || written == 0)
+                break;
+            str.remove_prefix(written);
+        }
+        return writes;
+    }
+
+} // namespace holofetch
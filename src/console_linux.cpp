@@ -0,0 +1,279 @@
+#include "holofetch/console.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace {
+
+    uint32_t env_size(const char* name) noexcept {
+        const char* v = getenv(name);
+        if (!v)
+            return 0;
+        long n = strtol(v, nullptr, 10);
+        return n > 0 ? static_cast<uint32_t>(n) : 0;
+    }
+
+    holofetch::sgr::color_depth detect_color_depth(bool tty) noexcept {
+        using holofetch::sgr::color_depth;
+
+        if (!tty || getenv("NO_COLOR"))
+            return color_depth::none;
+
+        if (const char* colorterm = getenv("COLORTERM")) {
+            std::string_view v{colorterm};
+            if (v == "truecolor" || v == "24bit")
+                return color_depth::truecolor;
+        }
+
+        const char* term = getenv("TERM");
+        if (!term)
+            return color_depth::basic;
+
+        std::string_view v{term};
+        if (v == "dumb")
+            return color_depth::none;
+        if (v.ends_with("-direct"))
+            return color_depth::truecolor;
+        if (v.find("256color") != std::string_view::npos)
+            return color_depth::indexed;
+        return color_depth::basic;
+    }
+
+    std::atomic<bool> resize_pending{false};
+    std::atomic<bool> resize_watched{false};
+
+    // the self-pipe wait_resize polls, written to from signal handlers
+    std::atomic<int> wake_read{-1};
+    std::atomic<int> wake_write{-1};
+
+    void open_wake_pipe() noexcept {
+        if (wake_read >= 0)
+            return;
+
+        int fds[2];
+        if (pipe2(fds, O_CLOEXEC | O_NONBLOCK) != 0)
+            return;
+        wake_write = fds[1];
+        wake_read = fds[0];
+    }
+
+    extern "C" void on_resize_signal(int) {
+        resize_pending = true;
+        holofetch::console::wake();
+    }
+
+    void append_utf8(std::string& out, char32_t c) {
+        if (c < 0x80) {
+            out += static_cast<char>(c);
+        } else if (c < 0x800) {
+            out += static_cast<char>(0xC0 | (c >> 6));
+            out += static_cast<char>(0x80 | (c & 0x3F));
+        } else if (c < 0x10000) {
+            out += static_cast<char>(0xE0 | (c >> 12));
+            out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (c & 0x3F));
+        } else if (c < 0x110000) {
+            out += static_cast<char>(0xF0 | (c >> 18));
+            out += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (c & 0x3F));
+        } else {
+            out += "\xEF\xBF\xBD";
+        }
+    }
+
+} // namespace
+
+namespace holofetch {
+
+    console::console() {
+        fd = STDOUT_FILENO;
+        tty = isatty(fd) == 1;
+        colors = detect_color_depth(tty);
+        update_size();
+    }
+
+    void console::fix_size(uint32_t fixed_width, uint32_t fixed_height) noexcept {
+        fixed_width_ = fixed_width;
+        fixed_height_ = fixed_height;
+        update_size();
+    }
+
+    bool console::update_size() noexcept {
+        uint32_t w = 0;
+        uint32_t h = 0;
+
+        if (winsize ws{}; tty && ioctl(fd, TIOCGWINSZ, &ws) == 0) {
+            w = ws.ws_col;
+            h = ws.ws_row;
+        }
+
+        // pipes, files and terminals that report 0x0 (serial lines, some CI runners)
+        if (w == 0)
+            w = env_size("COLUMNS");
+        if (h == 0)
+            h = env_size("LINES");
+
+        if (fixed_width_)
+            w = fixed_width_;
+        if (fixed_height_)
+            h = fixed_height_;
+
+        if (w == 0)
+            w = 80;
+        if (h == 0)
+            h = 24;
+
+        bool changed = w != width || h != height;
+        width = w;
+        height = h;
+        return changed;
+    }
+
+    void console::watch_resize() noexcept {
+        // one handler for the process, SIGWINCH is about the controlling terminal anyway
+        if (!tty || resize_watched.exchange(true))
+            return;
+
+        open_wake_pipe();
+
+        struct sigaction action{};
+        action.sa_handler = on_resize_signal;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGWINCH, &action, nullptr);
+    }
+
+    bool console::resized() noexcept {
+        return resize_pending.exchange(false);
+    }
+
+    bool console::wait_resize(std::chrono::milliseconds timeout) noexcept {
+        open_wake_pipe();
+        const int fd = wake_read;
+
+        // a signal ends the poll as well (EINTR), the caller looks at why it woke
+        pollfd p{fd, POLLIN, 0};
+        const auto ms = std::clamp<std::chrono::milliseconds::rep>(timeout.count(), 0, INT_MAX);
+        if (poll(&p, fd >= 0 ? 1 : 0, static_cast<int>(ms)) > 0) {
+            char buffer[64];
+            while (::read(fd, buffer, sizeof(buffer)) > 0);
+        }
+        return resized();
+    }
+
+    void console::wake() noexcept {
+        // a full pipe wakes the poll just as well, and the handler must leave errno as it was
+        if (const int fd = wake_write; fd >= 0) {
+            const int saved = errno;
+            [[maybe_unused]] ssize_t n = ::write(fd, "", 1);
+            errno = saved;
+        }
+    }
+
+    bool console::detect_synchronized_output() noexcept {
+        synchronized_output = false;
+        if (!tty || isatty(STDIN_FILENO) != 1)
+            return false;
+
+        termios saved{};
+        if (tcgetattr(STDIN_FILENO, &saved) != 0)
+            return false;
+
+        // the answer must not be echoed or wait for a newline
+        termios raw = saved;
+        raw.c_lflag &= ~(ICANON | ECHO);
+        raw.c_cc[VMIN] = 0;
+        raw.c_cc[VTIME] = 0;
+        if (tcsetattr(STDIN_FILENO, TCSANOW, &raw) != 0)
+            return false;
+
+        // DECRQM for mode 2026, then primary device attributes, which every terminal answers,
+        // so that one that ignores DECRQM does not keep us waiting for the timeout
+        write("\033[?2026$p\033[c");
+
+        std::string answer;
+        constexpr int timeout_ms = 250;
+        while (answer.size() < 256) {
+            pollfd p{STDIN_FILENO, POLLIN, 0};
+            int ready = poll(&p, 1, timeout_ms);
+            if (ready < 0 && errno == EINTR)
+                continue;
+            if (ready <= 0)
+                break;
+
+            char buffer[64];
+            ssize_t n = ::read(STDIN_FILENO, buffer, sizeof(buffer));
+            if (n <= 0)
+                break;
+            answer.append(buffer, static_cast<size_t>(n));
+
+            // the device attributes end in 'c' and come last
+            if (answer.back() == 'c')
+                break;
+        }
+
+        tcsetattr(STDIN_FILENO, TCSANOW, &saved);
+
+        // ESC[?2026;Ps$y, 1 and 2 are set and reset, 3 is permanently set, 0 and 4 mean no
+        constexpr std::string_view prefix{"\033[?2026;"};
+        if (auto report = answer.find(prefix); report != std::string::npos) {
+            const std::string_view rest = std::string_view{answer}.substr(report + prefix.size());
+            synchronized_output = rest.size() >= 3 && rest.substr(1, 2) == "$y"
+                && (rest[0] == '1' || rest[0] == '2' || rest[0] == '3');
+        }
+        return synchronized_output;
+    }
+
+    void console::put(std::string_view str) const {
+        write(str);
+    }
+
+    void console::put(std::wstring_view wstr) const {
+        if (wstr.empty())
+            return;
+
+        // wchar_t is UTF-32 here
+        std::string str;
+        str.reserve(wstr.size());
+        for (wchar_t c : wstr) {
+            append_utf8(str, static_cast<char32_t>(c));
+        }
+        write(str);
+    }
+
+    size_t console::write(std::string_view str) const {
+        size_t writes = 0;
+        while (!str.empty()) {
+            ++writes;
+            ssize_t n = ::write(fd, str.data(), str.size());
+            if (n < 0) {
+                if (errno == EINTR)
+                    continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    // somebody left our stdout non-blocking, wait until the reader catches up
+                    pollfd p{fd, POLLOUT, 0};
+                    while (poll(&p, 1, -1) < 0 && errno == EINTR);
+                    continue;
+                }
+                // EPIPE and friends, the reader is gone
+                break;
+            }
+            str.remove_prefix(static_cast<size_t>(n));
+        }
+        return writes;
+    }
+
+} // namespace holofetch
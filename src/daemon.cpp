@@ -0,0 +1,569 @@
+#include "holofetch/daemon.hpp"
+#include "holofetch/probe.hpp"
+#include "holofetch/shared_memory.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifdef _WIN32
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN 1
+#   endif
+#   include <windows.h>
+#else
+#   include <cerrno>
+#   include <poll.h>
+#   include <sys/eventfd.h>
+#   include <sys/socket.h>
+#   include <sys/stat.h>
+#   include <sys/un.h>
+#   include <unistd.h>
+#endif
+
+namespace {
+
+    using namespace std::chrono_literals;
+
+    /*
+     * How often each probe is rerun, anything not listed (names, versions, the OS) every ten minutes
+     * The fastest interval also bounds how old a published snapshot can get
+     */
+    struct refresh_interval {
+        std::string_view probe;
+        std::chrono::milliseconds every;
+    };
+
+    constexpr refresh_interval refresh_intervals[] = {
+        {"memory",   1s},
+        {"swap",     1s},
+        {"uptime",   1s},
+        {"disks",    10s},
+        {"displays", 10s},
+        {"network",  10s},
+        {"terminal", 60s}
+    };
+    constexpr std::chrono::milliseconds default_refresh_interval{10min};
+
+    // readers ignore snapshots older than this, a live daemon publishes every second
+    constexpr std::chrono::seconds stale_after{5};
+
+    std::chrono::milliseconds interval_of(std::string_view probe) noexcept {
+        for (const auto& interval : refresh_intervals) {
+            if (interval.probe == probe)
+                return interval.every;
+        }
+        return default_refresh_interval;
+    }
+
+    /*
+     * Serialization, one describe overload per structure lists its fields in order,
+     * the same list drives both the encoder and the decoder
+     */
+    template <class T, class U>
+    concept info_of = std::same_as<std::remove_const_t<T>, U>;
+
+    template <class A, info_of<holofetch::terminal_info> T>
+    void describe(A& ar, T& t) { ar(t.tab, t.hostname, t.username); }
+
+    template <class A, info_of<holofetch::cpu_info> T>
+    void describe(A& ar, T& t) { ar(t.name, t.cores, t.rate); }
+
+    template <class A, info_of<holofetch::gpu_info> T>
+    void describe(A& ar, T& t) { ar(t.name); }
+
+    template <class A, info_of<holofetch::memory_info> T>
+    void describe(A& ar, T& t) { ar(t.usedMB, t.totalMB, t.percent); }
+
+    template <class A, info_of<holofetch::swap_info> T>
+    void describe(A& ar, T& t) { ar(t.usedMB, t.totalMB, t.peakMB, t.percent); }
+
+    template <class A, info_of<holofetch::disk_info> T>
+    void describe(A& ar, T& t) { ar(t.usedMB, t.totalMB, t.percent, t.id, t.path); }
+
+    template <class A, info_of<holofetch::display_info> T>
+    void describe(A& ar, T& t) { ar(t.index, t.name, t.width, t.height, t.frequency); }
+
+    template <class A, info_of<holofetch::hardware_info> T>
+    void describe(A& ar, T& t) { ar(t.cpu, t.gpu, t.mem, t.swap, t.disks, t.displays); }
+
+    template <class A, info_of<holofetch::software_info> T>
+    void describe(A& ar, T& t) { ar(t.os, t.pwsh, t.cc, t.c, t.py, t.rust); }
+
+    template <class A, info_of<holofetch::host_info> T>
+    void describe(A& ar, T& t) { ar(t.terminal, t.hardware, t.software, t.uptime); }
+
+    template <class A, info_of<holofetch::network::adapter_info> T>
+    void describe(A& ar, T& t) { ar(t.name, t.description, t.mac, t.ipv4, t.ipv6); }
+
+    template <class A, info_of<holofetch::network::network_info> T>
+    void describe(A& ar, T& t) { ar(t.adapters); }
+
+    template <class A, info_of<holofetch::daemon::snapshot> T>
+    void describe(A& ar, T& t) { ar(t.taken, t.host, t.network); }
+
+    template <class T>
+    struct is_vector : std::false_type {};
+    template <class T>
+    struct is_vector<std::vector<T>> : std::true_type {};
+
+    template <class T>
+    struct is_duration : std::false_type {};
+    template <class R, class P>
+    struct is_duration<std::chrono::duration<R, P>> : std::true_type {};
+
+    constexpr std::string_view snapshot_magic{"holofetch-snapshot 1\n"};
+
+    class encoder {
+        std::string& out_;
+    public:
+        explicit encoder(std::string& out) noexcept : out_(out) {}
+
+        template <class... T>
+        void operator()(const T&... values) { (put(values), ...); }
+
+    private:
+        void word(uint64_t v) { out_.append(reinterpret_cast<const char*>(&v), sizeof(v)); }
+
+        template <class T>
+        void put(const T& v) {
+            if constexpr (std::is_integral_v<T>) {
+                word(static_cast<uint64_t>(v));
+            } else if constexpr (std::same_as<T, std::string>) {
+                word(v.size());
+                out_.append(v);
+            } else if constexpr (is_vector<T>::value) {
+                word(v.size());
+                for (const auto& e : v)
+                    put(e);
+            } else if constexpr (is_duration<T>::value) {
+                word(static_cast<uint64_t>(v.count()));
+            } else if constexpr (std::same_as<T, std::chrono::system_clock::time_point>) {
+                word(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(v.time_since_epoch()).count()));
+            } else {
+                describe(*this, v);
+            }
+        }
+    };
+
+    class decoder {
+        std::string_view in_;
+        bool ok_{true};
+    public:
+        explicit decoder(std::string_view in) noexcept : in_(in) {}
+
+        bool ok() const noexcept { return ok_ && in_.empty(); }
+
+        template <class... T>
+        void operator()(T&... values) { (get(values), ...); }
+
+    private:
+        uint64_t word() noexcept {
+            uint64_t v = 0;
+            if (in_.size() < sizeof(v)) {
+                ok_ = false;
+                return 0;
+            }
+            std::memcpy(&v, in_.data(), sizeof(v));
+            in_.remove_prefix(sizeof(v));
+            return v;
+        }
+
+        template <class T>
+        void get(T& v) {
+            if (!ok_)
+                return;
+
+            if constexpr (std::is_integral_v<T>) {
+                v = static_cast<T>(word());
+            } else if constexpr (std::same_as<T, std::string>) {
+                auto size = word();
+                if (size > in_.size()) {
+                    ok_ = false;
+                    return;
+                }
+                v.assign(in_.substr(0, size));
+                in_.remove_prefix(size);
+            } else if constexpr (is_vector<T>::value) {
+                // every element takes at least one word, a larger count is garbage
+                auto size = word();
+                if (size > in_.size() / sizeof(uint64_t)) {
+                    ok_ = false;
+                    return;
+                }
+                v.resize(size);
+                for (auto& e : v)
+                    get(e);
+            } else if constexpr (is_duration<T>::value) {
+                v = T{static_cast<typename T::rep>(word())};
+            } else if constexpr (std::same_as<T, std::chrono::system_clock::time_point>) {
+                v = T{std::chrono::milliseconds{static_cast<int64_t>(word())}};
+            } else {
+                describe(*this, v);
+            }
+        }
+    };
+
+    /*
+     * Shared memory layout: this header, then the encoded snapshot
+     * sequence is odd while the writer is busy; a reader copies the data and keeps the copy
+     * only if sequence is even and unchanged around it
+     */
+    struct segment_header {
+        std::atomic<uint32_t> magic;
+        std::atomic<uint32_t> version;
+        std::atomic<uint64_t> sequence;
+        std::atomic<uint64_t> size;
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "the seqlock is shared between processes");
+
+    constexpr uint32_t segment_magic = 0x53534648; // "HFSS"
+    constexpr uint32_t segment_version = 1;
+    constexpr size_t segment_size = 256 * 1024;
+
+    std::string segment_name() {
+#ifdef _WIN32
+        // Local\ is private to the logon session
+        return "Local\\holofetch-snapshot";
+#else
+        return "/holofetch-" + std::to_string(::getuid());
+#endif
+    }
+
+    bool publish(holofetch::shared_memory& segment, std::string_view bytes) noexcept {
+        auto* header = reinterpret_cast<segment_header*>(segment.bytes().data());
+        auto* data = segment.bytes().data() + sizeof(segment_header);
+        if (bytes.size() > segment.size() - sizeof(segment_header))
+            return false;
+
+        const uint64_t sequence = header->sequence.load(std::memory_order_relaxed);
+        header->sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        std::memcpy(data, bytes.data(), bytes.size());
+        header->size.store(bytes.size(), std::memory_order_relaxed);
+
+        header->sequence.store(sequence + 2, std::memory_order_release);
+        header->magic.store(segment_magic, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<std::string> read_segment(const holofetch::shared_memory& segment) {
+        if (segment.size() < sizeof(segment_header))
+            return std::nullopt;
+
+        const auto* header = reinterpret_cast<const segment_header*>(segment.bytes().data());
+        const auto* data = reinterpret_cast<const char*>(segment.bytes().data() + sizeof(segment_header));
+        const size_t capacity = segment.size() - sizeof(segment_header);
+
+        if (header->magic.load(std::memory_order_acquire) != segment_magic || header->version.load(std::memory_order_relaxed) != segment_version)
+            return std::nullopt;
+
+        std::string copy;
+        // the writer holds the lock for a memcpy, a handful of tries is plenty
+        for (int attempt = 0; attempt < 64; ++attempt) {
+            const uint64_t before = header->sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            const uint64_t size = header->size.load(std::memory_order_relaxed);
+            if (size > capacity)
+                continue;
+            copy.assign(data, size);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (header->sequence.load(std::memory_order_relaxed) == before)
+                return copy;
+        }
+
+        return std::nullopt;
+    }
+
+#ifndef _WIN32
+
+    /*
+     * $XDG_RUNTIME_DIR is private to the user, /tmp is not, hence the uid and the permissions
+     */
+    std::string socket_path() {
+        if (auto runtime = holofetch::find_env_var("XDG_RUNTIME_DIR"); !runtime.empty())
+            return runtime + "/holofetch.sock";
+        return "/tmp/holofetch-" + std::to_string(::getuid()) + ".sock";
+    }
+
+    bool make_address(const std::string& path, sockaddr_un& address) noexcept {
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path))
+            return false;
+        std::memcpy(address.sun_path, path.data(), path.size());
+        return true;
+    }
+
+    void set_timeout(int fd, int option, std::chrono::milliseconds timeout) noexcept {
+        timeval tv{};
+        tv.tv_sec = static_cast<time_t>(timeout.count() / 1000);
+        tv.tv_usec = static_cast<suseconds_t>((timeout.count() % 1000) * 1000);
+        ::setsockopt(fd, SOL_SOCKET, option, &tv, sizeof(tv));
+    }
+
+    std::optional<std::string> read_socket() {
+        sockaddr_un address;
+        if (!make_address(socket_path(), address))
+            return std::nullopt;
+
+        int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0)
+            return std::nullopt;
+
+        set_timeout(fd, SO_RCVTIMEO, 200ms);
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            ::close(fd);
+            return std::nullopt;
+        }
+
+        // the daemon writes one snapshot and hangs up
+        std::string bytes;
+        char buffer[16 * 1024];
+        for (;;) {
+            ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+            if (n > 0) {
+                bytes.append(buffer, static_cast<size_t>(n));
+                continue;
+            }
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n < 0)
+                bytes.clear();
+            break;
+        }
+
+        ::close(fd);
+        if (bytes.empty())
+            return std::nullopt;
+        return bytes;
+    }
+
+    class socket_server {
+        int fd_{-1};
+        std::string path_;
+    public:
+        socket_server() {
+            path_ = socket_path();
+
+            sockaddr_un address;
+            if (!make_address(path_, address))
+                throw std::runtime_error("socket path too long: " + path_);
+
+            fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+            if (fd_ < 0)
+                throw std::runtime_error("could not create socket: " + std::to_string(errno));
+
+            // whatever is left at the path belongs to a daemon that is gone, connect() said so
+            ::unlink(path_.c_str());
+            mode_t previous = ::umask(0077);
+            int bound = ::bind(fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+            ::umask(previous);
+
+            if (bound != 0 || ::listen(fd_, 16) != 0) {
+                int error = errno;
+                ::close(fd_);
+                throw std::runtime_error("could not listen on " + path_ + ": " + std::to_string(error));
+            }
+        }
+
+        ~socket_server() {
+            ::close(fd_);
+            ::unlink(path_.c_str());
+        }
+
+        socket_server(const socket_server&) = delete;
+        socket_server& operator=(const socket_server&) = delete;
+
+        int fd() const noexcept { return fd_; }
+
+        /*
+         * Hands the snapshot to everyone waiting, a client too slow to take it is dropped
+         */
+        void answer(std::string_view bytes) noexcept {
+            for (;;) {
+                int client = ::accept4(fd_, nullptr, nullptr, SOCK_CLOEXEC);
+                if (client < 0) {
+                    if (errno == EINTR)
+                        continue;
+                    return;
+                }
+
+                set_timeout(client, SO_SNDTIMEO, 100ms);
+                std::string_view left = bytes;
+                while (!left.empty()) {
+                    ssize_t n = ::send(client, left.data(), left.size(), MSG_NOSIGNAL);
+                    if (n < 0 && errno == EINTR)
+                        continue;
+                    if (n <= 0)
+                        break;
+                    left.remove_prefix(static_cast<size_t>(n));
+                }
+                ::close(client);
+            }
+        }
+    };
+
+#endif
+
+    void report_errors(const std::vector<holofetch::probe_timing>& timings) {
+        for (const auto& timing : timings) {
+            if (!timing.error.empty())
+                std::cerr << "holofetchd: probe " << timing.name << " failed: " << timing.error << "\n";
+        }
+    }
+
+} // namespace
+
+namespace holofetch::daemon {
+
+    std::string encode(const snapshot& s) {
+        std::string bytes{snapshot_magic};
+        encoder{bytes}(s);
+        return bytes;
+    }
+
+    std::optional<snapshot> decode(std::string_view bytes) {
+        if (!bytes.starts_with(snapshot_magic))
+            return std::nullopt;
+        bytes.remove_prefix(snapshot_magic.size());
+
+        snapshot s;
+        decoder d{bytes};
+        d(s);
+        if (!d.ok())
+            return std::nullopt;
+        return s;
+    }
+
+    bool stale(const snapshot& s, std::chrono::system_clock::time_point now) noexcept {
+        return now - s.taken > stale_after || s.taken - now > stale_after;
+    }
+
+    void serve(std::stop_token stop) {
+        if (connect())
+            throw std::runtime_error("another holofetchd is already running");
+
+        auto segment = shared_memory::create(segment_name(), segment_size);
+        if (!segment)
+            throw std::runtime_error("could not create shared memory segment " + segment_name());
+
+        auto* header = new (segment.bytes().data()) segment_header{};
+        header->version.store(segment_version, std::memory_order_relaxed);
+
+#ifdef _WIN32
+        HANDLE stop_event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (!stop_event)
+            throw std::runtime_error("could not create stop event");
+        auto signal_stop = [stop_event]() { SetEvent(stop_event); };
+#else
+        socket_server server;
+        int stop_event = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (stop_event < 0)
+            throw std::runtime_error("could not create stop event");
+        auto signal_stop = [stop_event]() {
+            uint64_t one = 1;
+            [[maybe_unused]] auto n = ::write(stop_event, &one, sizeof(one));
+        };
+#endif
+        std::optional<std::stop_callback<decltype(signal_stop)>> on_stop;
+        on_stop.emplace(stop, signal_stop);
+
+        snapshot current;
+        fact_cache cache(fact_cache::default_path());
+
+        // probes write into current, which stays put for as long as they live
+        auto probes = host_probes(current.host, cache);
+        probes.push_back({"network", [&current] { current.network = network::query_network_info(); }});
+        std::vector<std::chrono::steady_clock::time_point> due(probes.size(), std::chrono::steady_clock::now());
+
+        std::string bytes;
+        while (!stop.stop_requested()) {
+            const auto now = std::chrono::steady_clock::now();
+
+            probe_scheduler scheduler;
+            for (size_t i = 0; i < probes.size(); ++i) {
+                if (due[i] > now)
+                    continue;
+                scheduler.add(probes[i]);
+                due[i] = now + interval_of(probes[i].name);
+            }
+            report_errors(scheduler.run());
+            cache.save();
+
+            current.taken = std::chrono::system_clock::now();
+            bytes = encode(current);
+            if (!publish(segment, bytes))
+                std::cerr << "holofetchd: snapshot of " << bytes.size() << " bytes does not fit the shared memory segment\n";
+
+            auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(*std::min_element(due.begin(), due.end()) - std::chrono::steady_clock::now());
+            wait = std::max(wait, std::chrono::milliseconds{0});
+
+#ifdef _WIN32
+            WaitForSingleObject(stop_event, static_cast<DWORD>(wait.count()));
+#else
+            // clients of the socket are answered while waiting for the next refresh
+            const auto next = std::chrono::steady_clock::now() + wait;
+            while (!stop.stop_requested()) {
+                auto left = std::chrono::duration_cast<std::chrono::milliseconds>(next - std::chrono::steady_clock::now()).count();
+                if (left <= 0)
+                    break;
+
+                pollfd fds[2] = {
+                    pollfd{ .fd = server.fd(), .events = POLLIN, .revents = 0 },
+                    pollfd{ .fd = stop_event, .events = POLLIN, .revents = 0 }
+                };
+                if (::poll(fds, 2, static_cast<int>(left) + 1) > 0 && fds[0].revents)
+                    server.answer(bytes);
+            }
+#endif
+        }
+
+        // no more wakeups may land on the event once it is closed
+        on_stop.reset();
+#ifdef _WIN32
+        CloseHandle(stop_event);
+#else
+        ::close(stop_event);
+#endif
+    }
+
+    std::optional<snapshot> connect() noexcept {
+        try {
+            std::optional<snapshot> s;
+
+            if (auto segment = shared_memory::open(segment_name()); segment) {
+                if (auto bytes = read_segment(segment); bytes)
+                    s = decode(*bytes);
+            }
+#ifndef _WIN32
+            if (!s) {
+                if (auto bytes = read_socket(); bytes)
+                    s = decode(*bytes);
+            }
+#endif
+
+            if (!s || stale(*s, std::chrono::system_clock::now()))
+                return std::nullopt;
+            return s;
+        } catch (...) {
+            return std::nullopt;
+        }
+    }
+
+} // namespace holofetch::daemon
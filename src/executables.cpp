@@ -0,0 +1,199 @@
+#include "holofetch/executables.hpp"
+#include "holofetch/info.hpp"
+
+#include <algorithm>
+
+#ifndef _WIN32
+#   include <unistd.h>
+#endif
+
+namespace {
+
+#ifdef _WIN32
+    constexpr char path_separator = ';';
+#else
+    constexpr char path_separator = ':';
+#endif
+
+    std::vector<std::string_view> split(std::string_view list, char separator) {
+        std::vector<std::string_view> items;
+
+        size_t lastpos = 0;
+        while (lastpos <= list.size()) {
+            size_t pos = list.find(separator, lastpos);
+            if (pos == std::string_view::npos)
+                pos = list.size();
+
+            if (auto item = list.substr(lastpos, pos - lastpos); !item.empty())
+                items.push_back(item);
+
+            lastpos = pos + 1;
+        }
+
+        return items;
+    }
+
+    /*
+     * Names are matched as stored on case-sensitive systems only
+     */
+    std::string normalize(std::string_view name) {
+        std::string s{name};
+#ifdef _WIN32
+        std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) {
+            return static_cast<char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+        });
+#endif
+        return s;
+    }
+
+    bool is_executable(const std::filesystem::path& file) {
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(file, ec))
+            return false;
+#ifndef _WIN32
+        if (::access(file.c_str(), X_OK) != 0)
+            return false;
+#endif
+        return true;
+    }
+
+} // namespace
+
+namespace holofetch {
+
+    executable_index::executable_index()
+        : executable_index(find_env_var("PATH"), find_env_var("PATHEXT"))
+    {}
+
+    executable_index::executable_index(std::string_view path, std::string_view pathext) {
+        for (auto dir : split(path, path_separator)) {
+#ifdef _WIN32
+            // PATH entries may be quoted
+            if (dir.size() >= 2 && dir.front() == '"' && dir.back() == '"')
+                dir = dir.substr(1, dir.size() - 2);
+#endif
+            std::filesystem::path p{dir};
+            bool duplicate = std::any_of(directories_.begin(), directories_.end(), [&](const directory& d) { return d.path == p; });
+            if (!duplicate)
+                directories_.push_back(directory{ .path = std::move(p), .entries = std::nullopt });
+        }
+
+#ifdef _WIN32
+        if (pathext.empty())
+            pathext = ".COM;.EXE;.BAT;.CMD";
+        for (auto ext : split(pathext, ';')) {
+            extensions_.push_back(normalize(ext));
+        }
+#else
+        (void)pathext;
+#endif
+    }
+
+    const std::unordered_set<std::string>& executable_index::entries(directory& dir) {
+        if (dir.entries)
+            return *dir.entries;
+
+        auto& entries_ = dir.entries.emplace();
+        ++scans_;
+
+        std::error_code ec;
+        for (auto it = std::filesystem::directory_iterator(dir.path, ec); !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+            try {
+                entries_.insert(normalize(it->path().filename().string()));
+            } catch (...) {
+                // names not representable in the narrow encoding cannot be asked for anyway
+            }
+        }
+
+        return entries_;
+    }
+
+    std::filesystem::path executable_index::resolve_locked(std::string_view name) {
+        if (name.empty())
+            return {};
+
+        // names with a directory part are not looked up in PATH
+        if (name.find('/') != std::string_view::npos
+#ifdef _WIN32
+                || name.find('\\') != std::string_view::npos
+#endif
+        ) {
+            std::filesystem::path p{name};
+            return is_executable(p) ? p : std::filesystem::path{};
+        }
+
+        const std::string key = normalize(name);
+
+        std::vector<std::string> candidates;
+#ifdef _WIN32
+        // a name that already carries a PATHEXT extension is tried as is first
+        bool has_extension = std::any_of(extensions_.begin(), extensions_.end(), [&](const std::string& ext) {
+            return key.size() > ext.size() && key.ends_with(ext);
+        });
+        if (has_extension)
+            candidates.push_back(key);
+        for (const auto& ext : extensions_)
+            candidates.push_back(key + ext);
+#else
+        candidates.push_back(key);
+#endif
+
+        for (auto& dir : directories_) {
+            const auto& listing = entries(dir);
+            for (const auto& candidate : candidates) {
+                if (!listing.contains(candidate))
+                    continue;
+
+                auto p = dir.path / candidate;
+                if (is_executable(p))
+                    return p;
+            }
+        }
+
+        return {};
+    }
+
+    std::filesystem::path executable_index::resolve(std::string_view name) {
+        std::lock_guard lock(mutex_);
+        return resolve_locked(name);
+    }
+
+    std::vector<std::filesystem::path> executable_index::resolve(std::span<const std::string_view> names) {
+        std::vector<std::filesystem::path> paths;
+        paths.reserve(names.size());
+
+        std::lock_guard lock(mutex_);
+        for (auto name : names) {
+            paths.push_back(resolve_locked(name));
+        }
+
+        return paths;
+    }
+
+    size_t executable_index::directory_scans() const noexcept {
+        std::lock_guard lock(mutex_);
+        return scans_;
+    }
+
+    executable_index& executable_index::shared() {
+        static executable_index index;
+        return index;
+    }
+
+    std::string find_executable_path(std::string_view command) noexcept {
+        try {
+            return executable_index::shared().resolve(command).string();
+        } catch (...) {
+            return {};
+        }
+    }
+
+    std::vector<std::string> find_executable_paths(std::span<const std::string_view> commands) {
+        std::vector<std::string> paths;
+        for (auto& p : executable_index::shared().resolve(commands)) {
+            paths.push_back(p.string());
+        }
+        return paths;
+    }
+
+} // namespace holofetch
@@ -0,0 +1,88 @@
+#include <atomic>
+#include <iostream>
+#include <stop_token>
+#include <thread>
+#include "argparse.hpp"
+
+#include "holofetch/daemon.hpp"
+
+#ifdef _WIN32
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN 1
+#   endif
+#   include <windows.h>
+#else
+#   include <csignal>
+#   include <pthread.h>
+#   include <unistd.h>
+#endif
+
+namespace {
+
+#ifdef _WIN32
+    std::stop_source shutdown;
+
+    BOOL WINAPI on_console_event(DWORD) {
+        shutdown.request_stop();
+        return TRUE;
+    }
+#endif
+
+} // namespace
+
+/*
+ * Keeps the host snapshot fresh for holofetch, runs in the foreground until interrupted
+ * Start it from a login script or as a user service
+ */
+int main(int ac, char** av) {
+    auto argparser = argparse::ArgumentParser("holofetchd");
+
+    try {
+        argparser.parse_args(ac, av);
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: could not parse arguments: " << e.what() << std::endl;
+        std::cerr << argparser;
+        return 1;
+    }
+
+#ifdef _WIN32
+    SetConsoleCtrlHandler(on_console_event, TRUE);
+
+    try {
+        holofetch::daemon::serve(shutdown.get_token());
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: holofetchd: " << e.what() << std::endl;
+        return 2;
+    }
+#else
+    // blocked before any thread exists, so only sigwait below ever sees them
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGHUP);
+    ::pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    std::atomic<bool> failed{false};
+    std::jthread server([&failed](std::stop_token stop) {
+        try {
+            holofetch::daemon::serve(stop);
+        } catch (const std::exception& e) {
+            std::cerr << "ERROR: holofetchd: " << e.what() << std::endl;
+            failed = true;
+            // wakes up the sigwait below
+            ::kill(::getpid(), SIGTERM);
+        }
+    });
+
+    int signal = 0;
+    sigwait(&signals, &signal);
+    server.request_stop();
+    server.join();
+
+    if (failed)
+        return 2;
+#endif
+
+    return 0;
+}
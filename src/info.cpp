@@ -14,6 +14,10 @@
 #include <Lmcons.h>
 
 #include <string>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
 #include <codecvt>
 #include <iostream>
 #include <thread>
@@ -24,21 +28,11 @@
 
 #include "m4x1m1l14n/Registry.hpp"
 #include "holofetch/subprocess.hpp"
+#include "holofetch/cache.hpp"
+#include "holofetch/metadata.hpp"
 
 namespace holofetch {
     
-    std::string find_executable_path(std::string_view command) noexcept {
-        auto cmd = std::vformat("WHERE.EXE {}", std::make_format_args(command));
-        auto result = subprocess::run(cmd);
-        
-        if (result.has_value() && result.value().code == 0) {
-            std::string path = std::move(result.value().out);
-            return path;
-        }
-
-        return {};
-    }
-
     std::string find_env_var(std::string_view name) noexcept {
         if (const char* key = getenv(name.data()); key) {
             return std::string{key};
@@ -50,55 +44,151 @@ namespace holofetch {
 
 namespace {
 
-    std::string get_msvc_version() {
-        auto result = holofetch::subprocess::run("CL.EXE");
-        constexpr std::string_view prefix{"Microsoft (R) C/C++ Optimizing Compiler Version "};
-        
-        if (result.has_value() && result.value().code == 0) {
-            const auto& out = result.value().err; // Microsoft :facepalm:
-            
-            auto pos = out.find('\n', prefix.size());
-            if (pos == std::string_view::npos) {
-                return {};
+    /*
+     * Upper bound for the version commands, which run as one batch; a hung tool must not stall
+     * the whole fetch, and pwsh on a cold profile load is routinely slow
+     */
+    constexpr std::chrono::milliseconds version_probe_timeout{4000};
+
+    /*
+     * Lifetimes of cached facts, tool versions are additionally keyed by the executable fingerprint
+     */
+    constexpr std::chrono::seconds tool_version_ttl{std::chrono::days{7}};
+    constexpr std::chrono::seconds os_ttl{std::chrono::days{1}};
+    constexpr std::chrono::seconds hardware_name_ttl{std::chrono::days{30}};
+
+    /*
+     * Versions are read from the VS_VERSIONINFO resource of the executable,
+     * spawning the tool is only a fallback for binaries without one
+     */
+    std::string read_msvc_version(const std::filesystem::path& executable) {
+        if (auto pe = holofetch::metadata::read_pe_version(executable); pe && pe->major != 0) {
+            auto version = std::vformat("{}.{}.{}", std::make_format_args(pe->major, pe->minor, pe->build));
+            if (!pe->machine.empty()) {
+                version += " for ";
+                version += pe->machine;
             }
-
-            return out.substr( prefix.size(), pos - prefix.size() - 1 );
+            return version;
         }
-        
         return {};
     }
 
-    std::string get_rustc_version() {
-        auto result = holofetch::subprocess::run("rustc --version");
-        if (result.has_value() && result.value().code == 0) {
-            auto& out = result.value().out;
-            auto pos = out.find('(');
-            return out.substr(sizeof("rustc ") - 1, pos == std::string::npos ? pos : pos - sizeof("rustc "));
+    /*
+     * The banner is all we need, on stderr (Microsoft :facepalm:), CL.EXE goes on to print its usage
+     */
+    std::string msvc_command(const std::filesystem::path&) {
+        return "CL.EXE";
+    }
+
+    std::string parse_msvc_version(const std::filesystem::path&, std::string_view line) {
+        constexpr std::string_view prefix{"Microsoft (R) C/C++ Optimizing Compiler Version "};
+        if (!line.starts_with(prefix))
+            return {};
+        return std::string{line.substr(prefix.size())};
+    }
+
+    /*
+     * rustup proxies carry no version resource, only real toolchain binaries do
+     */
+    std::string read_rustc_version(const std::filesystem::path& executable) {
+        if (auto pe = holofetch::metadata::read_pe_version(executable); pe && !pe->product_version.empty()) {
+            return pe->product_version;
         }
         return {};
     }
 
-    std::string get_python_version() {
-        auto result = holofetch::subprocess::run("py --version");
-        if (result.has_value() && result.value().code == 0) {
-            auto& out = result.value().out;
-            auto pos = out.find('\n', sizeof("Python ") - 1);
-            auto s = out.substr(sizeof("Python ") - 1, pos == std::string::npos ? pos : pos - sizeof("Python "));
-            return s;
+    std::string rustc_command(const std::filesystem::path&) {
+        return "rustc --version";
+    }
+
+    std::string parse_rustc_version(const std::filesystem::path&, std::string_view line) {
+        if (!line.starts_with("rustc "))
+            return {};
+        auto pos = line.find('(');
+        return std::string{line.substr(sizeof("rustc ") - 1, pos == std::string_view::npos ? pos : pos - sizeof("rustc "))};
+    }
+
+    /*
+     * py.exe is only the launcher, its version resource is its own; the interpreter it starts is
+     * read instead when python.exe is in PATH, Store aliases there are empty files that run the
+     * installer and are skipped
+     */
+    std::filesystem::path resolve_python(const std::filesystem::path& launcher) {
+        auto python = holofetch::executable_index::shared().resolve("python");
+
+        std::error_code ec;
+        if (python.empty() || std::filesystem::file_size(python, ec) == 0 || ec)
+            return launcher;
+        return python;
+    }
+
+    bool is_python_launcher(const std::filesystem::path& executable) {
+        auto name = executable.filename().string();
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return name == "py.exe";
+    }
+
+    std::string read_python_version(const std::filesystem::path& executable) {
+        if (is_python_launcher(executable))
+            return {};
+        if (auto pe = holofetch::metadata::read_pe_version(executable); pe && !pe->product_version.empty()) {
+            return pe->product_version;
         }
         return {};
     }
 
-    std::string get_pwsh_version() {
-        auto result = holofetch::subprocess::run("pwsh --version");
-        if (result.has_value() && result.value().code == 0) {
-            auto& out = result.value().out;
-            auto pos = out.find('\n');
-            return out.substr(sizeof("PowerShell ") - 1, pos == std::string::npos ? pos : pos - sizeof("PowerShell "));
+    /*
+     * The launcher answers with the version of the interpreter it would start
+     */
+    std::string python_command(const std::filesystem::path& executable) {
+        return is_python_launcher(executable) ? std::string{"py --version"} : "\"" + executable.string() + "\" --version";
+    }
+
+    std::string parse_python_version(const std::filesystem::path&, std::string_view line) {
+        if (!line.starts_with("Python "))
+            return {};
+        return std::string{line.substr(sizeof("Python ") - 1)};
+    }
+
+    /*
+     * ProductVersion looks like "7.4.1 SHA: 6a98b28..."
+     */
+    std::string read_pwsh_version(const std::filesystem::path& executable) {
+        if (auto pe = holofetch::metadata::read_pe_version(executable); pe && !pe->product_version.empty()) {
+            return pe->product_version.substr(0, pe->product_version.find(' '));
         }
         return {};
     }
 
+    /*
+     * The batch waits for pwsh to tear down its runtime, which takes long after the version is out
+     */
+    std::string pwsh_command(const std::filesystem::path&) {
+        return "pwsh --version";
+    }
+
+    std::string parse_pwsh_version(const std::filesystem::path&, std::string_view line) {
+        if (!line.starts_with("PowerShell "))
+            return {};
+        return std::string{line.substr(sizeof("PowerShell ") - 1)};
+    }
+
+    void my_fetch_versions(holofetch::software_info& software, holofetch::fact_cache& cache) {
+        const holofetch::tool_version_query tools[] = {
+            { .tool = "pwsh", .read = read_pwsh_version, .command = pwsh_command, .parse = parse_pwsh_version },
+            { .tool = "cl", .read = read_msvc_version, .command = msvc_command, .channel = holofetch::subprocess::channel::err, .parse = parse_msvc_version },
+            { .tool = "rustc", .read = read_rustc_version, .command = rustc_command, .parse = parse_rustc_version },
+            { .tool = "py", .resolve = resolve_python, .read = read_python_version, .command = python_command, .parse = parse_python_version }
+        };
+
+        auto versions = holofetch::cached_tool_versions(cache, tools, tool_version_ttl, version_probe_timeout);
+        software.pwsh = std::move(versions[0]);
+        software.cc = "cl";
+        software.c = std::move(versions[1]);
+        software.rust = std::move(versions[2]);
+        software.py = std::move(versions[3]);
+    }
+
     
     inline holofetch::swap_info my_fetch_swap() {
         holofetch::swap_info si;
@@ -157,7 +247,6 @@ namespace {
         GetUserNameA(buffer, &size);
         info_.username = std::string(buffer);
 
-        std::setlocale(LC_ALL, "en_US.UTF-8");
         WCHAR console[UNLEN + 1]{};
         size = GetConsoleTitleW((WCHAR*)console, 256);
         info_.tab = holofetch::convert_to_utf8(std::wstring_view{console});
@@ -224,42 +313,64 @@ namespace {
         return info_;
     }
 
-    inline holofetch::hardware_info my_fetch_hardware() {
-        holofetch::hardware_info info_;
+    inline holofetch::cpu_info my_fetch_cpu(holofetch::fact_cache& cache) {
+        holofetch::cpu_info info_;
+        info_.cores = std::thread::hardware_concurrency();
+
+        auto cached_name = cache.get("cpu.name");
+        auto cached_rate = cache.get("cpu.rate");
+        if (cached_name && cached_rate) {
+            info_.name = std::move(*cached_name);
+            info_.rate = static_cast<uint32_t>(std::strtoul(cached_rate->c_str(), nullptr, 10));
+            return info_;
+        }
 
-        // CPU
         if (auto key = m4x1m1l14n::Registry::LocalMachine->Open(L"HARDWARE\\DESCRIPTION\\System\\CentralProcessor\\0"); key) {
-            info_.cpu.name = holofetch::convert_to_utf8( key->GetString(L"ProcessorNameString") );
-            info_.cpu.rate = key->GetInt32(L"~MHz");
+            info_.name = holofetch::convert_to_utf8( key->GetString(L"ProcessorNameString") );
+            info_.rate = key->GetInt32(L"~MHz");
         } else {
-            info_.cpu.name = "N/A";
-            info_.cpu.rate = 0;
+            info_.name = "N/A";
+            info_.rate = 0;
+            return info_;
         }
-        info_.cpu.cores = std::thread::hardware_concurrency();
 
-        // GPU
-        if (auto key = m4x1m1l14n::Registry::LocalMachine->Open(L"SOFTWARE\\Microsoft\\Windows NT\\CurrentVersion\\WinSAT"); key) {
-            info_.gpu.name = holofetch::convert_to_utf8( key->GetString(L"PrimaryAdapterString") );
+        cache.put("cpu.name", info_.name, hardware_name_ttl);
+        cache.put("cpu.rate", std::to_string(info_.rate), hardware_name_ttl);
+
+        return info_;
+    }
+
+    inline holofetch::gpu_info my_fetch_gpu(holofetch::fact_cache& cache) {
+        holofetch::gpu_info info_;
+
+        if (auto cached = cache.get("gpu.name"); cached) {
+            info_.name = std::move(*cached);
+        } else if (auto key = m4x1m1l14n::Registry::LocalMachine->Open(L"SOFTWARE\\Microsoft\\Windows NT\\CurrentVersion\\WinSAT"); key) {
+            info_.name = holofetch::convert_to_utf8( key->GetString(L"PrimaryAdapterString") );
+            cache.put("gpu.name", info_.name, hardware_name_ttl);
         } else {
-            info_.gpu.name = "N/A";
+            info_.name = "N/A";
         }
 
-        // MEM
+        return info_;
+    }
+
+    inline holofetch::memory_info my_fetch_memory() {
+        holofetch::memory_info info_;
+
         if (MEMORYSTATUSEX mem{ .dwLength = sizeof(mem)}; GlobalMemoryStatusEx(&mem)) {
-            info_.mem.totalMB = mem.ullTotalPhys / 1024 / 1024;
-            info_.mem.usedMB = info_.mem.totalMB - mem.ullAvailPhys / 1024 / 1024;
-            info_.mem.percent = mem.dwMemoryLoad;
+            info_.totalMB = mem.ullTotalPhys / 1024 / 1024;
+            info_.usedMB = info_.totalMB - mem.ullAvailPhys / 1024 / 1024;
+            info_.percent = mem.dwMemoryLoad;
         }
 
-        info_.swap = my_fetch_swap();
-        info_.disks = my_fetch_disks();
-        info_.displays = my_fetch_displays();
-
         return info_;
     }
 
-    inline holofetch::software_info my_fetch_software() {
-        holofetch::software_info info_;
+    inline std::string my_fetch_os(holofetch::fact_cache& cache) {
+        if (auto cached = cache.get("os"); cached) {
+            return std::move(*cached);
+        }
 
         if (auto key = m4x1m1l14n::Registry::LocalMachine->Open(L"SOFTWARE\\Microsoft\\Windows NT\\CurrentVersion"); key) {
             auto productName = key->GetString(L"ProductName");
@@ -271,26 +382,12 @@ namespace {
                 productName = L"Windows 11 " + editionId.substr(0, 3);
             }
 
-            info_.os = holofetch::convert_to_utf8( productName + L" " + displayVersion + L" (build " + currentBuildNumber + L")" );
+            auto os = holofetch::convert_to_utf8( productName + L" " + displayVersion + L" (build " + currentBuildNumber + L")" );
+            cache.put("os", os, os_ttl);
+            return os;
         }
 
-        info_.pwsh = get_pwsh_version();
-        info_.c = get_msvc_version();
-        info_.rust = get_rustc_version();
-        info_.py = get_python_version();
-
-        return info_;
-    }
-
-    inline holofetch::host_info my_fetch_host() {
-        holofetch::host_info info_;
-
-        info_.terminal = my_fetch_terminal();
-        info_.hardware = my_fetch_hardware();
-        info_.software = my_fetch_software();
-        info_.uptime = std::chrono::milliseconds{ GetTickCount64() };
-
-        return info_;
+        return {};
     }
 
 } // namespace
@@ -301,6 +398,29 @@ std::string holofetch::convert_to_utf8(std::wstring_view wstr) {
     return _UTF_Converter.to_bytes(wstr.data(), wstr.data() + wstr.size());
 }
 
+std::vector<holofetch::probe> holofetch::host_probes(host_info& info, fact_cache& cache) {
+    // process spawns first, they are the slowest
+    return {
+        {"versions", [&info, &cache] { my_fetch_versions(info.software, cache); }},
+        {"os",       [&info, &cache] { info.software.os = my_fetch_os(cache); }},
+        {"cpu",      [&info, &cache] { info.hardware.cpu = my_fetch_cpu(cache); }},
+        {"gpu",      [&info, &cache] { info.hardware.gpu = my_fetch_gpu(cache); }},
+        {"memory",   [&info] { info.hardware.mem = my_fetch_memory(); }},
+        {"swap",     [&info] { info.hardware.swap = my_fetch_swap(); }},
+        {"disks",    [&info] { info.hardware.disks = my_fetch_disks(); }},
+        {"displays", [&info] { info.hardware.displays = my_fetch_displays(); }},
+        {"terminal", [&info] { info.terminal = my_fetch_terminal(); }},
+        {"uptime",   [&info] { info.uptime = std::chrono::milliseconds{ GetTickCount64() }; }}
+    };
+}
+
 holofetch::host_info holofetch::query_host_info() {
-    return my_fetch_host();
+    host_info info_;
+    fact_cache cache;
+
+    probe_scheduler scheduler;
+    scheduler.add(host_probes(info_, cache));
+    scheduler.run();
+
+    return info_;
 }
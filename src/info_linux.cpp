@@ -0,0 +1,640 @@
+#include "holofetch/info.hpp"
+
+#include <sys/statvfs.h>
+#include <sys/sysinfo.h>
+#include <sys/utsname.h>
+#include <fcntl.h>
+#include <pwd.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "holofetch/cache.hpp"
+#include "holofetch/metadata.hpp"
+#include "holofetch/subprocess.hpp"
+
+namespace holofetch {
+
+    std::string find_env_var(std::string_view name) noexcept {
+        if (const char* key = getenv(name.data()); key) {
+            return std::string{key};
+        }
+        return {};
+    }
+
+}
+
+namespace {
+
+    /*
+     * Lifetimes of cached facts, tool versions are additionally keyed by the executable fingerprint
+     */
+    constexpr std::chrono::seconds tool_version_ttl{std::chrono::days{7}};
+    constexpr std::chrono::seconds os_ttl{std::chrono::days{1}};
+    constexpr std::chrono::seconds hardware_name_ttl{std::chrono::days{30}};
+
+    /*
+     * Version commands run as one batch, which gets the time pwsh needs when its runtime starts cold
+     */
+    constexpr std::chrono::milliseconds version_probe_timeout{4000};
+
+    /*
+     * Reads a whole (usually /proc or /sys) file into a buffer reused by every probe running on this thread
+     * The view is valid until the next call on the same thread
+     */
+    std::string_view read_whole_file(const char* path) noexcept {
+        thread_local std::string buffer;
+
+        int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return {};
+
+        size_t size = 0;
+        try {
+            if (buffer.size() < 16 * 1024)
+                buffer.resize(16 * 1024);
+
+            for (;;) {
+                if (size == buffer.size())
+                    buffer.resize(buffer.size() * 2);
+
+                ssize_t n = ::read(fd, buffer.data() + size, buffer.size() - size);
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n <= 0)
+                    break;
+                size += static_cast<size_t>(n);
+            }
+        } catch (...) {
+            size = 0;
+        }
+
+        ::close(fd);
+        return {buffer.data(), size};
+    }
+
+    std::string_view trim(std::string_view s) noexcept {
+        while (!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+            s.remove_prefix(1);
+        while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r' || s.back() == '\n'))
+            s.remove_suffix(1);
+        return s;
+    }
+
+    /*
+     * Value of the first "key<spaces><separator>value" line, trimmed
+     */
+    std::string_view find_field(std::string_view content, std::string_view key, char separator = ':') noexcept {
+        size_t pos = 0;
+        while (pos < content.size()) {
+            size_t eol = content.find('\n', pos);
+            if (eol == std::string_view::npos)
+                eol = content.size();
+
+            if (auto line = content.substr(pos, eol - pos); line.starts_with(key)) {
+                auto rest = line.substr(key.size());
+                if (size_t i = rest.find_first_not_of(" \t"); i != std::string_view::npos && rest[i] == separator)
+                    return trim(rest.substr(i + 1));
+            }
+
+            pos = eol + 1;
+        }
+        return {};
+    }
+
+    uint64_t parse_u64(std::string_view s) noexcept {
+        uint64_t v = 0;
+        std::from_chars(s.data(), s.data() + s.size(), v);
+        return v;
+    }
+
+    std::string_view first_token(std::string_view s) noexcept {
+        return s.substr(0, s.find(' '));
+    }
+
+    std::string_view last_token(std::string_view s) noexcept {
+        s = trim(s);
+        auto pos = s.rfind(' ');
+        return pos == std::string_view::npos ? s : s.substr(pos + 1);
+    }
+
+    std::filesystem::path canonical_or_self(const std::filesystem::path& p) {
+        std::error_code ec;
+        auto c = std::filesystem::canonical(p, ec);
+        return ec ? p : c;
+    }
+
+    /*
+     * Trailing "-N" of names like gcc-12 or x86_64-linux-gnu-gcc-12
+     */
+    std::string_view name_major_version(std::string_view name) noexcept {
+        auto pos = name.rfind('-');
+        if (pos == std::string_view::npos || pos + 1 == name.size())
+            return {};
+        auto suffix = name.substr(pos + 1);
+        return suffix.find_first_not_of("0123456789.") == std::string_view::npos ? suffix : std::string_view{};
+    }
+
+    /*
+     * Fallback for binaries whose metadata says nothing, its first line is parsed
+     */
+    std::string version_command(const std::filesystem::path& executable) {
+        return "\"" + executable.string() + "\" --version";
+    }
+
+    bool is_clang(const std::filesystem::path& real) {
+        return real.filename().string().find("clang") != std::string::npos;
+    }
+
+    /*
+     * "gcc 12.2.0" or "clang 17.0.6", cross-checked against the major version in the file name
+     * when there is one
+     */
+    std::string cc_version(const std::filesystem::path& real, std::string version) {
+        const auto name = real.filename().string();
+        if (auto major = name_major_version(name); !major.empty() && !version.starts_with(major)) {
+            version = major;
+        }
+
+        if (version.empty())
+            return {};
+        return std::string{is_clang(real) ? "clang" : "gcc"} + " " + version;
+    }
+
+    /*
+     * gcc and clang are built by themselves, so .comment carries their own version
+     */
+    std::string read_cc_version(const std::filesystem::path& executable) {
+        auto real = canonical_or_self(executable);
+        const bool clang = is_clang(real);
+
+        std::string version;
+        for (const auto& comment : holofetch::metadata::read_elf_comments(real)) {
+            std::string_view c{comment};
+            if (!clang && c.starts_with("GCC: ")) {
+                version = last_token(c);
+            } else if (clang) {
+                if (auto pos = c.find("clang version "); pos != std::string_view::npos) {
+                    version = first_token(c.substr(pos + sizeof("clang version ") - 1));
+                }
+            }
+        }
+
+        if (version.empty())
+            return {};
+        return cc_version(real, std::move(version));
+    }
+
+    std::string parse_cc_version(const std::filesystem::path& executable, std::string_view line) {
+        auto real = canonical_or_self(executable);
+
+        std::string version;
+        if (auto pos = line.find("clang version "); is_clang(real) && pos != std::string_view::npos)
+            version = first_token(line.substr(pos + sizeof("clang version ") - 1));
+        else if (!is_clang(real) && !line.empty())
+            version = last_token(line);
+        return cc_version(real, std::move(version));
+    }
+
+    /*
+     * The interpreter a pyenv shim runs: the PYENV_VERSION one, else the one in the nearest
+     * .python-version above the working directory, else the global version file; anything else
+     * is the interpreter itself
+     */
+    std::filesystem::path resolve_python(const std::filesystem::path& executable) {
+        auto real = canonical_or_self(executable);
+        if (real.parent_path().filename() != "shims")
+            return real;
+
+        const auto root = real.parent_path().parent_path();
+        std::string version = holofetch::find_env_var("PYENV_VERSION");
+
+        std::error_code ec;
+        if (version.empty()) {
+            for (auto dir = std::filesystem::current_path(ec); !ec && !dir.empty(); dir = dir.parent_path()) {
+                if (auto file = dir / ".python-version"; std::filesystem::exists(file, ec)) {
+                    version = read_whole_file(file.c_str());
+                    break;
+                }
+                if (dir == dir.root_path())
+                    break;
+            }
+        }
+
+        if (version.empty()) {
+            version = read_whole_file((root / "version").c_str());
+        }
+
+        // several versions may be listed, the first one that has the command wins
+        auto name = std::string_view{version}.substr(0, version.find_first_of(": \t\r\n"));
+        if (name.empty() || name == "system")
+            return real;
+
+        if (auto interpreter = root / "versions" / name / "bin" / real.filename(); std::filesystem::exists(interpreter, ec))
+            return canonical_or_self(interpreter);
+        return real;
+    }
+
+    /*
+     * "Python 3.11.7" of --version
+     */
+    std::string parse_python_version(const std::filesystem::path&, std::string_view line) {
+        if (!line.starts_with("Python "))
+            return {};
+        return std::string{first_token(line.substr(sizeof("Python ") - 1))};
+    }
+
+    /*
+     * python3 usually links to python3.X, which names the minor version only; the full one is in
+     * the parent directory of pyenv-like layouts, in PY_VERSION of the headers when they are
+     * installed and otherwise only the interpreter itself knows it
+     */
+    std::string read_python_version(const std::filesystem::path& executable) {
+        auto real = canonical_or_self(executable);
+        auto name = real.filename().string();
+        std::string minor = name.starts_with("python") ? name.substr(sizeof("python") - 1) : std::string{};
+        if (minor.find('.') == std::string::npos || minor.find_first_not_of("0123456789.") != std::string::npos) {
+            // a wrapper script or an unversioned name
+            return {};
+        }
+
+        // <prefix>/<version>/bin/pythonX.Y
+        const auto prefix = real.parent_path().parent_path();
+        if (auto version = prefix.filename().string(); version.starts_with(minor + ".") && version.find_first_not_of("0123456789.") == std::string::npos)
+            return version;
+
+        // #define PY_VERSION "3.11.2"
+        auto patchlevel = (prefix / "include" / name / "patchlevel.h").string();
+        if (auto value = find_field(read_whole_file(patchlevel.c_str()), "#define PY_VERSION", '"'); value.starts_with(minor + ".")) {
+            return std::string{value.substr(0, value.find('"'))};
+        }
+
+        return {};
+    }
+
+    bool is_rustup_proxy(const std::filesystem::path& rustc) {
+        std::error_code ec;
+        return std::filesystem::equivalent(rustc, rustc.parent_path() / "rustup", ec);
+    }
+
+    /*
+     * The rustc a rustup proxy runs: the RUSTUP_TOOLCHAIN one, else the default toolchain of
+     * settings.toml; anything else is the compiler itself
+     */
+    std::filesystem::path resolve_rustc(const std::filesystem::path& executable) {
+        auto rustc = canonical_or_self(executable);
+        if (!is_rustup_proxy(rustc))
+            return rustc;
+
+        std::filesystem::path rustup_home = holofetch::find_env_var("RUSTUP_HOME");
+        if (rustup_home.empty())
+            rustup_home = std::filesystem::path{holofetch::find_env_var("HOME")} / ".rustup";
+
+        std::string toolchain = holofetch::find_env_var("RUSTUP_TOOLCHAIN");
+        if (toolchain.empty()) {
+            auto settings = (rustup_home / "settings.toml").string();
+            auto value = find_field(read_whole_file(settings.c_str()), "default_toolchain", '=');
+            if (value.size() >= 2 && value.front() == '"' && value.back() == '"')
+                value = value.substr(1, value.size() - 2);
+            toolchain = value;
+        }
+
+        std::error_code ec;
+        if (auto active = rustup_home / "toolchains" / toolchain / "bin" / "rustc"; !toolchain.empty() && std::filesystem::exists(active, ec))
+            return active;
+        return rustc;
+    }
+
+    /*
+     * A rustup proxy carries rustup's own build compiler in .comment, only a toolchain's rustc
+     * is read; the proxy is left to answer --version when no toolchain could be resolved
+     */
+    std::string read_rustc_version(const std::filesystem::path& rustc) {
+        if (is_rustup_proxy(rustc))
+            return {};
+
+        for (const auto& comment : holofetch::metadata::read_elf_comments(rustc)) {
+            std::string_view c{comment};
+            if (c.starts_with("rustc version ")) {
+                return std::string{first_token(c.substr(sizeof("rustc version ") - 1))};
+            }
+        }
+        return {};
+    }
+
+    /*
+     * "rustc 1.75.0 (82e1608df 2023-12-21)"
+     */
+    std::string parse_rustc_version(const std::filesystem::path&, std::string_view line) {
+        if (!line.starts_with("rustc "))
+            return {};
+        return std::string{first_token(line.substr(sizeof("rustc ") - 1))};
+    }
+
+    /*
+     * pwsh is a native apphost next to pwsh.dll, which is a PE with a regular version resource
+     * ProductVersion looks like "7.4.1 SHA: 6a98b28..."
+     */
+    std::string read_pwsh_version(const std::filesystem::path& executable) {
+        auto dll = canonical_or_self(executable).parent_path() / "pwsh.dll";
+        if (auto pe = holofetch::metadata::read_pe_version(dll); pe && !pe->product_version.empty()) {
+            return pe->product_version.substr(0, pe->product_version.find(' '));
+        }
+        return {};
+    }
+
+    std::string parse_pwsh_version(const std::filesystem::path&, std::string_view line) {
+        if (!line.starts_with("PowerShell "))
+            return {};
+        return std::string{first_token(line.substr(sizeof("PowerShell ") - 1))};
+    }
+
+    /*
+     * The compiler name is part of the cc version here, software.cc stays empty
+     */
+    void my_fetch_versions(holofetch::software_info& software, holofetch::fact_cache& cache) {
+        const holofetch::tool_version_query tools[] = {
+            { .tool = "cc", .read = read_cc_version, .command = version_command, .parse = parse_cc_version },
+            { .tool = "rustc", .resolve = resolve_rustc, .read = read_rustc_version, .command = version_command, .parse = parse_rustc_version },
+            { .tool = "python3", .resolve = resolve_python, .read = read_python_version, .command = version_command, .parse = parse_python_version },
+            { .tool = "pwsh", .read = read_pwsh_version, .command = version_command, .parse = parse_pwsh_version }
+        };
+
+        auto versions = holofetch::cached_tool_versions(cache, tools, tool_version_ttl, version_probe_timeout);
+        software.c = std::move(versions[0]);
+        software.rust = std::move(versions[1]);
+        software.py = std::move(versions[2]);
+        software.pwsh = std::move(versions[3]);
+    }
+
+    inline holofetch::cpu_info my_fetch_cpu(holofetch::fact_cache& cache) {
+        holofetch::cpu_info info_;
+        info_.cores = std::thread::hardware_concurrency();
+
+        auto cached_name = cache.get("cpu.name");
+        auto cached_rate = cache.get("cpu.rate");
+        if (cached_name && cached_rate) {
+            info_.name = std::move(*cached_name);
+            info_.rate = static_cast<uint32_t>(parse_u64(*cached_rate));
+            return info_;
+        }
+
+        // nominal rate, like ~MHz on Windows, "cpu MHz" of cpuinfo is the current one
+        info_.rate = static_cast<uint32_t>(parse_u64(trim(read_whole_file("/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq"))) / 1000);
+
+        auto cpuinfo = read_whole_file("/proc/cpuinfo");
+        auto name = find_field(cpuinfo, "model name");
+        if (name.empty())
+            name = find_field(cpuinfo, "Model");
+        if (info_.rate == 0)
+            info_.rate = static_cast<uint32_t>(parse_u64(find_field(cpuinfo, "cpu MHz")));
+
+        if (name.empty()) {
+            info_.name = "N/A";
+            return info_;
+        }
+
+        info_.name = name;
+        cache.put("cpu.name", info_.name, hardware_name_ttl);
+        cache.put("cpu.rate", std::to_string(info_.rate), hardware_name_ttl);
+
+        return info_;
+    }
+
+    /*
+     * Kernel driver and PCI id of the first DRM card, naming the device would need pci.ids
+     */
+    inline holofetch::gpu_info my_fetch_gpu() {
+        holofetch::gpu_info info_;
+
+        auto uevent = read_whole_file("/sys/class/drm/card0/device/uevent");
+        auto driver = find_field(uevent, "DRIVER", '=');
+        auto pci_id = find_field(uevent, "PCI_ID", '=');
+
+        if (driver.empty()) {
+            info_.name = "N/A";
+        } else {
+            info_.name = driver;
+            if (!pci_id.empty()) {
+                info_.name += " [";
+                info_.name += pci_id;
+                info_.name += "]";
+            }
+        }
+
+        return info_;
+    }
+
+    inline holofetch::memory_info my_fetch_memory() {
+        holofetch::memory_info info_;
+
+        auto meminfo = read_whole_file("/proc/meminfo");
+        uint64_t total = parse_u64(find_field(meminfo, "MemTotal"));
+        auto available_field = find_field(meminfo, "MemAvailable");
+        uint64_t available = parse_u64(available_field.empty() ? find_field(meminfo, "MemFree") : available_field);
+
+        info_.totalMB = total / 1024;
+        info_.usedMB = info_.totalMB - std::min(info_.totalMB, available / 1024);
+        info_.percent = info_.totalMB ? static_cast<uint32_t>(info_.usedMB * 100 / info_.totalMB) : 0;
+
+        return info_;
+    }
+
+    inline holofetch::swap_info my_fetch_swap() {
+        holofetch::swap_info si;
+
+        auto meminfo = read_whole_file("/proc/meminfo");
+        uint64_t total = parse_u64(find_field(meminfo, "SwapTotal"));
+        uint64_t free = parse_u64(find_field(meminfo, "SwapFree"));
+
+        si.totalMB = total / 1024;
+        si.usedMB = si.totalMB - std::min(si.totalMB, free / 1024);
+        // the kernel keeps no system-wide swap peak, current usage is its lower bound
+        si.peakMB = si.usedMB;
+        si.percent = si.totalMB ? static_cast<uint32_t>(si.usedMB * 100 / si.totalMB) : 0;
+
+        return si;
+    }
+
+    /*
+     * Mount points escape whitespace as octal, e.g. "\040"
+     */
+    std::string decode_mount_point(std::string_view s) {
+        std::string out;
+        out.reserve(s.size());
+        for (size_t i = 0; i < s.size(); ++i) {
+            if (s[i] == '\\' && i + 3 < s.size()) {
+                int v = 0;
+                auto [ptr, ec] = std::from_chars(s.data() + i + 1, s.data() + i + 4, v, 8);
+                if (ec == std::errc{} && ptr == s.data() + i + 4) {
+                    out += static_cast<char>(v);
+                    i += 3;
+                    continue;
+                }
+            }
+            out += s[i];
+        }
+        return out;
+    }
+
+    inline std::vector<holofetch::disk_info> my_fetch_disks() {
+        std::vector<holofetch::disk_info> info_;
+        std::vector<std::string_view> devices;
+
+        auto mounts = read_whole_file("/proc/self/mounts");
+
+        size_t pos = 0;
+        while (pos < mounts.size()) {
+            size_t eol = mounts.find('\n', pos);
+            if (eol == std::string_view::npos)
+                eol = mounts.size();
+            auto line = mounts.substr(pos, eol - pos);
+            pos = eol + 1;
+
+            auto device = first_token(line);
+            auto rest = line.substr(std::min(line.size(), device.size() + 1));
+            auto mount_point = first_token(rest);
+
+            // block devices only, snaps and bind mounts of the same device once
+            if (!device.starts_with("/dev/") || device.starts_with("/dev/loop"))
+                continue;
+            if (std::find(devices.begin(), devices.end(), device) != devices.end())
+                continue;
+
+            auto path = decode_mount_point(mount_point);
+
+            struct statvfs st;
+            if (::statvfs(path.c_str(), &st) != 0 || st.f_blocks == 0)
+                continue;
+
+            uint64_t capacity_ = static_cast<uint64_t>(st.f_blocks) * st.f_frsize / 1024 / 1024;
+            uint64_t used_ = capacity_ - static_cast<uint64_t>(st.f_bfree) * st.f_frsize / 1024 / 1024;
+            if (capacity_ == 0)
+                continue;
+
+            devices.push_back(device);
+            info_.push_back(holofetch::disk_info{
+                .usedMB = used_,
+                .totalMB = capacity_,
+                .percent = static_cast<uint32_t>(used_ * 100 / capacity_),
+                .id = '/',
+                .path = std::move(path)
+            });
+        }
+
+        return info_;
+    }
+
+    inline holofetch::terminal_info my_fetch_terminal() {
+        holofetch::terminal_info info_;
+
+        if (struct utsname u; ::uname(&u) == 0) {
+            info_.hostname = u.nodename;
+        }
+
+        char buffer[1024];
+        struct passwd pw;
+        struct passwd* result = nullptr;
+        if (::getpwuid_r(::geteuid(), &pw, buffer, sizeof(buffer), &result) == 0 && result) {
+            info_.username = result->pw_name;
+        } else {
+            info_.username = holofetch::find_env_var("USER");
+        }
+
+        // terminal titles cannot be read back, the emulator name is the closest thing
+        info_.tab = holofetch::find_env_var("TERM_PROGRAM");
+        if (info_.tab.empty())
+            info_.tab = holofetch::find_env_var("TERM");
+
+        return info_;
+    }
+
+    inline std::string my_fetch_os(holofetch::fact_cache& cache) {
+        struct utsname u;
+        if (::uname(&u) != 0)
+            return {};
+
+        if (auto cached = cache.get("os", u.release); cached) {
+            return std::move(*cached);
+        }
+
+        auto name = find_field(read_whole_file("/etc/os-release"), "PRETTY_NAME", '=');
+        if (name.size() >= 2 && (name.front() == '"' || name.front() == '\'') && name.back() == name.front())
+            name = name.substr(1, name.size() - 2);
+
+        std::string os{name.empty() ? std::string_view{u.sysname} : name};
+        os += " (kernel ";
+        os += u.release;
+        os += ")";
+
+        cache.put("os", os, os_ttl, u.release);
+        return os;
+    }
+
+    inline std::chrono::milliseconds my_fetch_uptime() {
+        struct sysinfo si;
+        if (::sysinfo(&si) != 0)
+            return std::chrono::milliseconds{0};
+        return std::chrono::seconds{si.uptime};
+    }
+
+} // namespace
+
+
+std::string holofetch::convert_to_utf8(std::wstring_view wstr) {
+    // wchar_t holds whole code points here
+    std::string out;
+    out.reserve(wstr.size());
+    for (wchar_t wc : wstr) {
+        auto cp = static_cast<uint32_t>(wc);
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+    return out;
+}
+
+std::vector<holofetch::probe> holofetch::host_probes(host_info& info, fact_cache& cache) {
+    // process spawns first, they are the slowest
+    return {
+        {"versions", [&info, &cache] { my_fetch_versions(info.software, cache); }},
+        {"os",       [&info, &cache] { info.software.os = my_fetch_os(cache); }},
+        {"cpu",      [&info, &cache] { info.hardware.cpu = my_fetch_cpu(cache); }},
+        {"gpu",      [&info] { info.hardware.gpu = my_fetch_gpu(); }},
+        {"memory",   [&info] { info.hardware.mem = my_fetch_memory(); }},
+        {"swap",     [&info] { info.hardware.swap = my_fetch_swap(); }},
+        {"disks",    [&info] { info.hardware.disks = my_fetch_disks(); }},
+        {"terminal", [&info] { info.terminal = my_fetch_terminal(); }},
+        {"uptime",   [&info] { info.uptime = my_fetch_uptime(); }}
+    };
+}
+
+holofetch::host_info holofetch::query_host_info() {
+    host_info info_;
+    fact_cache cache;
+
+    probe_scheduler scheduler;
+    scheduler.add(host_probes(info_, cache));
+    scheduler.run();
+
+    return info_;
+}
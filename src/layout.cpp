@@ -0,0 +1,242 @@
+#include "holofetch/layout.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+namespace {
+
+    using holofetch::extent;
+    using holofetch::layout;
+    using holofetch::layout_input;
+    using holofetch::position;
+
+    constexpr size_t SECTIONS_DELIMITER_SPACES = 2;
+
+    // the avatar needs a console taller than this, and the header one taller than this minus
+    // the rows the avatar would have taken when it is left out
+    constexpr size_t AVATAR_MIN_CONSOLE_HEIGHT = 60;
+    constexpr size_t HEADER_MIN_CONSOLE_HEIGHT = 75;
+
+    // sections left at the left edge when neither the avatar nor the header is drawn
+    constexpr size_t LIST_INDENT = 4;
+
+    size_t centered(size_t outer, size_t inner) noexcept {
+        return outer > inner ? (outer - inner) / 2 : 0;
+    }
+
+    struct row {
+        size_t first;
+        size_t last;
+    };
+
+    /*
+     * One way of laying out the input, sized by arrange() and, when it has a layout to fill,
+     * placed as well; the rows are kept from one candidate to the next
+     */
+    class candidate {
+        const layout_input& in_;
+        std::pmr::vector<row> rows_;
+        std::pmr::vector<size_t> column_widths_;
+        layout* out_{nullptr};
+        extent size_;
+
+    public:
+        candidate(const layout_input& in, std::pmr::memory_resource* memory)
+            : in_{in}, rows_{memory}, column_widths_{memory} {}
+
+        std::optional<extent> arrange(bool portrait, size_t columns, layout* out) {
+            out_ = out;
+            size_ = {};
+
+            const extent& avatar = in_.avatar;
+            const bool draw_avatar = avatar.width > 0 && avatar.width < in_.console.width && in_.console.height > AVATAR_MIN_CONSOLE_HEIGHT;
+
+            if (!portrait) {
+                if (!draw_avatar)
+                    return std::nullopt;
+
+                const extent& header = in_.landscape_header;
+                pack_rows(columns, in_.console.width - avatar.width);
+
+                size_t content_height = header.height + 1;
+                size_t max_row_length = 0;
+                for (auto [first, last] : rows_) {
+                    content_height += in_.sections[first].height + 1;
+
+                    size_t row_length = 0;
+                    for (size_t i = first; i < last; ++i) {
+                        row_length += in_.sections[i].width + SECTIONS_DELIMITER_SPACES;
+                    }
+                    max_row_length = std::max(max_row_length, row_length);
+                }
+
+                // sections do not fit next to the avatar
+                if (content_height > avatar.height)
+                    return std::nullopt;
+
+                // vertical alignment
+                const size_t offset = (avatar.height - content_height) / 2;
+                const size_t header_tab = centered(max_row_length, header.width);
+
+                place_avatar({0, 0});
+                place_header({avatar.width + header_tab, offset}, header);
+                size_t y = place_rows(avatar.width, avatar.width + SECTIONS_DELIMITER_SPACES, offset + header.height + 1);
+
+                // one row of avatar below the sections at least
+                size_.height = std::max(avatar.height, y + 1);
+                return size_;
+            }
+
+            const extent& header = in_.portrait_header;
+            const bool draw_header = header.width < in_.console.width
+                && in_.console.height + (draw_avatar ? 0 : avatar.height) > HEADER_MIN_CONSOLE_HEIGHT;
+
+            size_t y = 0;
+            if (draw_avatar) {
+                place_avatar({centered(in_.console.width, avatar.width), 0});
+                y = avatar.height + 1;
+            } else if (draw_header) {
+                place_header({centered(in_.console.width, header.width), 0}, header);
+                y = header.height + 1;
+            }
+
+            if (!draw_avatar && !draw_header) {
+                // a plain list, columns make no difference
+                if (columns > 1)
+                    return std::nullopt;
+
+                for (size_t i = 0; i < in_.sections.size(); ++i) {
+                    if (y > 0) {
+                        ++y;
+                    }
+                    place_section(i, {LIST_INDENT, y});
+                    y += in_.sections[i].height;
+                }
+                size_.height = y;
+                return size_;
+            }
+
+            pack_rows(columns, in_.console.width);
+            size_.height = place_rows(0, centered(in_.console.width, avatar.width), y);
+            return size_;
+        }
+
+    private:
+        /*
+         * A section joins the row before it if that holds fewer than columns sections yet, both
+         * fit in width and it is not taller than the first one
+         */
+        void pack_rows(size_t columns, size_t width) {
+            rows_.clear();
+            size_t content_width = 0;
+
+            for (size_t i = 0; i < in_.sections.size(); ++i) {
+                const extent& s = in_.sections[i];
+
+                if (!rows_.empty() && i - rows_.back().first < columns
+                    && content_width + SECTIONS_DELIMITER_SPACES + s.width < width
+                    && s.height <= in_.sections[rows_.back().first].height) {
+                    rows_.back().last = i + 1;
+                    content_width += SECTIONS_DELIMITER_SPACES + s.width;
+                } else {
+                    rows_.push_back({i, i + 1});
+                    content_width = SECTIONS_DELIMITER_SPACES + s.width;
+                }
+            }
+
+            column_widths_.assign(columns, 0);
+            for (auto [first, last] : rows_) {
+                for (size_t i = first; i < last; ++i) {
+                    column_widths_[i - first] = std::max(column_widths_[i - first], in_.sections[i].width);
+                }
+            }
+        }
+
+        /*
+         * Rows from y down, each followed by a blank row
+         * A row of one section is centered in the console past left, the others start at
+         * first_tab in columns as wide as the widest section in them
+         */
+        size_t place_rows(size_t left, size_t first_tab, size_t y) {
+            for (auto [first, last] : rows_) {
+                const extent& front = in_.sections[first];
+
+                if (last - first == 1) {
+                    place_section(first, {left + centered(in_.console.width, front.width), y});
+                } else {
+                    size_t x = first_tab;
+                    for (size_t i = first; i < last; ++i) {
+                        place_section(i, {x, y});
+                        x += column_widths_[i - first] + SECTIONS_DELIMITER_SPACES;
+                    }
+                }
+
+                y += front.height + 1;
+            }
+            return y;
+        }
+
+        void place(position p, const extent& e) {
+            size_.width = std::max(size_.width, p.x + e.width);
+        }
+
+        void place_avatar(position p) {
+            place(p, in_.avatar);
+            if (out_)
+                out_->avatar = p;
+        }
+
+        void place_header(position p, const extent& header) {
+            place(p, header);
+            if (out_)
+                out_->header = p;
+        }
+
+        void place_section(size_t i, position p) {
+            place(p, in_.sections[i]);
+            if (out_)
+                out_->sections[i] = p;
+        }
+    };
+
+} // namespace
+
+namespace holofetch {
+
+    layout solve_layout(const layout_input& input, std::pmr::memory_resource* memory) {
+        candidate c{input, memory};
+
+        // fits the width, fits the height, landscape, lowest, fewest columns; the narrowest when nothing fits
+        using score = std::tuple<bool, size_t, bool, bool, size_t, size_t>;
+        std::optional<score> best;
+        bool portrait = true;
+        size_t columns = 1;
+
+        for (bool p : {false, true}) {
+            if (!p && input.portrait_only)
+                continue;
+
+            for (size_t k = 1; k <= std::max<size_t>(input.max_columns, 1); ++k) {
+                auto size = c.arrange(p, k, nullptr);
+                if (!size)
+                    continue;
+
+                const bool too_wide = size->width > input.console.width;
+                score s{too_wide, too_wide ? size->width : 0, size->height > input.console.height, p, size->height, k};
+                if (!best || s < *best) {
+                    best = s;
+                    portrait = p;
+                    columns = k;
+                }
+            }
+        }
+
+        layout result{memory};
+        result.portrait = portrait;
+        result.columns = columns;
+        result.sections.resize(input.sections.size());
+        result.size = c.arrange(portrait, columns, &result).value_or(extent{});
+        return result;
+    }
+
+} // namespace holofetch
@@ -1,13 +1,27 @@
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <csignal>
 #include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
 #include "argparse.hpp"
 
+#include "holofetch/avatar.hpp"
+#include "holofetch/daemon.hpp"
+#include "holofetch/default_avatar.hpp"
 #include "holofetch/info.hpp"
 #include "holofetch/network.hpp"
 #include "holofetch/renderer.hpp"
+#include "holofetch/probe.hpp"
 
 
 template <class T>
-std::string format_memory_info(const T& mem) {
+std::pmr::string format_memory_info(const T& mem, std::pmr::memory_resource* memory) {
     double used_ram = static_cast<double>(mem.usedMB) / 1000.;
     double total_ram = static_cast<double>(mem.totalMB) / 1000.;
     
@@ -18,20 +32,21 @@ std::string format_memory_info(const T& mem) {
         percent_color = holofetch::ANSI::fg_bright_red;
     }
 
-    auto s = std::vformat("{:0>3} GB / {:0>3} GB [ {}{}{}% ]", std::make_format_args(
+    std::pmr::string s{memory};
+    std::vformat_to(std::back_inserter(s), "{:0>3} GB / {:0>3} GB [ {}{}{}% ]", std::make_format_args(
         used_ram, total_ram,
         percent_color, mem.percent, holofetch::ANSI::reset
     ));
 
     if constexpr (requires (T t) { { t.peakMB }; }) {
         double peak = static_cast<double>(mem.peakMB) / 1000.;
-        s += std::vformat(" ^ {:0>3} GB", std::make_format_args(peak));
+        std::vformat_to(std::back_inserter(s), " ^ {:0>3} GB", std::make_format_args(peak));
     }
 
     return s;
 }
 
-std::string format_disk_info(const holofetch::disk_info& disk) {
+std::pmr::string format_disk_info(const holofetch::disk_info& disk, std::pmr::memory_resource* memory) {
     double used = static_cast<double>(disk.usedMB) / 1000.;
     double total = static_cast<double>(disk.totalMB) / 1000.;
     
@@ -54,17 +69,21 @@ std::string format_disk_info(const holofetch::disk_info& disk) {
         percent_color = holofetch::ANSI::fg_bright_red;
     }
 
-    return std::vformat("{:0>3} {} / {:0>3} {} [ {}{}{}% ]", std::make_format_args(
+    std::pmr::string s{memory};
+    std::vformat_to(std::back_inserter(s), "{:0>3} {} / {:0>3} {} [ {}{}{}% ]", std::make_format_args(
         used, used_suffix, 
         total, total_suffix,
         percent_color, disk.percent, holofetch::ANSI::reset
     ));
+    return s;
 }
 
-std::vector<holofetch::section> format_host_info_sections() {
-    auto host_info = holofetch::query_host_info();
-
-    std::vector<holofetch::section> sections;
+/*
+ * The sections and every string in them are allocated from memory
+ */
+std::pmr::vector<holofetch::section> format_host_info_sections(const holofetch::host_info& host_info, const holofetch::network::network_info& net_info, std::pmr::memory_resource* memory) {
+    std::pmr::vector<holofetch::section> sections{memory};
+    sections.reserve(5 + net_info.adapters.size());
 
     const auto ms = host_info.uptime.count() % 1000;
     const auto ss = std::chrono::duration_cast<std::chrono::seconds>(host_info.uptime).count() % 60;
@@ -72,31 +91,34 @@ std::vector<holofetch::section> format_host_info_sections() {
     const auto hh = std::chrono::duration_cast<std::chrono::hours>(host_info.uptime).count() % 24;
     const auto days = std::chrono::duration_cast<std::chrono::days>(host_info.uptime).count();
 
-    sections.emplace_back("Hardware", std::vector<std::pair<std::string, std::string>>{
-        {"CPU", host_info.hardware.cpu.name},
-        {"GPU", host_info.hardware.gpu.name},
-        {"RAM", format_memory_info(host_info.hardware.mem)},
-        {"Swap", format_memory_info(host_info.hardware.swap)}
-    });
+    auto& hardware_section = sections.emplace_back("Hardware");
+    hardware_section.properties.reserve(4);
+    hardware_section.properties.emplace_back("CPU", host_info.hardware.cpu.name);
+    hardware_section.properties.emplace_back("GPU", host_info.hardware.gpu.name);
+    hardware_section.properties.emplace_back("RAM", format_memory_info(host_info.hardware.mem, memory));
+    hardware_section.properties.emplace_back("Swap", format_memory_info(host_info.hardware.swap, memory));
 
-    auto& disks_section = sections.emplace_back("Disks", std::vector<std::pair<std::string, std::string>>{});
+    auto& disks_section = sections.emplace_back("Disks");
+    disks_section.properties.reserve(host_info.hardware.disks.size());
     for (const holofetch::disk_info& disk : host_info.hardware.disks) {
-        disks_section.properties.emplace_back(std::string(1, disk.id), format_disk_info(disk));
+        disks_section.properties.emplace_back(disk.path.empty() ? std::string_view{&disk.id, 1} : std::string_view{disk.path}, format_disk_info(disk, memory));
     }
 
-    auto& displays_section = sections.emplace_back("Displays", std::vector<std::pair<std::string, std::string>>{});
+    auto& displays_section = sections.emplace_back("Displays");
+    displays_section.properties.reserve(host_info.hardware.displays.size());
     for (const holofetch::display_info& display : host_info.hardware.displays) {
-        displays_section.properties.emplace_back(std::to_string(display.index), std::vformat("{}x{} {}Hz @ {}", 
+        auto& [index, mode] = displays_section.properties.emplace_back();
+        std::vformat_to(std::back_inserter(index), "{}", std::make_format_args(display.index));
+        std::vformat_to(std::back_inserter(mode), "{}x{} {}Hz @ {}", 
             std::make_format_args(display.width, display.height, display.frequency, display.name)
-        ));
+        );
     }
 
-    auto net_info = holofetch::network::query_network_info();
     for (const auto& adapter : net_info.adapters) {
-        auto& adapter_section = sections.emplace_back("Network Adapter", std::vector<std::pair<std::string, std::string>>{
-            {"Name", adapter.name},
-            {"MAC", adapter.mac}
-        });
+        auto& adapter_section = sections.emplace_back("Network Adapter");
+        adapter_section.properties.reserve(2 + adapter.ipv4.size() + adapter.ipv6.size());
+        adapter_section.properties.emplace_back("Name", adapter.name);
+        adapter_section.properties.emplace_back("MAC", adapter.mac);
 
         for (const auto& addr4 : adapter.ipv4) {
             if (addr4.empty())
@@ -111,16 +133,19 @@ std::vector<holofetch::section> format_host_info_sections() {
         }
     }
 
-    auto& software_section = sections.emplace_back("Software", std::vector<std::pair<std::string, std::string>>{
-        {"OS", host_info.software.os}
-    });
+    auto& software_section = sections.emplace_back("Software");
+    software_section.properties.reserve(5);
+    software_section.properties.emplace_back("OS", host_info.software.os);
 
     if (!host_info.software.pwsh.empty()) {
         software_section.properties.emplace_back("PowerShell", host_info.software.pwsh);
     }
 
     if (!host_info.software.c.empty()) {
-        software_section.properties.emplace_back("C/C++", "cl " + host_info.software.c);
+        auto& [name, version] = software_section.properties.emplace_back("C/C++", host_info.software.c);
+        if (!host_info.software.cc.empty()) {
+            version.insert(0, " ").insert(0, host_info.software.cc);
+        }
     }
 
     if (!host_info.software.py.empty()) {
@@ -131,24 +156,194 @@ std::vector<holofetch::section> format_host_info_sections() {
         software_section.properties.emplace_back("Rust", host_info.software.rust);
     }
 
-    sections.emplace_back("Terminal", std::vector<std::pair<std::string, std::string>>{
-        {"Tab", host_info.terminal.tab},
-        {"Host", host_info.terminal.hostname},
-        {"User", host_info.terminal.username},
-        {"Up", std::vformat("{}D {:0>2}h:{:0>2}m:{:0>2}s.{:0>3}ms", std::make_format_args(days, hh, mm, ss, ms))}
-    });
+    auto& terminal_section = sections.emplace_back("Terminal");
+    terminal_section.properties.reserve(4);
+    terminal_section.properties.emplace_back("Tab", host_info.terminal.tab);
+    terminal_section.properties.emplace_back("Host", host_info.terminal.hostname);
+    terminal_section.properties.emplace_back("User", host_info.terminal.username);
+    auto& [up, uptime] = terminal_section.properties.emplace_back("Up", "");
+    std::vformat_to(std::back_inserter(uptime), "{}D {:0>2}h:{:0>2}m:{:0>2}s.{:0>3}ms", std::make_format_args(days, hh, mm, ss, ms));
 
     return sections;
 }
 
+void print_probe_timings(const std::vector<holofetch::probe_timing>& timings) {
+    for (const auto& timing : timings) {
+        double ms = static_cast<double>(timing.elapsed.count()) / 1000.;
+        std::cerr << std::vformat("probe {:<10} {:>8.3f} ms", std::make_format_args(timing.name, ms));
+        if (!timing.error.empty()) {
+            std::cerr << " [ " << timing.error << " ]";
+        }
+        std::cerr << "\n";
+    }
+}
+
+/*
+ * Probes of what changes while holofetch is watching
+ */
+std::vector<holofetch::probe> live_probes(holofetch::host_info& host_info, holofetch::fact_cache& cache) {
+    std::vector<holofetch::probe> probes;
+    for (auto& probe : holofetch::host_probes(host_info, cache)) {
+        if (probe.name == "memory" || probe.name == "swap" || probe.name == "disks" || probe.name == "uptime") {
+            probes.push_back(std::move(probe));
+        }
+    }
+    return probes;
+}
+
+std::atomic<bool> stop_watching{false};
+
+extern "C" void on_stop_signal(int) {
+    stop_watching = true;
+    holofetch::console::wake();
+}
+
+/*
+ * Seconds between --watch redraws, from 50 ms, a frame is not drawn much faster than that,
+ * up to a day; std::nullopt for anything else or anything that is not a number
+ */
+std::optional<std::chrono::milliseconds> parse_watch_interval(std::string_view text) noexcept {
+    constexpr double shortest = 0.05;
+    constexpr double longest = 24. * 60. * 60.;
+
+    double seconds = 0.;
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), seconds);
+    if (ec != std::errc{} || end != text.data() + text.size())
+        return std::nullopt;
+
+    // also false for NaN
+    if (!(seconds >= shortest && seconds <= longest))
+        return std::nullopt;
+    return std::chrono::milliseconds{std::llround(seconds * 1000.)};
+}
+
+/*
+ * Sleeps for interval unless asked to stop meanwhile, laying the last frame out again whenever
+ * the terminal is resized; both wake it at once
+ */
+void wait_for_next_frame(std::chrono::milliseconds interval, holofetch::renderer& renderer) {
+    auto until = std::chrono::steady_clock::now() + interval;
+    while (!stop_watching) {
+        auto left = std::chrono::ceil<std::chrono::milliseconds>(until - std::chrono::steady_clock::now());
+        if (left <= std::chrono::milliseconds::zero())
+            break;
+
+        if (renderer.wait_resize(left)) {
+            renderer.relayout();
+        }
+    }
+}
+
+/*
+ * holofetch compile-avatar <input> [-o <output>] [--header <file> [--name <name>]]
+ */
+int compile_avatar(int ac, char** av) {
+    auto argparser = argparse::ArgumentParser("holofetch compile-avatar");
+
+    std::string input;
+    argparser.add_argument("input").help("ANSI art avatar to compile").store_into(input);
+
+    std::string output;
+    argparser.add_argument("-o", "--output").help("compiled avatar, defaults to the input with the .hfa extension").store_into(output);
+
+    std::string header;
+    argparser.add_argument("--header").help("write a C++ header that builds the avatar into the program instead").store_into(header);
+
+    std::string name = "default_avatar";
+    argparser.add_argument("--name").help("of the function in holofetch::assets the header defines").store_into(name);
+
+    try {
+        argparser.parse_args(ac, av);
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: could not parse arguments: " << e.what() << std::endl;
+        std::cerr << argparser;
+        return 1;
+    }
+
+    auto text = holofetch::read_file(input);
+    if (text.empty()) {
+        std::cerr << "ERROR: could not read " << input << std::endl;
+        return 2;
+    }
+
+    auto avatar = holofetch::compiled_avatar::compile(text);
+    if (!avatar) {
+        std::cerr << "ERROR: " << input << " holds escape sequences other than colors, or too many colors" << std::endl;
+        return 2;
+    }
+
+    if (!header.empty()) {
+        std::string command = "holofetch";
+        for (int i = 0; i < ac; ++i) {
+            command.append(" ").append(av[i]);
+        }
+
+        if (!avatar->save_header(header, name, command)) {
+            std::cerr << "ERROR: could not write " << header << std::endl;
+            return 2;
+        }
+
+        std::cout << header << ": " << avatar->width() << "x" << avatar->height() << " cells (" << text.size() << " bytes source)\n";
+        return 0;
+    }
+
+    std::filesystem::path output_file = output.empty() 
+        ? std::filesystem::path{input}.replace_extension(holofetch::compiled_avatar::extension)
+        : std::filesystem::path{output};
+    if (!avatar->save(output_file)) {
+        std::cerr << "ERROR: could not write " << output_file.string() << std::endl;
+        return 2;
+    }
+
+    std::cout << output_file.string() << ": " << avatar->width() << "x" << avatar->height() << " cells, " 
+        << avatar->bytes().size() << " bytes (" << text.size() << " bytes source)\n";
+    return 0;
+}
+
 int main(int ac, char** av) {
+    if (ac > 1 && std::string_view{av[1]} == "compile-avatar") {
+        return compile_avatar(ac - 1, av + 1);
+    }
+
     auto argparser = argparse::ArgumentParser("holofetch");
     
     std::string template_path; // = "C:\\Development\\Projects\\holofetch\\assets\\prerendered_image_data.utf.ans";
-    argparser.add_argument("template").store_into(template_path);
+    argparser.add_argument("template").help("ANSI art avatar, the built in one if left out")
+        .nargs(0, 1)
+        .default_value(std::string{})
+        .store_into(template_path);
 
     std::string texture;
     argparser.add_argument("--texture").store_into(texture);
+
+    bool stats = false;
+    argparser.add_argument("--stats").help("print per-probe timings and cache statistics to stderr").store_into(stats);
+
+    bool no_cache = false;
+    argparser.add_argument("--no-cache").help("do not read or write the host facts and compiled avatar caches").store_into(no_cache);
+
+    bool refresh = false;
+    argparser.add_argument("--refresh").help("ignore cached host facts and store fresh ones").store_into(refresh);
+
+    bool no_daemon = false;
+    argparser.add_argument("--no-daemon").help("probe the host even when holofetchd is running").store_into(no_daemon);
+
+    int width = 0;
+    argparser.add_argument("--width").help("lay out for this many columns instead of the terminal width").store_into(width);
+
+    int height = 0;
+    argparser.add_argument("--height").help("lay out for this many rows instead of the terminal height").store_into(height);
+
+    std::string watch;
+    argparser.add_argument("--watch").help("redraw every interval seconds (1 by default, 0.05 to 86400) until interrupted, as --watch or --watch=<interval>")
+        .nargs(0, 1)
+        .default_value(std::string{})
+        .store_into(watch);
+
+    std::string colors = "auto";
+    argparser.add_argument("--colors").help("color depth of the output, auto detects it from the terminal")
+        .choices("auto", "truecolor", "256", "16", "none")
+        .store_into(colors);
     
     // argparser.add_argument("--border-top");
     // argparser.add_argument("--border-left");
@@ -163,19 +358,109 @@ int main(int ac, char** av) {
         return 1;
     }
 
+    std::optional<std::chrono::milliseconds> watch_interval;
+    if (argparser.is_used("--watch")) {
+        watch_interval = watch.empty() ? std::chrono::milliseconds{1000} : parse_watch_interval(watch);
+        if (!watch_interval) {
+            std::cerr << "ERROR: --watch takes a number of seconds from 0.05 to 86400, not " << watch << std::endl;
+            return 1;
+        }
+    }
+
     try {
         
         holofetch::image avatar;
-        std::filesystem::path template_file{template_path};
-        
-        avatar.data = holofetch::read_file(template_file);
+        if (template_path.empty()) {
+            // compiled when holofetch was, nothing to read or parse
+            avatar.cells = holofetch::assets::default_avatar();
+        } else {
+            std::filesystem::path template_file{template_path};
+
+            auto avatar_cache = no_cache ? std::filesystem::path{} : holofetch::compiled_avatar::default_cache_directory();
+            avatar.cells = holofetch::compiled_avatar::load_or_compile(template_file, avatar_cache);
+            if (!avatar.cells) {
+                // art with escapes the compiler does not take is drawn as it is
+                avatar.data = holofetch::read_file(template_file);
+            }
+        }
         if (!texture.empty()) {
             avatar.texture = texture;
         }
 
+        holofetch::host_info host_info;
+        holofetch::network::network_info net_info;
+        std::vector<holofetch::probe_timing> timings;
+        std::optional<holofetch::fact_cache> cache;
+        std::optional<std::chrono::milliseconds> snapshot_age;
+
+        if (auto snapshot = no_daemon ? std::nullopt : holofetch::daemon::connect(); snapshot) {
+            auto age = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - snapshot->taken);
+            snapshot_age = age;
+
+            host_info = std::move(snapshot->host);
+            net_info = std::move(snapshot->network);
+            host_info.uptime += age;
+
+            // the terminal is ours, not the daemon's
+            holofetch::fact_cache no_cache;
+            for (auto& probe : holofetch::host_probes(host_info, no_cache)) {
+                if (probe.name == "terminal") {
+                    holofetch::probe_scheduler scheduler(1);
+                    scheduler.add(std::move(probe));
+                    timings = scheduler.run();
+                }
+            }
+        } else {
+            auto cache_mode = no_cache ? holofetch::cache_mode::disabled 
+                : refresh ? holofetch::cache_mode::refresh 
+                : holofetch::cache_mode::enabled;
+            cache.emplace(holofetch::fact_cache::default_path(), cache_mode);
+
+            holofetch::probe_scheduler scheduler;
+            scheduler.add(holofetch::host_probes(host_info, *cache));
+            scheduler.add({"network", [&net_info] { net_info = holofetch::network::query_network_info(); }});
+            timings = scheduler.run();
+
+            cache->save();
+        }
+
         auto renderer_ = holofetch::renderer();
+        renderer_.set_console_size(width > 0 ? width : 0, height > 0 ? height : 0);
+        if (auto depth = holofetch::sgr::parse_color_depth(colors); depth) {
+            renderer_.set_color_depth(*depth);
+        }
         renderer_.set_avatar(std::move(avatar));
-        renderer_.draw( format_host_info_sections() );
+        if (watch_interval) {
+            std::signal(SIGINT, on_stop_signal);
+            std::signal(SIGTERM, on_stop_signal);
+
+            holofetch::fact_cache no_cache;
+            renderer_.redraw( format_host_info_sections(host_info, net_info, renderer_.begin_frame()) );
+            while (!stop_watching) {
+                wait_for_next_frame(*watch_interval, renderer_);
+                if (stop_watching)
+                    break;
+
+                holofetch::probe_scheduler scheduler;
+                scheduler.add(live_probes(host_info, no_cache));
+                scheduler.run();
+                renderer_.redraw( format_host_info_sections(host_info, net_info, renderer_.begin_frame()) );
+            }
+            renderer_.end_redraw();
+        } else {
+            renderer_.draw( format_host_info_sections(host_info, net_info, renderer_.begin_frame()) );
+        }
+
+        if (stats) {
+            print_probe_timings(timings);
+            const auto& frame = renderer_.stats();
+            std::cerr << "frame " << frame.columns << "x" << frame.rows << " cells, " << frame.bytes << " bytes in " << frame.writes << " writes\n";
+            if (snapshot_age) {
+                std::cerr << "snapshot from holofetchd, " << snapshot_age->count() << " ms old\n";
+            } else {
+                std::cerr << "cache " << cache->hits() << " hits, " << cache->misses() << " misses (" << cache->file().string() << ")\n";
+            }
+        }
 
     } catch (const std::exception& e) {
         std::cerr << "ERROR: could not render holofetch: " << e.what() << std::endl;
@@ -0,0 +1,408 @@
+#include "holofetch/metadata.hpp"
+#include "holofetch/mapped_file.hpp"
+
+#include <algorithm>
+
+namespace {
+
+    using bytes = std::span<const std::byte>;
+
+    /*
+     * Bounds-checked integer reads, once a read goes out of range ok stays false
+     * and every following read returns 0
+     */
+    struct byte_reader {
+        bytes data;
+        bool big_endian{false};
+        bool ok{true};
+
+        uint64_t read(size_t offset, size_t width) noexcept {
+            if (!ok || offset > data.size() || width > data.size() - offset) {
+                ok = false;
+                return 0;
+            }
+
+            uint64_t v = 0;
+            for (size_t i = 0; i < width; ++i) {
+                uint64_t b = std::to_integer<uint64_t>(data[offset + i]);
+                v |= big_endian ? (b << (8 * (width - 1 - i))) : (b << (8 * i));
+            }
+            return v;
+        }
+
+        uint16_t u16(size_t offset) noexcept { return static_cast<uint16_t>(read(offset, 2)); }
+        uint32_t u32(size_t offset) noexcept { return static_cast<uint32_t>(read(offset, 4)); }
+        uint64_t u64(size_t offset) noexcept { return read(offset, 8); }
+    };
+
+    constexpr size_t align4(size_t v) noexcept {
+        return (v + 3) & ~size_t{3};
+    }
+
+    void append_utf8(std::string& out, uint32_t cp) {
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+
+    /*
+     * UTF-16LE up to the first NUL
+     */
+    std::string utf16_to_utf8(bytes data) {
+        byte_reader r{data};
+        std::string out;
+
+        for (size_t off = 0; off + 1 < data.size(); off += 2) {
+            uint32_t c = r.u16(off);
+            if (c == 0)
+                break;
+
+            if (c >= 0xD800 && c < 0xDC00 && off + 3 < data.size()) {
+                uint32_t low = r.u16(off + 2);
+                if (low >= 0xDC00 && low < 0xE000) {
+                    c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                    off += 2;
+                }
+            }
+            append_utf8(out, c);
+        }
+
+        return out;
+    }
+
+    /*
+     * Common header of VS_VERSIONINFO, StringFileInfo, StringTable and String:
+     *  WORD wLength; WORD wValueLength; WORD wType; WCHAR szKey[]; padding; value; padding; children
+     */
+    struct version_block {
+        std::string key;
+        bytes value;
+        bytes children;
+        uint16_t type{0};
+        size_t size{0};
+    };
+
+    std::optional<version_block> parse_version_block(bytes data) {
+        byte_reader r{data};
+        version_block block;
+
+        const size_t length = r.u16(0);
+        const size_t value_length = r.u16(2);
+        block.type = r.u16(4);
+        if (!r.ok || length < 6 || length > data.size())
+            return std::nullopt;
+
+        size_t off = 6;
+        for (;;) {
+            if (off + 2 > length)
+                return std::nullopt;
+            uint16_t c = r.u16(off);
+            off += 2;
+            if (c == 0)
+                break;
+            block.key += c < 0x80 ? static_cast<char>(c) : '?';
+        }
+        off = std::min(align4(off), length);
+
+        // text values are measured in WCHARs, binary ones in bytes
+        size_t value_size = std::min(block.type == 1 ? value_length * 2 : value_length, length - off);
+        block.value = data.subspan(off, value_size);
+
+        off = std::min(align4(off + value_size), length);
+        block.children = data.subspan(off, length - off);
+        block.size = align4(length);
+
+        return block;
+    }
+
+    template <class F>
+    void for_each_version_block(bytes data, F&& f) {
+        for (size_t off = 0; off < data.size();) {
+            auto block = parse_version_block(data.subspan(off));
+            if (!block)
+                break;
+            f(*block);
+            off += block->size;
+        }
+    }
+
+    std::optional<holofetch::metadata::pe_version> parse_version_info(bytes data) {
+        auto root = parse_version_block(data);
+        if (!root || root->key != "VS_VERSION_INFO")
+            return std::nullopt;
+
+        holofetch::metadata::pe_version version;
+
+        // VS_FIXEDFILEINFO
+        byte_reader fixed{root->value};
+        if (fixed.u32(0) == 0xFEEF04BD) {
+            uint32_t ms = fixed.u32(8);
+            uint32_t ls = fixed.u32(12);
+            if (fixed.ok) {
+                version.major = static_cast<uint16_t>(ms >> 16);
+                version.minor = static_cast<uint16_t>(ms & 0xFFFF);
+                version.build = static_cast<uint16_t>(ls >> 16);
+                version.revision = static_cast<uint16_t>(ls & 0xFFFF);
+            }
+        }
+
+        for_each_version_block(root->children, [&](const version_block& file_info) {
+            if (file_info.key != "StringFileInfo")
+                return;
+
+            for_each_version_block(file_info.children, [&](const version_block& table) {
+                for_each_version_block(table.children, [&](const version_block& string) {
+                    if (string.key == "ProductVersion" && version.product_version.empty()) {
+                        version.product_version = utf16_to_utf8(string.value);
+                    } else if (string.key == "FileVersion" && version.file_version.empty()) {
+                        version.file_version = utf16_to_utf8(string.value);
+                    }
+                });
+            });
+        });
+
+        return version;
+    }
+
+    std::string_view pe_machine_name(uint16_t machine) noexcept {
+        switch (machine) {
+            case 0x8664: return "x64";
+            case 0x014C: return "x86";
+            case 0xAA64: return "ARM64";
+            case 0x01C4: return "ARM";
+            default: return {};
+        }
+    }
+
+} // namespace
+
+namespace holofetch::metadata {
+
+    std::optional<pe_version> read_pe_version(std::span<const std::byte> image) noexcept {
+        try {
+            byte_reader r{image};
+
+            if (r.u16(0) != 0x5A4D) // MZ
+                return std::nullopt;
+
+            const size_t pe = r.u32(0x3C);
+            if (r.u32(pe) != 0x00004550 || !r.ok) // PE\0\0
+                return std::nullopt;
+
+            const size_t coff = pe + 4;
+            const uint16_t machine = r.u16(coff);
+            const uint16_t section_count = r.u16(coff + 2);
+            const uint16_t optional_size = r.u16(coff + 16);
+            const size_t optional = coff + 20;
+
+            size_t directory_count_offset = 0;
+            size_t directories_offset = 0;
+            switch (r.u16(optional)) {
+                case 0x10B: directory_count_offset = optional + 92; directories_offset = optional + 96; break;   // PE32
+                case 0x20B: directory_count_offset = optional + 108; directories_offset = optional + 112; break; // PE32+
+                default: return std::nullopt;
+            }
+
+            constexpr size_t IMAGE_DIRECTORY_ENTRY_RESOURCE = 2;
+            if (r.u32(directory_count_offset) <= IMAGE_DIRECTORY_ENTRY_RESOURCE)
+                return std::nullopt;
+
+            const uint32_t resources_rva = r.u32(directories_offset + IMAGE_DIRECTORY_ENTRY_RESOURCE * 8);
+            if (!r.ok || resources_rva == 0)
+                return std::nullopt;
+
+            const size_t section_table = optional + optional_size;
+            auto rva_to_offset = [&](uint32_t rva) -> std::optional<size_t> {
+                for (size_t i = 0; i < section_count; ++i) {
+                    const size_t s = section_table + i * 40;
+                    const uint32_t virtual_size = r.u32(s + 8);
+                    const uint32_t virtual_address = r.u32(s + 12);
+                    const uint32_t raw_size = r.u32(s + 16);
+                    const uint32_t raw_offset = r.u32(s + 20);
+                    if (!r.ok)
+                        return std::nullopt;
+
+                    if (rva >= virtual_address && rva - virtual_address < std::max(virtual_size, raw_size)) {
+                        if (rva - virtual_address >= raw_size)
+                            return std::nullopt; // zero-filled, not in the file
+                        return static_cast<size_t>(raw_offset) + (rva - virtual_address);
+                    }
+                }
+                return std::nullopt;
+            };
+
+            auto resources = rva_to_offset(resources_rva);
+            if (!resources)
+                return std::nullopt;
+
+            /*
+             * IMAGE_RESOURCE_DIRECTORY followed by named entries, then id entries
+             * Entry target with the high bit set is another directory, otherwise a data entry
+             */
+            auto find_entry = [&](size_t directory, std::optional<uint32_t> id) -> std::optional<uint32_t> {
+                const size_t named = r.u16(directory + 12);
+                const size_t ids = r.u16(directory + 14);
+                for (size_t i = 0; i < named + ids && r.ok; ++i) {
+                    const size_t e = directory + 16 + i * 8;
+                    const uint32_t name = r.u32(e);
+                    const uint32_t target = r.u32(e + 4);
+                    if (r.ok && (!id || (i >= named && name == *id)))
+                        return target;
+                }
+                return std::nullopt;
+            };
+
+            constexpr uint32_t RT_VERSION = 16;
+            constexpr uint32_t SUBDIRECTORY = 0x80000000;
+
+            // type -> name -> language -> data
+            size_t directory = *resources;
+            std::optional<uint32_t> target = find_entry(directory, RT_VERSION);
+            for (int level = 0; level < 2; ++level) {
+                if (!target || !(*target & SUBDIRECTORY))
+                    return std::nullopt;
+                directory = *resources + (*target & ~SUBDIRECTORY);
+                target = find_entry(directory, std::nullopt);
+            }
+            if (!target || (*target & SUBDIRECTORY))
+                return std::nullopt;
+
+            const size_t data_entry = *resources + *target;
+            const uint32_t data_rva = r.u32(data_entry);
+            const uint32_t data_size = r.u32(data_entry + 4);
+            if (!r.ok)
+                return std::nullopt;
+
+            auto data = rva_to_offset(data_rva);
+            if (!data || *data > image.size() || data_size > image.size() - *data)
+                return std::nullopt;
+
+            auto version = parse_version_info(image.subspan(*data, data_size));
+            if (version) {
+                version->machine = pe_machine_name(machine);
+            }
+            return version;
+        } catch (...) {
+            return std::nullopt;
+        }
+    }
+
+    std::optional<std::span<const std::byte>> find_elf_section(std::span<const std::byte> image, std::string_view name) noexcept {
+        if (image.size() < 16
+                || image[0] != std::byte{0x7F} || image[1] != std::byte{'E'}
+                || image[2] != std::byte{'L'} || image[3] != std::byte{'F'}) {
+            return std::nullopt;
+        }
+
+        const auto elf_class = std::to_integer<int>(image[4]);
+        const auto elf_data = std::to_integer<int>(image[5]);
+        if ((elf_class != 1 && elf_class != 2) || (elf_data != 1 && elf_data != 2))
+            return std::nullopt;
+
+        const bool is64 = elf_class == 2;
+        byte_reader r{image, elf_data == 2};
+
+        const uint64_t section_headers = is64 ? r.u64(0x28) : r.u32(0x20);
+        const uint16_t entry_size = is64 ? r.u16(0x3A) : r.u16(0x2E);
+        const uint16_t count = is64 ? r.u16(0x3C) : r.u16(0x30);
+        const uint16_t names_index = is64 ? r.u16(0x3E) : r.u16(0x32);
+        if (!r.ok || count == 0 || names_index >= count || entry_size < (is64 ? 0x40 : 0x28))
+            return std::nullopt;
+
+        struct section_header {
+            uint32_t name{0};
+            uint32_t type{0};
+            uint64_t offset{0};
+            uint64_t size{0};
+        };
+
+        auto section = [&](size_t i) {
+            const size_t h = section_headers + i * entry_size;
+            return section_header{
+                .name = r.u32(h),
+                .type = r.u32(h + 4),
+                .offset = is64 ? r.u64(h + 0x18) : r.u32(h + 0x10),
+                .size = is64 ? r.u64(h + 0x20) : r.u32(h + 0x14)
+            };
+        };
+
+        constexpr uint32_t SHT_NOBITS = 8;
+        auto section_bytes = [&](const section_header& h) -> std::optional<std::span<const std::byte>> {
+            if (h.type == SHT_NOBITS || h.offset > image.size() || h.size > image.size() - h.offset)
+                return std::nullopt;
+            return image.subspan(h.offset, h.size);
+        };
+
+        auto names = section_bytes(section(names_index));
+        if (!r.ok || !names)
+            return std::nullopt;
+
+        for (size_t i = 0; i < count && r.ok; ++i) {
+            auto h = section(i);
+            if (h.name >= names->size())
+                continue;
+
+            auto candidate = names->subspan(h.name);
+            auto end = std::find(candidate.begin(), candidate.end(), std::byte{0});
+            std::string_view section_name{reinterpret_cast<const char*>(candidate.data()), static_cast<size_t>(end - candidate.begin())};
+
+            if (section_name == name && r.ok)
+                return section_bytes(h);
+        }
+
+        return std::nullopt;
+    }
+
+    std::vector<std::string_view> read_elf_comments(std::span<const std::byte> image) {
+        std::vector<std::string_view> comments;
+
+        auto section = find_elf_section(image, ".comment");
+        if (!section)
+            return comments;
+
+        std::string_view content{reinterpret_cast<const char*>(section->data()), section->size()};
+        size_t lastpos = 0;
+        while (lastpos < content.size()) {
+            size_t pos = content.find('\0', lastpos);
+            if (pos == std::string_view::npos)
+                pos = content.size();
+
+            auto comment = content.substr(lastpos, pos - lastpos);
+            if (!comment.empty() && std::find(comments.begin(), comments.end(), comment) == comments.end())
+                comments.push_back(comment);
+
+            lastpos = pos + 1;
+        }
+
+        return comments;
+    }
+
+    std::optional<pe_version> read_pe_version(const std::filesystem::path& file) noexcept {
+        mapped_file image{file};
+        if (!image)
+            return std::nullopt;
+        return read_pe_version(image.bytes());
+    }
+
+    std::vector<std::string> read_elf_comments(const std::filesystem::path& file) {
+        mapped_file image{file};
+        if (!image)
+            return {};
+
+        auto comments = read_elf_comments(image.bytes());
+        return std::vector<std::string>(comments.begin(), comments.end());
+    }
+
+} // namespace holofetch::metadata
@@ -0,0 +1,239 @@
+#include "holofetch/network.hpp"
+
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <linux/if.h>
+#include <linux/if_arp.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+inline char halfbyte_to_hex(uint8_t v) {
+    return v < 10 ? ('0' + v) : ('A' + v - 10);
+}
+
+inline void append_byte_hex(std::string& s, uint8_t b) {
+    s += halfbyte_to_hex((b >> 4) & 0xf);
+    s += halfbyte_to_hex(b & 0xf);
+}
+
+namespace {
+
+    /*
+     * Link kinds that never face a real network (container plumbing, bridges, tunnels),
+     * skipped like Hyper-V adapters on Windows
+     */
+    constexpr std::string_view virtual_link_kinds[] = {
+        "bridge", "veth", "dummy", "vxlan", "geneve", "ifb", "nlmon"
+    };
+
+    class netlink_socket {
+        int fd_{-1};
+        uint32_t seq_{0};
+        std::vector<char> buffer_;
+    public:
+        netlink_socket() {
+            fd_ = ::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+            if (fd_ < 0)
+                throw std::runtime_error("could not open netlink socket: " + std::to_string(errno));
+
+            sockaddr_nl local{};
+            local.nl_family = AF_NETLINK;
+            if (::bind(fd_, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0) {
+                ::close(fd_);
+                throw std::runtime_error("could not bind netlink socket: " + std::to_string(errno));
+            }
+
+            // dumps come in chunks of at most a few pages each
+            buffer_.resize(32 * 1024);
+        }
+
+        ~netlink_socket() {
+            if (fd_ >= 0)
+                ::close(fd_);
+        }
+
+        netlink_socket(const netlink_socket&) = delete;
+        netlink_socket& operator=(const netlink_socket&) = delete;
+
+        /*
+         * One dump request, on_message is called for every answer until NLMSG_DONE
+         */
+        template <class F>
+        void dump(uint16_t type, uint8_t family, F&& on_message) {
+            struct {
+                nlmsghdr header;
+                rtgenmsg message;
+            } request{};
+
+            request.header.nlmsg_len = NLMSG_LENGTH(sizeof(rtgenmsg));
+            request.header.nlmsg_type = type;
+            request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+            request.header.nlmsg_seq = ++seq_;
+            request.message.rtgen_family = family;
+
+            sockaddr_nl kernel{};
+            kernel.nl_family = AF_NETLINK;
+
+            while (::sendto(fd_, &request, request.header.nlmsg_len, 0, reinterpret_cast<sockaddr*>(&kernel), sizeof(kernel)) < 0) {
+                if (errno != EINTR)
+                    throw std::runtime_error("could not send netlink request: " + std::to_string(errno));
+            }
+
+            for (;;) {
+                ssize_t n = ::recv(fd_, buffer_.data(), buffer_.size(), 0);
+                if (n < 0) {
+                    if (errno == EINTR)
+                        continue;
+                    throw std::runtime_error("could not receive netlink reply: " + std::to_string(errno));
+                }
+
+                int left = static_cast<int>(n);
+                for (auto* nh = reinterpret_cast<nlmsghdr*>(buffer_.data()); NLMSG_OK(nh, left); nh = NLMSG_NEXT(nh, left)) {
+                    if (nh->nlmsg_seq != seq_)
+                        continue;
+                    if (nh->nlmsg_type == NLMSG_DONE)
+                        return;
+                    if (nh->nlmsg_type == NLMSG_ERROR)
+                        throw std::runtime_error("netlink dump failed");
+                    on_message(nh);
+                }
+            }
+        }
+    };
+
+    std::string_view link_kind(const rtattr* linkinfo) noexcept {
+        int left = RTA_PAYLOAD(linkinfo);
+        for (auto* rta = static_cast<const rtattr*>(RTA_DATA(linkinfo)); RTA_OK(rta, left); rta = RTA_NEXT(rta, left)) {
+            if (rta->rta_type == IFLA_INFO_KIND) {
+                const char* kind = static_cast<const char*>(RTA_DATA(rta));
+                return {kind, strnlen(kind, RTA_PAYLOAD(rta))};
+            }
+        }
+        return {};
+    }
+
+    bool is_virtual_kind(std::string_view kind) noexcept {
+        for (auto k : virtual_link_kinds) {
+            if (k == kind)
+                return true;
+        }
+        return false;
+    }
+
+} // namespace
+
+namespace holofetch::network {
+
+    void rtnetlink_adapters::add_link(std::span<const std::byte> message) {
+        auto* nh = reinterpret_cast<const nlmsghdr*>(message.data());
+        if (message.size() < NLMSG_LENGTH(sizeof(ifinfomsg)) || nh->nlmsg_len > message.size() || nh->nlmsg_type != RTM_NEWLINK)
+            return;
+
+        auto* ifi = static_cast<const ifinfomsg*>(NLMSG_DATA(nh));
+        // Skip loopback adapters
+        if ((ifi->ifi_flags & IFF_LOOPBACK) || ifi->ifi_type == ARPHRD_LOOPBACK)
+            return;
+
+        adapter_info adapter_info;
+        std::string_view kind;
+
+        int left = IFLA_PAYLOAD(nh);
+        for (auto* rta = IFLA_RTA(ifi); RTA_OK(rta, left); rta = RTA_NEXT(rta, left)) {
+            switch (rta->rta_type) {
+                case IFLA_IFNAME: {
+                    const char* name = static_cast<const char*>(RTA_DATA(rta));
+                    adapter_info.name.assign(name, strnlen(name, RTA_PAYLOAD(rta)));
+                    break;
+                }
+                case IFLA_ADDRESS: {
+                    const auto* mac = static_cast<const uint8_t*>(RTA_DATA(rta));
+                    for (size_t i = 0; i < RTA_PAYLOAD(rta); ++i) {
+                        append_byte_hex(adapter_info.mac, mac[i]);
+                        adapter_info.mac += '-';
+                    }
+                    if (!adapter_info.mac.empty())
+                        adapter_info.mac.resize(adapter_info.mac.size() - 1);
+                    break;
+                }
+                case IFLA_LINKINFO:
+                    kind = link_kind(rta);
+                    break;
+            }
+        }
+
+        // Skip bridges, veth pairs and other virtual plumbing
+        if (is_virtual_kind(kind))
+            return;
+
+        if (adapter_info.name.empty())
+            adapter_info.name = "N/A";
+        adapter_info.description = kind.empty() ? std::string{"N/A"} : std::string{kind};
+
+        by_index_.emplace(ifi->ifi_index, info_.adapters.size());
+        info_.adapters.push_back(std::move(adapter_info));
+    }
+
+    void rtnetlink_adapters::add_address(std::span<const std::byte> message) {
+        auto* nh = reinterpret_cast<const nlmsghdr*>(message.data());
+        if (message.size() < NLMSG_LENGTH(sizeof(ifaddrmsg)) || nh->nlmsg_len > message.size() || nh->nlmsg_type != RTM_NEWADDR)
+            return;
+
+        auto* ifa = static_cast<const ifaddrmsg*>(NLMSG_DATA(nh));
+        auto it = by_index_.find(static_cast<int>(ifa->ifa_index));
+        if (it == by_index_.end())
+            return;
+
+        const rtattr* address = nullptr;
+        const rtattr* local = nullptr;
+
+        int left = IFA_PAYLOAD(nh);
+        for (auto* rta = IFA_RTA(ifa); RTA_OK(rta, left); rta = RTA_NEXT(rta, left)) {
+            if (rta->rta_type == IFA_ADDRESS)
+                address = rta;
+            else if (rta->rta_type == IFA_LOCAL)
+                local = rta;
+        }
+
+        // IFA_ADDRESS is the peer on point-to-point links, IFA_LOCAL is ours
+        const rtattr* own = local ? local : address;
+        if (!own)
+            return;
+
+        auto& adapter_info = info_.adapters[it->second];
+        if (ifa->ifa_family == AF_INET && RTA_PAYLOAD(own) >= sizeof(in_addr)) {
+            char str_buffer[INET_ADDRSTRLEN] = {0};
+            inet_ntop(AF_INET, RTA_DATA(own), str_buffer, sizeof(str_buffer));
+            adapter_info.ipv4.push_back(std::string{str_buffer});
+        } else if (ifa->ifa_family == AF_INET6 && RTA_PAYLOAD(own) >= sizeof(in6_addr)) {
+            char str_buffer[INET6_ADDRSTRLEN] = {0};
+            inet_ntop(AF_INET6, RTA_DATA(own), str_buffer, sizeof(str_buffer));
+            adapter_info.ipv6.push_back(std::string{str_buffer});
+        }
+    }
+
+    /*
+     * One RTM_GETLINK and one RTM_GETADDR dump, no matter how many interfaces there are
+     */
+    network_info query_network_info() {
+        rtnetlink_adapters adapters;
+        netlink_socket nl;
+
+        nl.dump(RTM_GETLINK, AF_UNSPEC, [&](nlmsghdr* nh) {
+            adapters.add_link({reinterpret_cast<const std::byte*>(nh), nh->nlmsg_len});
+        });
+        nl.dump(RTM_GETADDR, AF_UNSPEC, [&](nlmsghdr* nh) {
+            adapters.add_address({reinterpret_cast<const std::byte*>(nh), nh->nlmsg_len});
+        });
+
+        return adapters.take();
+    }
+
+}
@@ -0,0 +1,72 @@
+#include "holofetch/probe.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+    void run_probe(const holofetch::probe& p, holofetch::probe_timing& timing) noexcept {
+        timing.name = p.name;
+
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            p.run();
+        } catch (const std::exception& e) {
+            timing.error = e.what();
+        } catch (...) {
+            timing.error = "unknown error";
+        }
+        timing.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+
+} // namespace
+
+namespace holofetch {
+
+    void probe_scheduler::add(probe p) {
+        probes_.push_back(std::move(p));
+    }
+
+    void probe_scheduler::add(std::vector<probe>&& ps) {
+        for (auto& p : ps) {
+            probes_.push_back(std::move(p));
+        }
+        ps.clear();
+    }
+
+    std::vector<probe_timing> probe_scheduler::run() {
+        std::vector<probe_timing> timings(probes_.size());
+        if (probes_.empty())
+            return timings;
+
+        size_t threads = threads_;
+        if (threads == 0) {
+            threads = std::clamp<size_t>(std::thread::hardware_concurrency(), 2, 8);
+        }
+        threads = std::min(threads, probes_.size());
+
+        std::atomic<size_t> next{0};
+        auto worker = [&]() {
+            for (size_t i = next++; i < probes_.size(); i = next++) {
+                run_probe(probes_[i], timings[i]);
+            }
+        };
+
+        {
+            std::vector<std::jthread> pool;
+            pool.reserve(threads - 1);
+            for (size_t i = 1; i < threads; ++i) {
+                pool.emplace_back(worker);
+            }
+            // calling thread is a worker too
+            worker();
+        }
+
+        probes_.clear();
+        return timings;
+    }
+
+} // namespace holofetch
@@ -1,11 +1,8 @@
 #include "holofetch/renderer.hpp"
 
-#include <windows.h>
-#include <io.h>
-#include <fcntl.h>
-
+#include <cstdio>
+#include <algorithm>
 #include <iostream>
-#include <sstream>
 #include <vector>
 #include <format>
 #include <concepts>
@@ -13,7 +10,52 @@
 
 #include <cassert>
 
+#include "holofetch/ansi.hpp"
 #include "holofetch/assets.hpp"
+#include "holofetch/layout.hpp"
+#include "holofetch/sgr.hpp"
+#include "holofetch/unicode.hpp"
+
+namespace {
+
+    // sections side by side in a row at most
+    constexpr size_t MAX_SECTION_COLUMNS = 3;
+
+    std::string repeat(std::string_view str, size_t count) {
+        std::string s;
+        s.reserve(str.size() * count);
+        for (size_t i = 0; i < count; ++i) {
+            s.append(str);
+        }
+        return s;
+    }
+
+    size_t centered(size_t outer, size_t inner) noexcept {
+        return outer > inner ? (outer - inner) / 2 : 0;
+    }
+
+    /*
+     * The style a lone SGR sequence such as ANSI::fg_green sets
+     */
+    holofetch::sgr::style style_of(std::string_view sequence) noexcept {
+        holofetch::sgr::style s;
+        if (sequence.size() < 3 || !holofetch::sgr::apply(s, sequence.substr(2, sequence.size() - 3)))
+            return {};
+        return s;
+    }
+
+    /*
+     * Every other character of count dots, the border of the header
+     */
+    std::string dotted(size_t count) {
+        std::string s(count, '.');
+        for (size_t i = 1; i < count; i += 2) {
+            s[i] = ' ';
+        }
+        return s;
+    }
+
+} // namespace
 
 namespace holofetch {
 
@@ -40,37 +82,19 @@ namespace holofetch {
     }
 
     std::vector<std::string_view> split_lines(std::string_view content) {
-        if (content.empty())
-            return {};
-        
+        ansi::line_index index{content};
+
         std::vector<std::string_view> lines;
-        
-        size_t lastpos = 0;
-        size_t pos = content.find('\n');
-        while (pos != std::string_view::npos) {
-            if (auto ss = content.substr(lastpos, pos - lastpos); !ss.empty()) {
-                lines.push_back(ss);
-            }
-            lastpos = pos + 1;
-            pos = content.find('\n', lastpos);
+        lines.reserve(index.size());
+        for (size_t i = 0; i < index.size(); ++i) {
+            lines.push_back(index.view(i));
         }
 
-        if (lastpos < content.size())
-            lines.push_back(content.substr(lastpos + 1));
-
         return lines;
     }
 
     size_t get_line_length_excluding_ansi_sequences(std::string_view line) {
-        size_t line_length = 0;
-        for (size_t i = 0; i < line.size(); ++i) {
-            if (line[i] == '\033') {
-                i = line.find('m', i+1);
-                continue;
-            }
-            ++line_length;
-        }
-        return line_length;
+        return ansi::width(line);
     }
 
     size_t max_line_length_excluding_ansi_sequences(const std::vector<std::string_view>& lines) {
@@ -84,148 +108,95 @@ namespace holofetch {
     }
 
 
-    console::console() {
-        _setmode(_fileno(stdout), _O_U8TEXT);
-
-        CONSOLE_SCREEN_BUFFER_INFO csbi;
-        
-        handle = GetStdHandle(STD_OUTPUT_HANDLE);
-        assert(handle != INVALID_HANDLE_VALUE);
-
-        if (!GetConsoleScreenBufferInfo(handle, &csbi))
-            assert(false && "ERROR: GetConsoleScreenBufferInfo");
-
-        width = csbi.srWindow.Right - csbi.srWindow.Left + 1;
-        height = csbi.srWindow.Bottom - csbi.srWindow.Top + 1;
-    }
-
-    void console::put(std::string_view str) const {
-        if (str.empty())
-            return;
-        DWORD dummy = 0;
-        WriteConsoleA(handle, (const void*)str.data(), (DWORD)str.size(), &dummy, NULL);
-    }
-
-    void console::put(std::wstring_view wstr) const {
-        if (wstr.empty())
-            return;
-        DWORD dummy = 0;
-        WriteConsoleW(handle, (const void*)wstr.data(), (DWORD)wstr.size(), &dummy, NULL);
+    size_t frame::flush(const console& out) {
+        size_t writes = out.write(buffer_);
+        buffer_.clear();
+        return writes;
     }
 
 
-    bool prerender::draw(const console& out, std::string_view tab) {
-        if (_drawn_lines >= lines.size())
-            return false;
+    canvas image::render(const palette& palette, const sgr::style& base, std::pmr::memory_resource* memory) const {
+        if (data.empty() && !cells) 
+            return canvas{memory};
 
-        std::string_view line = lines[_drawn_lines++];
+        const ansi::line_index lines = cells ? ansi::line_index{} : ansi::line_index{data, base, memory};
 
-        out.put(tab);
-        out.put(line);
+        const size_t width = cells ? cells->width() : lines.width();
+        const size_t height = cells ? cells->height() : lines.size();
+        const size_t left = canvas::columns(border_left);
+        const size_t right = canvas::columns(border_right);
+        const size_t top = border_top.empty() ? 0 : 1;
+        const size_t bottom = border_bottom.empty() ? 0 : 1;
 
-        return true;
-    }
+        canvas c(std::max({left + width + right, canvas::columns(border_top), canvas::columns(border_bottom)}), top + height + bottom, memory);
 
-    bool prerender::drawln(const console& out, std::string_view tab) {
-        bool r = draw(out, tab);
-        if (r) {
-            out.put("\n");
-        }
-        return r;
-    }
-
-    bool prerender::draw(const console& out, size_t width_) { 
-        std::string_view tab;
-        if (width_ > this->width) {
-            tab = assets::whitespaces.substr(0, (width_ - this->width) / 2);
-        }
-        
-        return draw(out, tab);
-    }
-
-    bool prerender::drawln(const console& out, size_t width_) {
-        bool r = draw(out, width_);
-        if (r) {
-            out.put("\n");
-        }
-        return r;
-    }
-    
-    bool prerender::filldrawln(std::string_view color, const console& out, size_t width_) {
-        if (_drawn_lines >= lines.size())
-            return false;
-
-        std::string_view line = lines[_drawn_lines++];
-        
-        std::string_view tab;
-        if (width_ > this->width) {
-            tab = assets::whitespaces.substr(0, (width_ - this->width) / 2);
-        }
+        auto print_border = [&](size_t x, size_t y, std::string_view border, sgr::style& current) {
+            if (border.empty())
+                return;
+            c.print(x, y, palette.border, current);
+            c.print(x, y, border, current);
+            c.print(x, y, ANSI::reset, current);
+        };
 
-        out.put(tab);
-        auto colored_line = std::vformat("{}{}{}", std::make_format_args(color, line, ANSI::reset));
-        out.put(colored_line);
-        out.put("\n");
-
-        return true;
-    }
+        sgr::style current = base;
+        print_border(0, 0, border_top, current);
 
+        size_t texture_offset{0};
 
-    prerender image::render(const palette& palette) const {
-        if (data.empty()) 
-            return {};
+        if (cells) {
+            for (size_t y = 0; y < height; ++y) {
+                current = base;
+                print_border(0, top + y, border_left, current);
+
+                size_t x = left;
+                for (const auto& run : cells->row(y)) {
+                    const sgr::style s = cells->style_of(run);
+                    // a wide glyph takes its cell and the one after, as canvas::print places it
+                    const bool wide = unicode::codepoint_width(run.codepoint) == 2;
+                    for (size_t i = 0; i < run.length; ++i) {
+                        char32_t cp = run.codepoint;
+                        if (cp == '#' && !texture.empty()) {
+                            cp = static_cast<unsigned char>(texture[texture_offset]);
+                            texture_offset = (texture_offset + 1) % texture.size();
+                        }
+                        c.set(x++, top + y, cp, s);
+                        if (wide) {
+                            c.set(x++, top + y, canvas::wide_tail, s);
+                        }
+                    }
+                }
 
-        std::ostringstream ss;
-        
-        if (!border_top.empty()) {
-            ss << palette.border << border_top << ANSI::reset << "\n";
+                print_border(left + width, top + y, border_right, current);
+            }
         }
 
-        auto lines = split_lines(data);
-        size_t width = max_line_length_excluding_ansi_sequences(lines);
-
-        size_t texture_offset{0};
-        for (std::string_view line : lines) {
+        for (size_t y = 0; y < lines.size(); ++y) {
+            current = base;
+            print_border(0, top + y, border_left, current);
+            const size_t end = c.print(left, top + y, lines.view(y), current);
+            print_border(left + width, top + y, border_right, current);
 
-            std::string textured_line;
+            // the texture fills the cells printed from '#', so escape sequences keep theirs
             if (!texture.empty()) {
-                textured_line = std::string(line.data(), line.size());
-                for (char& c : textured_line) {
-                    if (c == '#') {
-                        c = texture[texture_offset];
-                        texture_offset = (texture_offset+1) % texture.size();
+                for (size_t x = left; x < end; ++x) {
+                    if (c.codepoint(x, top + y) == '#') {
+                        c.set(x, top + y, static_cast<unsigned char>(texture[texture_offset]), c.style(x, top + y));
+                        texture_offset = (texture_offset + 1) % texture.size();
                     }
                 }
             }
-            
-            if (!border_left.empty()) {
-                ss << palette.border << border_left << ANSI::reset;
-            }
-
-            ss << (textured_line.empty() ? line : std::string_view{textured_line});
-            if (size_t line_length = get_line_length_excluding_ansi_sequences(line); line_length < width) {
-                ss << assets::whitespaces.substr(0, (width - line_length) / 2);
-            }
-
-            if (!border_right.empty()) {
-                ss << palette.border << border_right << ANSI::reset;
-            }
-            ss << "\n";
         }
 
-        if (!border_bottom.empty()) {
-            ss << palette.border << border_bottom << ANSI::reset << "\n";
-        }
+        current = base;
+        print_border(0, top + height, border_bottom, current);
 
-        prerender r;
-        r.data = ss.str();
-        r.lines = split_lines(r.data);
-        r.width = max_line_length_excluding_ansi_sequences(r.lines);
-        r.height = r.lines.size();
-        return r;
+        return c;
     }
 
     std::pair<size_t, size_t> section::max_lengths() const noexcept {
+        if (lengths_)
+            return *lengths_;
+
         size_t max_key_length = 0;
         size_t max_value_length = 0;
         
@@ -239,14 +210,21 @@ namespace holofetch {
             }
         }
 
-        return {max_key_length, max_value_length};
+        lengths_.emplace(max_key_length, max_value_length);
+        return *lengths_;
     }
 
-    prerender section::render(const palette& palette, size_t mkl) const {
-        if (properties.empty()) 
-            return {};
+    size_t section::width() const noexcept {
+        if (properties.empty())
+            return 0;
 
-        std::ostringstream ss;
+        auto [m1, m2] = max_lengths();
+        return std::max(m1 + 2 + m2, 4 + get_line_length_excluding_ansi_sequences(header));
+    }
+
+    canvas section::render(const palette& palette, size_t mkl, std::pmr::memory_resource* memory) const {
+        if (properties.empty()) 
+            return canvas{memory};
 
         auto [max_key_length, max_value_length] = this->max_lengths();
         
@@ -254,56 +232,77 @@ namespace holofetch {
             max_key_length = mkl;
 
         const size_t width = max_key_length + 2 + max_value_length;
+        const size_t header_length = 4 + get_line_length_excluding_ansi_sequences(header);
+
+        // every line is padded to width, only the header can stick out
+        canvas c(std::max(width, header_length), properties.size() + 1, memory);
 
-        std::string_view tab = assets::whitespaces.substr(0, 2); // max_key_length);
-        // if (size_t header_length = header.size() + 4; header_length < width) {
-        //     tab = assets::whitespaces.substr(0, (width - header_length) / 2);
-        // }
+        sgr::style current;
+        size_t x = 0;
+        size_t y = 0;
 
-        // std::string hr(width + 2, '-');
-        // ss << "+" << hr << "+" << "\n";
+        auto put = [&](std::string_view text) {
+            x = c.print(x, y, text, current);
+        };
+
+        auto pad = [&](size_t count, char32_t cp) {
+            for (size_t i = 0; i < count; ++i) {
+                c.set(x++, y, cp, current);
+            }
+        };
 
         // - HEADER -
-        // ss << "| ";
-        ss << "{ " << palette.section << header << ANSI::reset << " }";
-        if (size_t current_length = 4 + header.size(); current_length < width ) {
-            ss << assets::whitespaces.substr(0, width - current_length);
+        put("{ ");
+        put(palette.section);
+        put(header);
+        put(ANSI::reset);
+        put(" }");
+        if (header_length < width) {
+            pad(width - header_length, ' ');
         }
-        // ss << " |";
-        ss << "\n";
 
         for (const auto& [key, value] : properties) {
-            auto current_tab = assets::dots.substr(0, max_key_length - key.size());
-            //ss << "| ";
-            ss << ANSI::fg_bright_black << current_tab << ANSI::reset << palette.property << key << ANSI::fg_bright_black << ": " << ANSI::reset << value;
+            x = 0;
+            ++y;
+
+            put(ANSI::fg_bright_black);
+            pad(max_key_length - get_line_length_excluding_ansi_sequences(key), '.');
+            put(ANSI::reset);
+            put(palette.property);
+            put(key);
+            put(ANSI::fg_bright_black);
+            put(": ");
+            put(ANSI::reset);
+            put(value);
             if (size_t current_length = max_key_length + 2 + get_line_length_excluding_ansi_sequences(value); current_length < width) {
-                ss << assets::whitespaces.substr(0, width - current_length);
+                pad(width - current_length, ' ');
             }
-            // ss << " |"; 
-            ss << "\n";
         }
-        
-        // ss << "+" << hr << "+" << "\n";
-
-        prerender r;
-        r.data = ss.str();
-        r.lines = split_lines(r.data);
-        r.width = max_line_length_excluding_ansi_sequences(r.lines);
-        r.height = r.lines.size();
-        return r;
-        
+
+        return c;
+    }
+
+    renderer::~renderer() {
+        end_redraw();
     }
 
     void renderer::set_avatar(image&& img) noexcept {
+        sprites_ready_ = false;
         avatar_.data = std::move(img.data);
+        avatar_.cells = std::move(img.cells);
         avatar_.texture = std::move(img.texture);
 
-        if (avatar_.texture.empty() && avatar_.data.find('#') != std::string::npos) {
+        const bool textured = avatar_.cells 
+            ? avatar_.cells->is_textured()
+            : avatar_.data.find('#') != std::string::npos;
+        if (avatar_.texture.empty() && textured) {
             avatar_.texture = assets::default_image_texture;
         }
         
         std::string_view avatar_front_line_ = std::string_view{avatar_.data}.substr(0, avatar_.data.find('\n'));
-        size_t avatar_width_ = get_line_length_excluding_ansi_sequences(avatar_front_line_);
+        size_t avatar_width_ = avatar_.cells && avatar_.cells->height() > 0
+            ? avatar_.cells->row_length(0)
+            : ansi::width(avatar_front_line_);
 
         /*
          * [border style: lines]
@@ -313,296 +312,199 @@ namespace holofetch {
          *  └─────┘
          */
 
-        // todo: support unicode characters
-        // avatar_.border_left = "│ ";
-        // avatar_.border_right = "│";
-        // avatar_.border_top = "┌" + std::string(avatar_width_ + 1, '─') + "┐";
-        // avatar_.border_bottom = "└" + std::string(avatar_width_ + 1, '─') + "┘";
-        
         if (bool enabled = false; enabled) {
-            avatar_.border_left = "{ ";
-            avatar_.border_right = "}";
-            avatar_.border_top = "+" + std::string(avatar_width_ + 1, '-') + "+";
-            avatar_.border_bottom = avatar_.border_top;
+            avatar_.border_left = "│ ";
+            avatar_.border_right = "│";
+            avatar_.border_top = "┌" + repeat("─", avatar_width_ + 1) + "┐";
+            avatar_.border_bottom = "└" + repeat("─", avatar_width_ + 1) + "┘";
         }
     }
 
-    void renderer::draw(const std::vector<section>& sections) {
-        if (avatar_.data.empty()) {
-            throw std::runtime_error("avatar image data is not available");
-        }
+    void renderer::draw(std::span<const section> sections) {
+        compose(canvas_, sections);
 
-        if (header_.data.empty()) {
-            header_.data = assets::default_header;
-        }
+        frame_.clear();
+        frame_.put(canvas_, con_.colors);
 
-        auto avatar_pr_ = avatar_.render(palette_);
+        stats_.columns = canvas_.width();
+        stats_.rows = canvas_.height();
+        stats_.bytes = frame_.size();
+        stats_.writes = frame_.flush(con_);
+    }
 
-        std::string_view header_front_line_ = std::string_view{header_.data}.substr(0, header_.data.find('\n')-1);
-        size_t header_width_ = get_line_length_excluding_ansi_sequences(header_front_line_);
+    void renderer::redraw(std::span<const section> sections) {
+        frame_.clear();
 
-        // if does not fit
-        if (!portrait_mode_ && (avatar_pr_.width + header_width_) >= con_.width) {
-            portrait_mode_ = true;
+        if (!live_) {
+            live_ = true;
+            con_.detect_synchronized_output();
+            con_.watch_resize();
+            frame_.put("\033[?1049h\033[?25l");
         }
 
-        const bool should_draw_avatar = avatar_pr_.width < con_.width && con_.height > 60;
-        if (!should_draw_avatar) {
-            portrait_mode_ = true;
-        }
+        // a frame that fits the console never has to grow the canvas again
+        con_.update_size();
+        canvas_.reserve(con_.width, con_.height);
+        compose(canvas_, sections);
+        present();
+    }
 
-        if (header_.border_bottom.empty()) {
-            /* 
-             * [border style: dots]
-             *  .......
-             *  :     :
-             *  :     :
-             *  :.....:
-             */
-            
-            size_t off = (avatar_pr_.width - header_width_) / 2;
-            header_.border_left = portrait_mode_ 
-                ? assets::whitespaces.substr(0, off)
-                : "  "; 
-            header_.border_right = portrait_mode_ 
-                ? assets::whitespaces.substr(0, off)
-                : "  ";
-            
-            header_.border_bottom = portrait_mode_ 
-                ? std::string(avatar_pr_.width, '.')
-                : std::string(header_.border_left.size() + header_width_ + header_.border_right.size() + 1, '.');
-            
-            bool toggle_ = false;
-            for (auto& c : header_.border_bottom) {
-                if (toggle_) {
-                    c = ' ';
-                }
-                toggle_ = !toggle_;
-            }
+    bool renderer::relayout() {
+        if (!live_ || !section_sprites_ || !con_.update_size())
+            return false;
 
-            // remove top border in portrait mode
-            if (!portrait_mode_)
-                header_.border_top = header_.border_bottom;
-        }
+        frame_.clear();
+        arrange(canvas_);
+        present();
+        return true;
+    }
 
-        auto header_pr_ = header_.render(palette_);
-        const bool should_draw_header = header_pr_.width < con_.width && con_.height > (should_draw_avatar ? 75 : 75 - avatar_pr_.height);
-
-        constexpr size_t SECTIONS_DELIMITER_SPACES = 2;
-
-        if (portrait_mode_) {
-            size_t con_width = con_.width;
-
-            if (should_draw_avatar) {
-                while (avatar_pr_.drawln(con_, con_width));
-                con_.put("\n");
-            } else if (should_draw_header) {
-                while (header_pr_.filldrawln(ANSI::fg_green, con_, con_width));
-                con_.put("\n");
-            } 
-            
-            if (!should_draw_avatar && !should_draw_header) {
-                bool first_ = true;
-                for (auto& section : sections) {
-                    auto pr = section.render(palette_);
-                    if (!first_) {
-                        con_.put("\n");
-                    }
-                    first_ = false;
-                    while (pr.drawln(con_, assets::whitespaces.substr(0, 4))); //, con_.width));
-                }
-                return;
-            }
+    void renderer::present() {
+        // rows past the bottom of the console would scroll it
+        screen_.resize(con_.width, con_.height);
+        screen_.blit(canvas_, 0, 0);
 
-            std::vector<prerender> section_prs;
-            section_prs.reserve(sections.size());
-
-            size_t content_width = SECTIONS_DELIMITER_SPACES;
-            size_t prev_section_height = static_cast<size_t>(-1);
-
-            std::vector<std::span<prerender>> rows;
-            size_t _row_start{ 0 };
-            
-            for (size_t i = 0; i < sections.size(); ++i) {
-                size_t w = sections[i].width();
-
-                if (i == 0) {
-                    section_prs.push_back(sections[i].render(palette_));
-                    content_width = SECTIONS_DELIMITER_SPACES + w;
-                    prev_section_height = sections[i].height();
-                    continue;
-                } else if ((i - _row_start) < 2 && (content_width + SECTIONS_DELIMITER_SPACES + w) < con_.width && sections[i].height() <= prev_section_height) {
-                    section_prs.push_back(sections[i].render(palette_));
-                    content_width = content_width + SECTIONS_DELIMITER_SPACES + w;
-                } else {
-                    section_prs.push_back(sections[i].render(palette_));
-                    content_width = SECTIONS_DELIMITER_SPACES + w;
-                    prev_section_height = sections[i].height();
-                    
-                    rows.push_back(std::span<prerender>{section_prs.data() + _row_start, section_prs.data() + i});
-                    _row_start = i;
-                }
-            }
+        if (previous_.width() != screen_.width() || previous_.height() != screen_.height()) {
+            previous_.resize(screen_.width(), screen_.height());
+            frame_.put("\033[H\033[2J");
+        }
 
-            rows.push_back(std::span<prerender>{section_prs.data() + _row_start, section_prs.data() + section_prs.size()});
+        const size_t unchanged = frame_.size();
+        if (con_.synchronized_output) {
+            frame_.put("\033[?2026h");
+        }
 
-            size_t max_offset_left{0};
-            for (auto& row : rows) {
-                if (row.front().width > max_offset_left)
-                    max_offset_left = row.front().width;
-            }
+        const size_t begin = frame_.size();
+        frame_.put(screen_, previous_, con_.colors);
 
-            std::string_view first_tab = assets::whitespaces.substr(0, (con_.width - avatar_pr_.width) / 2);
-            bool drawn;
-            for (auto& row : rows) {
-                std::string_view other_tab = assets::whitespaces.substr(0, (max_offset_left - row.front().width) + SECTIONS_DELIMITER_SPACES);
-                do {
-                    drawn = false;
+        if (frame_.size() == begin) {
+            frame_.truncate(unchanged);
+        } else if (con_.synchronized_output) {
+            frame_.put("\033[?2026l");
+        }
 
-                    if (row.size() == 1) {
-                        if (row.front().draw(con_, con_width)) {
-                            drawn = true;
-                        }
-                        else {
-                            con_.put(assets::whitespaces.substr(0, row.front().width + SECTIONS_DELIMITER_SPACES));
-                        }
-                    } else {
-                        bool first = true;
-                        for (auto& pr : row) {
-                            if (pr.draw(con_, first ? first_tab : other_tab)) {
-                                drawn = true;
-                            }
-                            else {
-                                con_.put(assets::whitespaces.substr(0, pr.width + SECTIONS_DELIMITER_SPACES));
-                            }
-                            first = false;
-                        }
-                    }
+        std::swap(previous_, screen_);
 
-                    con_.put("\n");
+        stats_.columns = canvas_.width();
+        stats_.rows = canvas_.height();
+        stats_.bytes = frame_.size();
+        stats_.writes = frame_.size() > 0 ? frame_.flush(con_) : 0;
+    }
 
-                } while (drawn);
-            }
+    void renderer::end_redraw() {
+        if (!live_)
+            return;
 
-        } else {
-            size_t con_width = con_.width;
-            std::vector<prerender> section_prs;
-            section_prs.reserve(sections.size());
-            
-            size_t content_width = SECTIONS_DELIMITER_SPACES;
-            size_t prev_section_height = static_cast<size_t>(-1);
-
-            std::vector<std::span<prerender>> rows;
-            size_t _row_start{ 0 };
-            
-            for (size_t i = 0; i < sections.size(); ++i) {
-                size_t w = sections[i].width();
-
-                if (i == 0) {
-                    section_prs.push_back(sections[i].render(palette_));
-                    content_width = SECTIONS_DELIMITER_SPACES + w;
-                    prev_section_height = sections[i].height();
-                    continue;
-                } else if ((i - _row_start) < 2 && (content_width + SECTIONS_DELIMITER_SPACES + w) < con_.width && sections[i].height() <= prev_section_height) {
-                    section_prs.push_back(sections[i].render(palette_));
-                    content_width = content_width + SECTIONS_DELIMITER_SPACES + w;
-                } else {
-                    section_prs.push_back(sections[i].render(palette_));
-                    content_width = SECTIONS_DELIMITER_SPACES + w;
-                    prev_section_height = sections[i].height();
-                    
-                    rows.push_back(std::span<prerender>{section_prs.data() + _row_start, section_prs.data() + i});
-                    _row_start = i;
-                }
-            }
+        live_ = false;
+        previous_.resize(0, 0);
+        con_.write("\033[?25h\033[?1049l");
+    }
 
-            rows.push_back(std::span<prerender>{section_prs.data() + _row_start, section_prs.data() + section_prs.size()});
+    void renderer::prepare_sprites() {
+        if (sprites_ready_)
+            return;
 
-            size_t content_height = header_pr_.height + 1;
-            for (auto row : rows) {
-                content_height += (row.front().height + 1);
-            }
-            
-            size_t max_offset_left{0};
-            size_t max_row_length{0};
-            for (auto& row : rows) {
-                if (row.front().width > max_offset_left)
-                    max_offset_left = row.front().width;
-                
-                size_t row_length{0};
-                for (auto& pr : row) {
-                    row_length += pr.width + SECTIONS_DELIMITER_SPACES;
-                }
+        if (avatar_.data.empty() && !avatar_.cells) {
+            throw std::runtime_error("avatar image data is not available");
+        }
 
-                if (row_length > max_row_length)
-                    max_row_length = row_length;
-            }
+        if (header_.data.empty()) {
+            header_.data = assets::default_header;
+        }
 
-            if (content_height > avatar_pr_.height) {
-                // restart in portrait mode
-                portrait_mode_ = true;
-                return this->draw(sections);
-            } else {
-                // vertical alignment
-                size_t offset = (avatar_pr_.height - content_height) / 2;
-                for (size_t i = 0; i < offset; ++i) {
-                    avatar_pr_.drawln(con_);
-                }
-            }
+        avatar_sprite_ = avatar_.render(palette_);
+        const size_t avatar_width = avatar_sprite_.width();
+
+        const ansi::line_index header_lines{header_.data};
+        const size_t header_width = header_lines.empty() ? 0 : header_lines[0].width;
+
+        /* 
+         * [border style: dots]
+         *  .......
+         *  :     :
+         *  :     :
+         *  :.....:
+         * 
+         * Next to the avatar the header is framed, above the sections it is centered over a
+         * bottom border as wide as the avatar
+         */
 
-            std::string_view header_tab;
-            if (max_row_length > header_pr_.width) {
-                header_tab = assets::whitespaces.substr(0, (max_row_length - header_pr_.width) / 2);
-            }
+        // the avatar cells are move-only, a header has none to copy
+        auto copy_header = [&] {
+            return image{
+                .data = header_.data,
+                .cells = std::nullopt,
+                .texture = header_.texture,
+                .border_left = header_.border_left,
+                .border_right = header_.border_right,
+                .border_top = header_.border_top,
+                .border_bottom = header_.border_bottom,
+            };
+        };
+
+        image landscape = copy_header();
+        image portrait = copy_header();
 
-            avatar_pr_.draw(con_);
-            con_.put(header_tab);
-            while (header_pr_.filldrawln(ANSI::fg_green, con_)) {
-                avatar_pr_.draw(con_);
-                con_.put(header_tab);
-            }
+        if (header_.border_bottom.empty()) {
+            landscape.border_left = "  ";
+            landscape.border_right = "  ";
+            landscape.border_bottom = dotted(2 + header_width + 2);
+            landscape.border_top = landscape.border_bottom;
+
+            const size_t off = centered(avatar_width, header_width);
+            portrait.border_left = std::string(off, ' ');
+            portrait.border_right = std::string(off, ' ');
+            portrait.border_bottom = dotted(avatar_width);
+        }
 
-            con_.put("\n");
-            avatar_pr_.draw(con_);
+        landscape_header_sprite_ = landscape.render(palette_, style_of(ANSI::fg_green));
+        portrait_header_sprite_ = portrait.render(palette_, style_of(ANSI::fg_green));
+        sprites_ready_ = true;
+    }
 
-            std::string_view first_tab = assets::whitespaces.substr(0, SECTIONS_DELIMITER_SPACES);
-            bool drawn;
-            for (auto& row : rows) {
-                std::string_view other_tab = assets::whitespaces.substr(0, (max_offset_left - row.front().width) + SECTIONS_DELIMITER_SPACES);
+    void renderer::compose(canvas& out, std::span<const section> sections) {
+        prepare_sprites();
 
-                do {
-                    drawn = false;
+        // sprites and their extents live in the frame's arena until the next begin_frame(), so
+        // that a resize can lay them out again after the sections are gone
+        auto* memory = arena_.resource();
 
-                    if (row.size() == 1) {
-                        if (row.front().draw(con_, con_width)) {
-                            drawn = true;
-                        }
-                        else {
-                            con_.put(assets::whitespaces.substr(0, row.front().width + SECTIONS_DELIMITER_SPACES));
-                        }
-                    } else {
-                        bool first = true;
-                        for (auto& pr : row) {
-                            if (pr.draw(con_, first ? first_tab : other_tab)) {
-                                drawn = true;
-                            }
-                            else {
-                                con_.put(assets::whitespaces.substr(0, pr.width + SECTIONS_DELIMITER_SPACES));
-                            }
-                            first = false;
-                        }
-                    }
+        auto& sprites = section_sprites_.emplace(memory);
+        auto& extents = section_extents_.emplace(memory);
+        sprites.reserve(sections.size());
+        extents.reserve(sections.size());
+        for (const auto& section : sections) {
+            extents.push_back({section.width(), section.properties.empty() ? 0 : section.height()});
+            sprites.push_back(section.render(palette_, 0, memory));
+        }
 
-                    con_.put("\n");
-                    avatar_pr_.draw(con_);
+        arrange(out);
+    }
 
-                } while (drawn);
-            }
+    void renderer::arrange(canvas& out) {
+        const layout_input input{
+            .console = {con_.width, con_.height},
+            .avatar = {avatar_sprite_.width(), avatar_sprite_.height()},
+            .landscape_header = {landscape_header_sprite_.width(), landscape_header_sprite_.height()},
+            .portrait_header = {portrait_header_sprite_.width(), portrait_header_sprite_.height()},
+            .sections = *section_extents_,
+            .max_columns = MAX_SECTION_COLUMNS,
+            .portrait_only = portrait_mode_,
+        };
+        const layout l = solve_layout(input, arena_.resource());
+
+        out.resize(l.size.width, l.size.height);
+
+        if (l.avatar) {
+            out.blit(avatar_sprite_, l.avatar->x, l.avatar->y);
+        }
 
-            con_.put("\n");
+        if (l.header) {
+            out.blit(l.portrait ? portrait_header_sprite_ : landscape_header_sprite_, l.header->x, l.header->y);
+        }
 
-            // draw remainder if any
-            while (avatar_pr_.drawln(con_));
+        for (size_t i = 0; i < section_sprites_->size(); ++i) {
+            out.blit((*section_sprites_)[i], l.sections[i].x, l.sections[i].y);
         }
     }
 }
@@ -0,0 +1,453 @@
+#include "holofetch/sgr.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace {
+
+    using holofetch::sgr::color;
+    using holofetch::sgr::style;
+    using enum holofetch::sgr::attribute;
+
+    // SGR codes that set the attribute, in bit order
+    constexpr std::array<int, 8> attribute_on{1, 2, 3, 4, 5, 7, 8, 9};
+
+    // SGR codes that clear it, 22 clears both bold and dim
+    constexpr std::array<int, 8> attribute_off{22, 22, 23, 24, 25, 27, 28, 29};
+
+    // attributes that change nothing on a blank cell as long as it is not underlined, inverted or struck through
+    constexpr uint16_t glyph_only = bold | dim | italic | blink;
+    constexpr uint16_t blank_visible = underline | inverse | strike;
+
+    constexpr color basic_color(int code) noexcept { return (1u << 24) | static_cast<uint32_t>(code); }
+    constexpr color indexed_color(int index) noexcept { return (2u << 24) | static_cast<uint32_t>(index); }
+    constexpr color rgb_color(int r, int g, int b) noexcept {
+        return (3u << 24) | (static_cast<uint32_t>(r) << 16) | (static_cast<uint32_t>(g) << 8) | static_cast<uint32_t>(b);
+    }
+
+    constexpr uint32_t color_kind(color c) noexcept { return c >> 24; }
+    constexpr int red(color c) noexcept { return (c >> 16) & 0xFF; }
+    constexpr int green(color c) noexcept { return (c >> 8) & 0xFF; }
+    constexpr int blue(color c) noexcept { return c & 0xFF; }
+
+    // xterm's defaults for the 16 basic colors, terminals differ but not by much
+    constexpr std::array<color, 16> basic_palette{
+        rgb_color(0, 0, 0), rgb_color(205, 0, 0), rgb_color(0, 205, 0), rgb_color(205, 205, 0),
+        rgb_color(0, 0, 238), rgb_color(205, 0, 205), rgb_color(0, 205, 205), rgb_color(229, 229, 229),
+        rgb_color(127, 127, 127), rgb_color(255, 0, 0), rgb_color(0, 255, 0), rgb_color(255, 255, 0),
+        rgb_color(92, 92, 255), rgb_color(255, 0, 255), rgb_color(0, 255, 255), rgb_color(255, 255, 255),
+    };
+
+    constexpr std::array<int, 6> cube_levels{0, 95, 135, 175, 215, 255};
+
+    /*
+     * Squared distance weighted by the mean red level ("redmean"),
+     * close enough to perceived difference for picking palette entries
+     */
+    constexpr int distance(int r1, int g1, int b1, int r2, int g2, int b2) noexcept {
+        int rmean = (r1 + r2) / 2;
+        int dr = r1 - r2;
+        int dg = g1 - g2;
+        int db = b1 - b2;
+        return (((512 + rmean) * dr * dr) >> 8) + 4 * dg * dg + (((767 - rmean) * db * db) >> 8);
+    }
+
+    constexpr int distance(int r, int g, int b, color c) noexcept {
+        return distance(r, g, b, red(c), green(c), blue(c));
+    }
+
+    /*
+     * RGB of an entry of the 256 color palette
+     */
+    constexpr color indexed_rgb(int index) noexcept {
+        if (index < 16)
+            return basic_palette[index];
+        if (index < 232) {
+            index -= 16;
+            return rgb_color(cube_levels[index / 36], cube_levels[(index / 6) % 6], cube_levels[index % 6]);
+        }
+        int level = 8 + 10 * (index - 232);
+        return rgb_color(level, level, level);
+    }
+
+    constexpr int nearest_cube_level(int v) noexcept {
+        return v < 48 ? 0 : v < 115 ? 1 : (v - 35) / 40;
+    }
+
+    /*
+     * Nearest of the 240 fixed entries (16-255), the first 16 are left out as the user's theme redefines them
+     */
+    constexpr uint8_t nearest_indexed(int r, int g, int b) noexcept {
+        int cr = nearest_cube_level(r);
+        int cg = nearest_cube_level(g);
+        int cb = nearest_cube_level(b);
+        int cube = 16 + 36 * cr + 6 * cg + cb;
+
+        int average = (r + g + b) / 3;
+        int step = average < 8 ? 0 : average > 238 ? 23 : (average - 3) / 10;
+        int gray = 232 + step;
+
+        return distance(r, g, b, indexed_rgb(gray)) < distance(r, g, b, indexed_rgb(cube)) ? gray : cube;
+    }
+
+    constexpr uint8_t nearest_basic(int r, int g, int b) noexcept {
+        uint8_t best = 0;
+        int best_distance = distance(r, g, b, basic_palette[0]);
+        for (uint8_t i = 1; i < basic_palette.size(); ++i) {
+            if (int d = distance(r, g, b, basic_palette[i]); d < best_distance) {
+                best = i;
+                best_distance = d;
+            }
+        }
+        return best;
+    }
+
+    /*
+     * Nearest palette entry for every RGB color quantized to bits per channel,
+     * looked up with the high bits of each channel and built on first use
+     */
+    template <int bits, uint8_t (*nearest)(int, int, int) noexcept>
+    class quantization_table {
+        std::vector<uint8_t> table_;
+    public:
+        quantization_table() : table_(size_t{1} << (3 * bits)) {
+            constexpr int center = 1 << (7 - bits);
+            for (size_t i = 0; i < table_.size(); ++i) {
+                int r = static_cast<int>((i >> (2 * bits)) << (8 - bits)) | center;
+                int g = static_cast<int>(((i >> bits) & ((1 << bits) - 1)) << (8 - bits)) | center;
+                int b = static_cast<int>((i & ((1 << bits) - 1)) << (8 - bits)) | center;
+                table_[i] = nearest(r, g, b);
+            }
+        }
+
+        uint8_t operator()(color c) const noexcept {
+            size_t i = (static_cast<size_t>(red(c) >> (8 - bits)) << (2 * bits))
+                | (static_cast<size_t>(green(c) >> (8 - bits)) << bits)
+                | static_cast<size_t>(blue(c) >> (8 - bits));
+            return table_[i];
+        }
+    };
+
+    // 32 KiB, the cube steps are 40 apart so 8 levels per bucket do not move anything far
+    const quantization_table<5, nearest_indexed>& indexed_table() {
+        static const quantization_table<5, nearest_indexed> table;
+        return table;
+    }
+
+    // 4 KiB, 16 colors are coarse enough for 16 levels per channel
+    const quantization_table<4, nearest_basic>& basic_table() {
+        static const quantization_table<4, nearest_basic> table;
+        return table;
+    }
+
+    color basic_code(uint8_t index, bool background) noexcept {
+        int code = index < 8 ? 30 + index : 90 + (index - 8);
+        return basic_color(background ? code + 10 : code);
+    }
+
+    /*
+     * c as the terminal can show it
+     */
+    color downsample(color c, holofetch::sgr::color_depth depth, bool background) {
+        using holofetch::sgr::color_depth;
+
+        if (c == 0 || depth == color_depth::truecolor)
+            return c;
+        if (depth == color_depth::none)
+            return 0;
+
+        switch (color_kind(c)) {
+            case 1:
+                return c;
+            case 2:
+                if (depth == color_depth::indexed)
+                    return c;
+                if (int index = blue(c); index < 16)
+                    return basic_code(static_cast<uint8_t>(index), background);
+                return basic_code(basic_table()(indexed_rgb(blue(c))), background);
+            case 3:
+                return depth == color_depth::indexed
+                    ? indexed_color(indexed_table()(c))
+                    : basic_code(basic_table()(c), background);
+        }
+        return c;
+    }
+
+    class params {
+        std::string_view text_;
+        bool done_{false};
+    public:
+        explicit params(std::string_view text) noexcept : text_(text) {}
+
+        // "1;" still holds an empty (0) parameter after the 1
+        bool empty() const noexcept { return done_; }
+
+        /*
+         * Next parameter, an empty one reads as 0 like terminals do
+         * nullopt on garbage
+         */
+        std::optional<int> next() noexcept {
+            size_t end = text_.find(';');
+            std::string_view p = text_.substr(0, end);
+            if (end == std::string_view::npos) {
+                text_ = {};
+                done_ = true;
+            } else {
+                text_ = text_.substr(end + 1);
+            }
+
+            if (p.empty())
+                return 0;
+            int v = 0;
+            auto [ptr, ec] = std::from_chars(p.data(), p.data() + p.size(), v);
+            if (ec != std::errc{} || ptr != p.data() + p.size())
+                return std::nullopt;
+            return v;
+        }
+    };
+
+    /*
+     * 38;5;n or 38;2;r;g;b after the 38/48 itself
+     */
+    std::optional<color> parse_extended_color(params& ps) noexcept {
+        auto kind = ps.next();
+        if (kind == 5) {
+            auto n = ps.next();
+            if (!n || *n < 0 || *n > 255)
+                return std::nullopt;
+            return indexed_color(*n);
+        }
+        if (kind == 2) {
+            auto r = ps.next();
+            auto g = ps.next();
+            auto b = ps.next();
+            if (!r || !g || !b || *r < 0 || *r > 255 || *g < 0 || *g > 255 || *b < 0 || *b > 255)
+                return std::nullopt;
+            return rgb_color(*r, *g, *b);
+        }
+        return std::nullopt;
+    }
+
+    style downsampled(style s, holofetch::sgr::color_depth depth) {
+        if (depth == holofetch::sgr::color_depth::none)
+            return {};
+        s.fg = downsample(s.fg, depth, false);
+        s.bg = downsample(s.bg, depth, true);
+        return s;
+    }
+
+    /*
+     * Returns false if the parameters hold anything not modelled by style, s is unspecified then
+     */
+    bool apply_parameters(style& s, std::string_view parameters) noexcept {
+        if (parameters.find(':') != std::string_view::npos)
+            return false;
+
+        params ps{parameters};
+        do {
+            auto code = ps.next();
+            if (!code)
+                return false;
+
+            int c = *code;
+            if (c == 0) {
+                s = {};
+            } else if (c == 22) {
+                s.attributes &= ~(bold | dim);
+            } else if ((c >= 30 && c <= 37) || (c >= 90 && c <= 97)) {
+                s.fg = basic_color(c);
+            } else if ((c >= 40 && c <= 47) || (c >= 100 && c <= 107)) {
+                s.bg = basic_color(c);
+            } else if (c == 39) {
+                s.fg = 0;
+            } else if (c == 49) {
+                s.bg = 0;
+            } else if (c == 38 || c == 48) {
+                auto extended = parse_extended_color(ps);
+                if (!extended)
+                    return false;
+                (c == 38 ? s.fg : s.bg) = *extended;
+            } else {
+                bool known = false;
+                for (size_t i = 0; i < attribute_on.size(); ++i) {
+                    if (c == attribute_on[i]) {
+                        s.attributes |= (1 << i);
+                        known = true;
+                        break;
+                    }
+                    if (c == attribute_off[i]) {
+                        s.attributes &= ~(1 << i);
+                        known = true;
+                        break;
+                    }
+                }
+                if (!known)
+                    return false;
+            }
+        } while (!ps.empty());
+
+        return true;
+    }
+
+    void append_number(std::string& out, uint32_t v) {
+        char buffer[10];
+        auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), v);
+        out.append(buffer, end);
+    }
+
+    void append_param(std::string& out, uint32_t v) {
+        if (!out.empty())
+            out += ';';
+        append_number(out, v);
+    }
+
+    void append_color(std::string& out, color c, bool background) {
+        switch (c >> 24) {
+            case 0:
+                append_param(out, background ? 49 : 39);
+                break;
+            case 1:
+                append_param(out, c & 0xFF);
+                break;
+            case 2:
+                append_param(out, background ? 48 : 38);
+                out += ";5;";
+                append_number(out, c & 0xFF);
+                break;
+            case 3:
+                append_param(out, background ? 48 : 38);
+                out += ";2;";
+                append_number(out, (c >> 16) & 0xFF);
+                out += ';';
+                append_number(out, (c >> 8) & 0xFF);
+                out += ';';
+                append_number(out, c & 0xFF);
+                break;
+        }
+    }
+
+    /*
+     * Parameters that take the terminal from `from` to `to` without a reset
+     */
+    std::string delta_parameters(const style& from, const style& to) {
+        std::string ps;
+
+        uint16_t cleared = from.attributes & ~to.attributes;
+        uint16_t set = to.attributes & ~from.attributes;
+
+        // 22 takes bold and dim together, put back the one that stays
+        if (cleared & (bold | dim)) {
+            append_param(ps, 22);
+            set |= to.attributes & (bold | dim);
+            cleared &= ~(bold | dim);
+        }
+
+        for (size_t i = 0; i < attribute_off.size(); ++i) {
+            if (cleared & (1 << i))
+                append_param(ps, attribute_off[i]);
+        }
+        for (size_t i = 0; i < attribute_on.size(); ++i) {
+            if (set & (1 << i))
+                append_param(ps, attribute_on[i]);
+        }
+
+        if (from.fg != to.fg)
+            append_color(ps, to.fg, false);
+        if (from.bg != to.bg)
+            append_color(ps, to.bg, true);
+
+        return ps;
+    }
+
+    /*
+     * Parameters that set `to` from scratch, starting with a reset
+     */
+    std::string reset_parameters(const style& to) {
+        std::string ps{"0"};
+        for (size_t i = 0; i < attribute_on.size(); ++i) {
+            if (to.attributes & (1 << i))
+                append_param(ps, attribute_on[i]);
+        }
+        if (to.fg)
+            append_color(ps, to.fg, false);
+        if (to.bg)
+            append_color(ps, to.bg, true);
+        return ps;
+    }
+
+} // namespace
+
+namespace holofetch::sgr {
+
+    bool apply(style& s, std::string_view parameters) noexcept {
+        return apply_parameters(s, parameters);
+    }
+
+    void append_transition(std::string& out, const style& from, const style& to) {
+        if (from == to)
+            return;
+
+        std::string delta = delta_parameters(from, to);
+        std::string reset = reset_parameters(to);
+        std::string_view ps = reset.size() < delta.size() ? reset : delta;
+
+        out += "\033[";
+        out.append(ps);
+        out += 'm';
+    }
+
+    std::optional<color_depth> parse_color_depth(std::string_view name) noexcept {
+        if (name == "truecolor" || name == "24bit")
+            return color_depth::truecolor;
+        if (name == "256")
+            return color_depth::indexed;
+        if (name == "16")
+            return color_depth::basic;
+        if (name == "none")
+            return color_depth::none;
+        return std::nullopt;
+    }
+
+    encoder::encoder(std::string& out, color_depth depth) noexcept
+        : out_(out)
+        , depth_(depth)
+    {}
+
+    void encoder::set(const style& s) {
+        wanted_ = downsampled(s, depth_);
+    }
+
+    void encoder::blank() {
+        if (!(wanted_.attributes & blank_visible)) {
+            // foreground, bold and friends can wait for the next glyph
+            style target = wanted_;
+            target.fg = current_.fg;
+            target.attributes = (current_.attributes & glyph_only) | (wanted_.attributes & ~glyph_only);
+            sync(target);
+        } else {
+            sync(wanted_);
+        }
+        out_ += ' ';
+    }
+
+    void encoder::glyph(std::string_view bytes) {
+        sync(wanted_);
+        out_.append(bytes);
+    }
+
+    void encoder::finish() {
+        sync(wanted_);
+    }
+
+    void encoder::sync(const style& target) {
+        if (current_ == target)
+            return;
+
+        append_transition(out_, current_, target);
+        current_ = target;
+    }
+
+} // namespace holofetch::sgr
@@ -0,0 +1,187 @@
+#include "holofetch/shared_memory.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#ifdef _WIN32
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN 1
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace holofetch {
+
+#ifdef _WIN32
+
+    /*
+     * Mappings backed by the paging file live as long as a handle to them does,
+     * the creator keeps one and nothing has to be removed
+     */
+    shared_memory shared_memory::create(std::string name, size_t size) noexcept {
+        shared_memory segment;
+
+        const std::wstring wide_name(name.begin(), name.end());
+        HANDLE mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+            static_cast<DWORD>(static_cast<uint64_t>(size) >> 32), static_cast<DWORD>(size), wide_name.c_str());
+        if (!mapping)
+            return segment;
+
+        // the name is taken, by a running owner since mappings do not outlive their handles
+        if (GetLastError() == ERROR_ALREADY_EXISTS) {
+            CloseHandle(mapping);
+            return segment;
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+        if (!view) {
+            CloseHandle(mapping);
+            return segment;
+        }
+
+        segment.data_ = static_cast<std::byte*>(view);
+        segment.size_ = size;
+        segment.name_ = std::move(name);
+        segment.owner_ = true;
+        segment.mapping_ = mapping;
+        std::fill_n(segment.data_, size, std::byte{0});
+        return segment;
+    }
+
+    shared_memory shared_memory::open(std::string name) noexcept {
+        shared_memory segment;
+
+        // Local\ names are private to the logon session
+        const std::wstring wide_name(name.begin(), name.end());
+        HANDLE mapping = OpenFileMappingW(FILE_MAP_READ, FALSE, wide_name.c_str());
+        if (!mapping)
+            return segment;
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            return segment;
+        }
+
+        MEMORY_BASIC_INFORMATION info;
+        if (!VirtualQuery(view, &info, sizeof(info))) {
+            UnmapViewOfFile(view);
+            CloseHandle(mapping);
+            return segment;
+        }
+
+        segment.data_ = static_cast<std::byte*>(view);
+        segment.size_ = info.RegionSize;
+        segment.name_ = std::move(name);
+        segment.mapping_ = mapping;
+        return segment;
+    }
+
+    void shared_memory::unmap() noexcept {
+        if (data_) UnmapViewOfFile(data_);
+        if (mapping_) CloseHandle(mapping_);
+        data_ = nullptr;
+        size_ = 0;
+        mapping_ = nullptr;
+        owner_ = false;
+    }
+
+#else
+
+    shared_memory shared_memory::create(std::string name, size_t size) noexcept {
+        shared_memory segment;
+
+        // a segment left behind by a crashed owner is taken over, callers make sure no owner is running
+        ::shm_unlink(name.c_str());
+        int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+        if (fd < 0)
+            return segment;
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            return segment;
+        }
+
+        void* view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (view == MAP_FAILED) {
+            ::shm_unlink(name.c_str());
+            return segment;
+        }
+
+        segment.data_ = static_cast<std::byte*>(view);
+        segment.size_ = size;
+        segment.name_ = std::move(name);
+        segment.owner_ = true;
+        return segment;
+    }
+
+    shared_memory shared_memory::open(std::string name) noexcept {
+        shared_memory segment;
+
+        int fd = ::shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0);
+        if (fd < 0)
+            return segment;
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_uid != ::getuid() || st.st_size == 0) {
+            ::close(fd);
+            return segment;
+        }
+
+        void* view = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (view == MAP_FAILED)
+            return segment;
+
+        segment.data_ = static_cast<std::byte*>(view);
+        segment.size_ = static_cast<size_t>(st.st_size);
+        segment.name_ = std::move(name);
+        return segment;
+    }
+
+    void shared_memory::unmap() noexcept {
+        if (data_) ::munmap(data_, size_);
+        if (owner_) ::shm_unlink(name_.c_str());
+        data_ = nullptr;
+        size_ = 0;
+        owner_ = false;
+    }
+
+#endif
+
+    shared_memory::~shared_memory() {
+        unmap();
+    }
+
+    shared_memory::shared_memory(shared_memory&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr))
+        , size_(std::exchange(other.size_, 0))
+        , name_(std::move(other.name_))
+        , owner_(std::exchange(other.owner_, false))
+#ifdef _WIN32
+        , mapping_(std::exchange(other.mapping_, nullptr))
+#endif
+    {}
+
+    shared_memory& shared_memory::operator=(shared_memory&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            name_ = std::move(other.name_);
+            owner_ = std::exchange(other.owner_, false);
+#ifdef _WIN32
+            mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+} // namespace holofetch
@@ -1,147 +1,529 @@
 #include "holofetch/subprocess.hpp"
 
+#include <atomic>
+#include <cstdio>
+#include <optional>
+
 #ifndef WIN32_LEAN_AND_MEAN
 #   define WIN32_LEAN_AND_MEAN 1
 #endif
 #include <windows.h>
 
-namespace holofetch::subprocess {
-    /* 
-     * source:
-     *  https://stackoverflow.com/questions/478898/how-do-i-execute-a-command-and-get-the-output-of-the-command-within-c-using-po
+namespace {
+
+    /*
+     * Milliseconds left until deadline in a form the wait functions accept
+     */
+    DWORD wait_milliseconds(std::chrono::steady_clock::time_point deadline) noexcept {
+        if (deadline == std::chrono::steady_clock::time_point::max())
+            return INFINITE;
+
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+        if (left <= 0)
+            return 0;
+        if (left >= static_cast<long long>(INFINITE))
+            return INFINITE - 1;
+        return static_cast<DWORD>(left);
+    }
+
+    std::chrono::steady_clock::time_point make_deadline(std::chrono::milliseconds timeout) noexcept {
+        auto now = std::chrono::steady_clock::now();
+        if (timeout >= std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::time_point::max() - now))
+            return std::chrono::steady_clock::time_point::max();
+        return now + timeout;
+    }
+
+    /*
+     * Job object that takes the whole process tree down with it,
+     * so grandchildren holding our pipes cannot keep the readers alive
+     */
+    HANDLE create_kill_on_close_job() noexcept {
+        HANDLE job = CreateJobObjectW(nullptr, nullptr);
+        if (!job)
+            return nullptr;
+
+        JOBOBJECT_EXTENDED_LIMIT_INFORMATION limits;
+        ZeroMemory(&limits, sizeof(limits));
+        limits.BasicLimitInformation.LimitFlags = JOB_OBJECT_LIMIT_KILL_ON_JOB_CLOSE;
+        if (!SetInformationJobObject(job, JobObjectExtendedLimitInformation, &limits, sizeof(limits))) {
+            CloseHandle(job);
+            return nullptr;
+        }
+
+        return job;
+    }
+
+    /*
+     * Anonymous pipes cannot do overlapped I/O, so each one is a uniquely named pipe
+     * The read end stays in this process, only the write end is inheritable
      */
-    auto run(std::string_view command, const std::filesystem::path& working_directory) noexcept -> std::expected<result, std::errc> {
-        int                  Success;
-        SECURITY_ATTRIBUTES  security_attributes;
-        HANDLE               stdout_rd = INVALID_HANDLE_VALUE;
-        HANDLE               stdout_wr = INVALID_HANDLE_VALUE;
-        HANDLE               stderr_rd = INVALID_HANDLE_VALUE;
-        HANDLE               stderr_wr = INVALID_HANDLE_VALUE;
-        PROCESS_INFORMATION  process_info;
-        STARTUPINFOA         startup_info;
-        std::jthread         stdout_thread;
-        std::jthread         stderr_thread;
-
-        std::ostringstream stdout_stream;
-        std::ostringstream stderr_stream;
-        int code;
+    bool create_overlapped_pipe(HANDLE& read_end, HANDLE& write_end) noexcept {
+        static std::atomic<unsigned long> serial{0};
+
+        char name[64];
+        std::snprintf(name, sizeof(name), "\\\\.\\pipe\\holofetch.%lu.%lu", GetCurrentProcessId(), serial++);
+
+        read_end = CreateNamedPipeA(
+            name,
+            PIPE_ACCESS_INBOUND | FILE_FLAG_OVERLAPPED | FILE_FLAG_FIRST_PIPE_INSTANCE,
+            PIPE_TYPE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+            1, 0, 64 * 1024, 0, nullptr
+        );
+        if (read_end == INVALID_HANDLE_VALUE)
+            return false;
 
+        SECURITY_ATTRIBUTES security_attributes;
         security_attributes.nLength              = sizeof(SECURITY_ATTRIBUTES);
         security_attributes.bInheritHandle       = TRUE;
         security_attributes.lpSecurityDescriptor = nullptr;
 
-        if (!CreatePipe(&stdout_rd, &stdout_wr, &security_attributes, 0) ||
-                !SetHandleInformation(stdout_rd, HANDLE_FLAG_INHERIT, 0)) {
-            return std::unexpected(std::errc::broken_pipe);
+        write_end = CreateFileA(name, GENERIC_WRITE, 0, &security_attributes, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (write_end == INVALID_HANDLE_VALUE) {
+            CloseHandle(read_end);
+            read_end = INVALID_HANDLE_VALUE;
+            return false;
+        }
+
+        return true;
+    }
+
+    struct child;
+
+    struct pipe_reader {
+        OVERLAPPED overlapped{}; // first member, completions hand back its address
+        HANDLE handle{INVALID_HANDLE_VALUE};
+        child* owner{nullptr};
+        holofetch::subprocess::channel which{holofetch::subprocess::channel::out};
+        std::string text;
+        bool pending{false};
+        char buffer[4096];
+
+        bool open() const noexcept { return handle != INVALID_HANDLE_VALUE; }
+
+        void close() noexcept {
+            if (open()) {
+                CloseHandle(handle);
+                handle = INVALID_HANDLE_VALUE;
+            }
         }
 
-        if (!CreatePipe(&stderr_rd, &stderr_wr, &security_attributes, 0) ||
-                !SetHandleInformation(stderr_rd, HANDLE_FLAG_INHERIT, 0)) {
-            if (stdout_rd != INVALID_HANDLE_VALUE) CloseHandle(stdout_rd);
-            if (stdout_wr != INVALID_HANDLE_VALUE) CloseHandle(stdout_wr);
-            return std::unexpected(std::errc::broken_pipe);
+        /*
+         * Queues the next read, false once the other end is gone
+         */
+        bool start() noexcept {
+            ZeroMemory(&overlapped, sizeof(overlapped));
+            // a read finishing right away still posts its completion
+            if (ReadFile(handle, buffer, sizeof(buffer), nullptr, &overlapped) || GetLastError() == ERROR_IO_PENDING) {
+                pending = true;
+                return true;
+            }
+            return false;
+        }
+    };
+
+    struct child {
+        PROCESS_INFORMATION process{};
+        HANDLE job{nullptr};
+        pipe_reader out;
+        pipe_reader err;
+        bool ended_early{false};
+        std::errc failure{}; // set when the child could not be started
+        std::errc outcome{}; // set when it was given up on
+        const holofetch::subprocess::output_handler* handler{nullptr};
+    };
+
+    /*
+     * Completion keys: pipe reads, the stop request and one per child job, offset by its index
+     */
+    constexpr ULONG_PTR pipe_key = 0;
+    constexpr ULONG_PTR stop_key = 1;
+    constexpr ULONG_PTR first_job_key = 2;
+
+    /*
+     * Starts command suspended, puts it into job (if any) and lets it run
+     * Only the given standard handles are inherited, so concurrent spawns do not leak pipes into each other
+     */
+    bool create_process(std::string_view command, const std::string& directory, HANDLE input, HANDLE output, HANDLE error, HANDLE& job, PROCESS_INFORMATION& process) noexcept {
+        HANDLE inherited[3];
+        DWORD inherited_count = 0;
+        for (HANDLE h : { input, output, error }) {
+            if (h && h != INVALID_HANDLE_VALUE)
+                inherited[inherited_count++] = h;
         }
 
-        ZeroMemory(&process_info, sizeof(PROCESS_INFORMATION));
-        ZeroMemory(&startup_info, sizeof(STARTUPINFOA));
+        SIZE_T attributes_size = 0;
+        InitializeProcThreadAttributeList(nullptr, 1, 0, &attributes_size);
 
-        startup_info.cb         = sizeof(STARTUPINFOA);
-        startup_info.hStdInput  = 0;
-        startup_info.hStdOutput = stdout_wr;
-        startup_info.hStdError  = stderr_wr;
+        std::string command_copy;
+        std::vector<char> attributes_storage;
+        try {
+            command_copy.assign(command.data(), command.size());
+            attributes_storage.resize(attributes_size);
+        } catch (...) {
+            return false;
+        }
 
-        if(stdout_rd || stderr_rd)
-            startup_info.dwFlags |= STARTF_USESTDHANDLES;
+        auto attributes = reinterpret_cast<LPPROC_THREAD_ATTRIBUTE_LIST>(attributes_storage.data());
+        bool restricted = InitializeProcThreadAttributeList(attributes, 1, 0, &attributes_size)
+            && UpdateProcThreadAttribute(attributes, 0, PROC_THREAD_ATTRIBUTE_HANDLE_LIST, inherited, inherited_count * sizeof(HANDLE), nullptr, nullptr);
 
-        std::string command_copy{command.data(), command.size()};
-        std::string directory = working_directory.string();
+        STARTUPINFOEXA startup_info;
+        ZeroMemory(&startup_info, sizeof(STARTUPINFOEXA));
+        startup_info.StartupInfo.cb         = restricted ? sizeof(STARTUPINFOEXA) : sizeof(STARTUPINFOA);
+        startup_info.StartupInfo.hStdInput  = input;
+        startup_info.StartupInfo.hStdOutput = output;
+        startup_info.StartupInfo.hStdError  = error;
+        startup_info.StartupInfo.dwFlags   |= STARTF_USESTDHANDLES;
+        startup_info.lpAttributeList        = restricted ? attributes : nullptr;
 
-        Success = CreateProcessA(
+        BOOL success = CreateProcessA(
             nullptr,
             command_copy.data(),
             nullptr,
             nullptr,
             TRUE,
-            CREATE_NO_WINDOW,
+            CREATE_NO_WINDOW | CREATE_SUSPENDED | (restricted ? EXTENDED_STARTUPINFO_PRESENT : 0),
             nullptr,
-            directory.c_str(),
-            &startup_info,
-            &process_info
+            directory.empty() ? nullptr : directory.c_str(),
+            &startup_info.StartupInfo,
+            &process
         );
+        if (restricted)
+            DeleteProcThreadAttributeList(attributes);
+
+        if (!success)
+            return false;
+
+        // without a job only the direct child can be killed
+        if (job && !AssignProcessToJobObject(job, process.hProcess)) {
+            CloseHandle(job);
+            job = nullptr;
+        }
+        ResumeThread(process.hThread);
+        CloseHandle(process.hThread);
+        process.hThread = nullptr;
+
+        return true;
+    }
+
+    /*
+     * The child runs inside a kill-on-close job whose notifications go to port
+     */
+    std::errc spawn(child& c, std::string_view command, const std::string& directory, HANDLE port, ULONG_PTR job_key) noexcept {
+        HANDLE stdout_wr = INVALID_HANDLE_VALUE;
+        HANDLE stderr_wr = INVALID_HANDLE_VALUE;
+
+        if (!create_overlapped_pipe(c.out.handle, stdout_wr))
+            return std::errc::broken_pipe;
+        if (!create_overlapped_pipe(c.err.handle, stderr_wr)) {
+            c.out.close();
+            CloseHandle(stdout_wr);
+            return std::errc::broken_pipe;
+        }
+
+        c.job = create_kill_on_close_job();
+        if (c.job) {
+            JOBOBJECT_ASSOCIATE_COMPLETION_PORT association;
+            association.CompletionKey  = reinterpret_cast<PVOID>(job_key);
+            association.CompletionPort = port;
+            // without notifications the job still kills the tree, the exit is just noticed later
+            SetInformationJobObject(c.job, JobObjectAssociateCompletionPortInformation, &association, sizeof(association));
+        }
+
+        bool started = create_process(command, directory, nullptr, stdout_wr, stderr_wr, c.job, c.process);
         CloseHandle(stdout_wr);
         CloseHandle(stderr_wr);
 
-        if(!Success) {
-            CloseHandle(process_info.hProcess);
-            CloseHandle(process_info.hThread);
-            CloseHandle(stdout_rd);
-            CloseHandle(stderr_rd);
-            return std::unexpected(std::errc::no_child_process);
-        }
-        else {
-            CloseHandle(process_info.hThread);
-        }
-
-        if(stdout_rd) {
-            stdout_thread=std::jthread([&]() {
-                DWORD n;
-                char buffer[1024];
-                for(;;) {
-                    n = 0;
-                    int Success = ReadFile(
-                        stdout_rd,
-                        buffer,
-                        (DWORD)1024,
-                        &n,
-                        nullptr
-                    );
-                    if(!Success || n == 0)
-                        break;
-                    stdout_stream << std::string_view{buffer, n};
+        if (!started) {
+            c.out.close();
+            c.err.close();
+            if (c.job) CloseHandle(c.job);
+            c.job = nullptr;
+            return std::errc::no_child_process;
+        }
+
+        c.out.owner = &c;
+        c.out.which = holofetch::subprocess::channel::out;
+        c.err.owner = &c;
+        c.err.which = holofetch::subprocess::channel::err;
+        for (auto* reader : { &c.out, &c.err }) {
+            if (!CreateIoCompletionPort(reader->handle, port, pipe_key, 0) || !reader->start())
+                reader->close();
+        }
+
+        return {};
+    }
+
+    void terminate(child& c) noexcept {
+        if (!c.job || !TerminateJobObject(c.job, 1))
+            TerminateProcess(c.process.hProcess, 1);
+        WaitForSingleObject(c.process.hProcess, INFINITE);
+    }
+
+    /*
+     * Keeps what a read brought, a streaming child hands it to its handler instead
+     * Killing the child is enough to end the run, its pipes then break on their own
+     */
+    void deliver(pipe_reader& reader, DWORD transferred) {
+        child& c = *reader.owner;
+        if (c.ended_early)
+            return;
+
+        reader.text.append(reader.buffer, transferred);
+        if (!c.handler)
+            return;
+
+        bool more = false;
+        try {
+            more = (*c.handler)(reader.which, reader.text);
+        } catch (...) {
+        }
+        reader.text.clear();
+
+        if (!more) {
+            c.ended_early = true;
+            terminate(c);
+        }
+    }
+
+    /*
+     * Every pipe read, child exit (job notification) and the stop request arrives on one
+     * I/O completion port drained by the calling thread, no reader threads involved
+     * Children that could not be waited for get their outcome set and are killed,
+     * all reads are collected before returning
+     */
+    void wait_for(std::span<child> children, HANDLE port, std::chrono::steady_clock::time_point deadline, const std::stop_token& stop) {
+        size_t open_pipes = 0;
+        for (const auto& c : children)
+            open_pipes += c.out.open() + c.err.open();
+
+        HANDLE stop_event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        auto signal_stop = [port, stop_event]() {
+            if (stop_event) SetEvent(stop_event);
+            PostQueuedCompletionStatus(port, 0, stop_key, nullptr);
+        };
+        std::optional<std::stop_callback<decltype(signal_stop)>> on_stop;
+        on_stop.emplace(stop, signal_stop);
+
+        std::errc failure{};
+        OVERLAPPED_ENTRY entries[64];
+
+        while (failure == std::errc{} && open_pipes > 0) {
+            ULONG count = 0;
+            if (!GetQueuedCompletionStatusEx(port, entries, static_cast<ULONG>(std::size(entries)), &count, wait_milliseconds(deadline), FALSE)) {
+                failure = GetLastError() == WAIT_TIMEOUT ? std::errc::timed_out : std::errc::io_error;
+                break;
+            }
+
+            for (ULONG i = 0; i < count; ++i) {
+                const auto& entry = entries[i];
+
+                if (entry.lpCompletionKey == stop_key) {
+                    failure = std::errc::operation_canceled;
+                    continue;
+                }
+
+                if (entry.lpCompletionKey == pipe_key) {
+                    auto* reader = reinterpret_cast<pipe_reader*>(entry.lpOverlapped);
+                    reader->pending = false;
+                    // a failed read (broken pipe) completes with nothing transferred
+                    if (entry.dwNumberOfBytesTransferred > 0) {
+                        deliver(*reader, entry.dwNumberOfBytesTransferred);
+                        if (reader->start())
+                            continue;
+                    }
+                    reader->close();
+                    --open_pipes;
+                    continue;
                 }
-            });
-        }
-
-        if(stderr_rd) {
-            stderr_thread = std::jthread([&]() {
-                DWORD n;
-                char buffer[1024];
-                for(;;) {
-                    n = 0;
-                    int Success = ReadFile(
-                        stderr_rd,
-                        buffer,
-                        (DWORD)1024,
-                        &n,
-                        nullptr
-                    );
-                    if(!Success || n == 0)
+
+                // job notifications carry the message in the byte count and the process id in place of the OVERLAPPED
+                size_t index = entry.lpCompletionKey - first_job_key;
+                if (index >= children.size())
+                    continue;
+                if (entry.dwNumberOfBytesTransferred != JOB_OBJECT_MSG_EXIT_PROCESS && entry.dwNumberOfBytesTransferred != JOB_OBJECT_MSG_ABNORMAL_EXIT_PROCESS)
+                    continue;
+
+                auto& c = children[index];
+                auto pid = static_cast<DWORD>(reinterpret_cast<ULONG_PTR>(entry.lpOverlapped));
+                if (pid == c.process.dwProcessId && c.job) {
+                    // kills leftover grandchildren, releasing their ends of the pipes
+                    CloseHandle(c.job);
+                    c.job = nullptr;
+                }
+            }
+
+            // checked on every round, a chatty child would never let the wait time out
+            if (failure == std::errc{} && deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= deadline)
+                failure = std::errc::timed_out;
+        }
+
+        for (auto& c : children) {
+            if (c.failure != std::errc{} || c.ended_early)
+                continue;
+
+            // a child may close its output before exiting
+            c.outcome = failure;
+            if (!c.out.open() && !c.err.open()) {
+                HANDLE handles[2] = { c.process.hProcess, stop_event };
+                DWORD wait = failure == std::errc{} ? wait_milliseconds(deadline) : 0;
+                switch (WaitForMultipleObjects(stop_event ? 2 : 1, handles, FALSE, wait)) {
+                    case WAIT_OBJECT_0:
+                        c.outcome = {};
+                        break;
+                    case WAIT_OBJECT_0 + 1:
+                        c.outcome = std::errc::operation_canceled;
+                        break;
+                    case WAIT_TIMEOUT:
+                        if (c.outcome == std::errc{})
+                            c.outcome = std::errc::timed_out;
+                        break;
+                    default:
+                        c.outcome = std::errc::io_error;
                         break;
-                    stderr_stream << std::string_view{buffer, n};
                 }
-            });
+            }
+
+            if (c.outcome != std::errc{})
+                terminate(c);
+        }
+
+        on_stop.reset();
+
+        // every child is gone by now, outstanding reads are cancelled and collected
+        // before their buffers go away
+        for (auto& c : children) {
+            if (c.job) CloseHandle(c.job);
+            c.job = nullptr;
+            for (auto* reader : { &c.out, &c.err }) {
+                if (reader->pending)
+                    CancelIoEx(reader->handle, &reader->overlapped);
+            }
         }
+        for (;;) {
+            bool pending = false;
+            for (const auto& c : children)
+                pending = pending || c.out.pending || c.err.pending;
+            if (!pending)
+                break;
 
-        WaitForSingleObject(process_info.hProcess, INFINITE);
-        if(!GetExitCodeProcess(process_info.hProcess, (DWORD*) &code))
-            code = -1;
+            DWORD transferred;
+            ULONG_PTR key;
+            LPOVERLAPPED overlapped = nullptr;
+            GetQueuedCompletionStatus(port, &transferred, &key, &overlapped, INFINITE);
+            if (key == pipe_key && overlapped)
+                reinterpret_cast<pipe_reader*>(overlapped)->pending = false;
+        }
 
-        CloseHandle(process_info.hProcess);
+        for (auto& c : children) {
+            c.out.close();
+            c.err.close();
+        }
+        if (stop_event) CloseHandle(stop_event);
+    }
 
-        if(stdout_thread.joinable())
-            stdout_thread.join();
+    int exit_code(const child& c) noexcept {
+        DWORD code;
+        if (!GetExitCodeProcess(c.process.hProcess, &code))
+            return -1;
+        return static_cast<int>(code);
+    }
 
-        if(stderr_thread.joinable())
-            stderr_thread.join();
+} // namespace
 
-        CloseHandle(stdout_rd);
-        CloseHandle(stderr_rd);
+namespace holofetch::subprocess {
 
-        return result{
-            .out = stdout_stream.str(),
-            .err = stderr_stream.str(),
-            .code = code
-        };
+    auto run(std::string_view command, std::chrono::milliseconds timeout, std::stop_token stop, const std::filesystem::path& working_directory) noexcept
+        -> std::expected<result, std::errc>
+    {
+        try {
+            auto results = run_all(std::span<const std::string_view>{&command, 1}, timeout, std::move(stop), working_directory);
+            return std::move(results.front());
+        } catch (...) {
+            return std::unexpected(std::errc::not_enough_memory);
+        }
+    }
+
+    auto run_all(std::span<const std::string_view> commands, std::chrono::milliseconds timeout, std::stop_token stop, const std::filesystem::path& working_directory)
+        -> std::vector<std::expected<result, std::errc>>
+    {
+        const auto deadline = make_deadline(timeout);
+        const std::string directory = working_directory.string();
+
+        std::vector<std::expected<result, std::errc>> results;
+        results.reserve(commands.size());
+
+        HANDLE port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+        if (!port) {
+            for (size_t i = 0; i < commands.size(); ++i)
+                results.push_back(std::unexpected(std::errc::io_error));
+            return results;
+        }
+
+        // overlapped reads point into the children, so they must never move
+        std::vector<child> children(commands.size());
+        for (size_t i = 0; i < commands.size(); ++i) {
+            children[i].failure = spawn(children[i], commands[i], directory, port, first_job_key + i);
+        }
+
+        wait_for(children, port, deadline, stop);
+
+        for (auto& c : children) {
+            if (c.failure != std::errc{}) {
+                results.push_back(std::unexpected(c.failure));
+            } else if (c.outcome != std::errc{}) {
+                results.push_back(std::unexpected(c.outcome));
+            } else {
+                results.push_back(result{
+                    .out = std::move(c.out.text),
+                    .err = std::move(c.err.text),
+                    .code = exit_code(c)
+                });
+            }
+            if (c.process.hProcess) CloseHandle(c.process.hProcess);
+        }
+        CloseHandle(port);
+
+        return results;
+    }
+
+    auto stream(std::string_view command, const output_handler& on_output, std::chrono::milliseconds timeout, std::stop_token stop, const std::filesystem::path& working_directory) noexcept
+        -> std::expected<std::optional<int>, std::errc>
+    {
+        const auto deadline = make_deadline(timeout);
+
+        std::string directory;
+        try {
+            directory = working_directory.string();
+        } catch (...) {
+            return std::unexpected(std::errc::not_enough_memory);
+        }
+
+        HANDLE port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+        if (!port)
+            return std::unexpected(std::errc::io_error);
+
+        child c;
+        c.handler = &on_output;
+        c.failure = spawn(c, command, directory, port, first_job_key);
+        if (c.failure != std::errc{}) {
+            CloseHandle(port);
+            return std::unexpected(c.failure);
+        }
+
+        wait_for(std::span<child>{&c, 1}, port, deadline, stop);
+
+        std::expected<std::optional<int>, std::errc> outcome;
+        if (c.ended_early)
+            outcome = std::optional<int>{};
+        else if (c.outcome != std::errc{})
+            outcome = std::unexpected(c.outcome);
+        else
+            outcome = exit_code(c);
+
+        CloseHandle(c.process.hProcess);
+        CloseHandle(port);
+        return outcome;
     }
 
-} // namespace subprocess
+} // namespace holofetch::subprocess
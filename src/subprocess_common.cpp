@@ -0,0 +1,29 @@
+#include "holofetch/subprocess.hpp"
+
+namespace holofetch::subprocess {
+
+    auto first_line(std::string_view command, channel from, std::chrono::milliseconds timeout, std::stop_token stop) noexcept
+        -> std::expected<std::string, std::errc>
+    {
+        std::string line;
+        bool complete = false;
+
+        auto collected = stream(command, [&](channel which, std::string_view chunk) {
+            if (which != from)
+                return true;
+
+            auto pos = chunk.find('\n');
+            line.append(chunk.substr(0, pos));
+            complete = pos != std::string_view::npos;
+            return !complete;
+        }, timeout, std::move(stop));
+
+        if (!collected.has_value())
+            return std::unexpected(collected.error());
+
+        if (line.ends_with('\r'))
+            line.pop_back();
+        return line;
+    }
+
+} // namespace holofetch::subprocess
@@ -0,0 +1,478 @@
+#include "holofetch/subprocess.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+
+namespace {
+
+    /*
+     * Splits a command line the way a shell would for simple cases:
+     * whitespace separated words, single and double quotes, backslash escapes
+     */
+    std::vector<std::string> split_command(std::string_view command) {
+        std::vector<std::string> argv;
+        std::string word;
+        bool in_word = false;
+        char quote = 0;
+
+        for (size_t i = 0; i < command.size(); ++i) {
+            char c = command[i];
+
+            if (quote) {
+                if (c == quote) {
+                    quote = 0;
+                } else if (c == '\\' && quote == '"' && i + 1 < command.size()) {
+                    word += command[++i];
+                } else {
+                    word += c;
+                }
+                continue;
+            }
+
+            if (c == ' ' || c == '\t' || c == '\n') {
+                if (in_word) {
+                    argv.push_back(std::move(word));
+                    word.clear();
+                    in_word = false;
+                }
+                continue;
+            }
+
+            in_word = true;
+            if (c == '\'' || c == '"') {
+                quote = c;
+            } else if (c == '\\' && i + 1 < command.size()) {
+                word += command[++i];
+            } else {
+                word += c;
+            }
+        }
+
+        if (in_word)
+            argv.push_back(std::move(word));
+
+        return argv;
+    }
+
+    int wait_milliseconds(std::chrono::steady_clock::time_point deadline) noexcept {
+        if (deadline == std::chrono::steady_clock::time_point::max())
+            return -1;
+
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+        if (left <= 0)
+            return 0;
+        // rounded up, so the deadline has passed when the wait times out
+        return left >= INT32_MAX ? INT32_MAX : static_cast<int>(left) + 1;
+    }
+
+    std::chrono::steady_clock::time_point make_deadline(std::chrono::milliseconds timeout) noexcept {
+        auto now = std::chrono::steady_clock::now();
+        if (timeout >= std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::time_point::max() - now))
+            return std::chrono::steady_clock::time_point::max();
+        return now + timeout;
+    }
+
+    /*
+     * Appends what is available, at most a few reads worth so one busy child cannot starve the loop
+     * Returns false on EOF or error
+     * Reads land on the stack and are appended, growing the buffer never zero-fills its spare capacity
+     */
+    bool drain(int fd, std::string& buffer) {
+        char chunk[64 * 1024];
+        for (size_t round = 0; round < 4; ++round) {
+            ssize_t n = ::read(fd, chunk, sizeof(chunk));
+            if (n > 0) {
+                buffer.append(chunk, static_cast<size_t>(n));
+                continue;
+            }
+
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                return true;
+            return false;
+        }
+        return true;
+    }
+
+    void close_fd(int& fd) noexcept {
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    /*
+     * pidfd makes child exit pollable next to the pipes, kernels older than 5.3 fall back to slices
+     */
+    int open_pidfd(pid_t pid) noexcept {
+#ifdef SYS_pidfd_open
+        return static_cast<int>(::syscall(SYS_pidfd_open, pid, 0));
+#else
+        (void)pid;
+        return -1;
+#endif
+    }
+
+    struct child {
+        pid_t pid{-1};
+        int pidfd{-1};
+        int out_fd{-1};
+        int err_fd{-1};
+        std::string out;
+        std::string err;
+        int status{0};
+        bool exited{false};
+        bool ended_early{false};
+        std::errc failure{}; // set when the child could not be started
+        const holofetch::subprocess::output_handler* handler{nullptr};
+
+        bool finished() const noexcept {
+            return exited && out_fd < 0 && err_fd < 0;
+        }
+    };
+
+    /*
+     * posix_spawn with CLOEXEC pipes into a process group of its own,
+     * so a timeout or stop request can kill everything the child spawned
+     */
+    std::errc spawn(child& c, std::string_view command, const std::string& directory) {
+        std::vector<std::string> args = split_command(command);
+        if (args.empty())
+            return std::errc::invalid_argument;
+
+        std::vector<char*> argv;
+        for (auto& arg : args)
+            argv.push_back(arg.data());
+        argv.push_back(nullptr);
+
+        int stdout_pipe[2] = {-1, -1};
+        int stderr_pipe[2] = {-1, -1};
+        if (::pipe2(stdout_pipe, O_CLOEXEC | O_NONBLOCK) != 0)
+            return std::errc::broken_pipe;
+        if (::pipe2(stderr_pipe, O_CLOEXEC | O_NONBLOCK) != 0) {
+            close_fd(stdout_pipe[0]);
+            close_fd(stdout_pipe[1]);
+            return std::errc::broken_pipe;
+        }
+
+        // the child side must block like an ordinary stdout
+        ::fcntl(stdout_pipe[1], F_SETFL, 0);
+        ::fcntl(stderr_pipe[1], F_SETFL, 0);
+
+        posix_spawn_file_actions_t actions;
+        posix_spawnattr_t attributes;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawnattr_init(&attributes);
+
+        posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+        posix_spawn_file_actions_adddup2(&actions, stdout_pipe[1], STDOUT_FILENO);
+        posix_spawn_file_actions_adddup2(&actions, stderr_pipe[1], STDERR_FILENO);
+        if (!directory.empty())
+            posix_spawn_file_actions_addchdir_np(&actions, directory.c_str());
+
+        posix_spawnattr_setpgroup(&attributes, 0);
+        posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+
+        int spawned = ::posix_spawnp(&c.pid, argv[0], &actions, &attributes, argv.data(), environ);
+
+        posix_spawn_file_actions_destroy(&actions);
+        posix_spawnattr_destroy(&attributes);
+        close_fd(stdout_pipe[1]);
+        close_fd(stderr_pipe[1]);
+
+        if (spawned != 0) {
+            close_fd(stdout_pipe[0]);
+            close_fd(stderr_pipe[0]);
+            return std::errc::no_child_process;
+        }
+
+        c.out_fd = stdout_pipe[0];
+        c.err_fd = stderr_pipe[0];
+        c.pidfd = open_pidfd(c.pid);
+        return {};
+    }
+
+    void reap(child& c, int flags) noexcept {
+        if (c.exited)
+            return;
+
+        pid_t r;
+        do {
+            r = ::waitpid(c.pid, &c.status, flags);
+        } while (r < 0 && errno == EINTR);
+
+        if (r == c.pid) {
+            c.exited = true;
+            // like closing the job object on Windows, leftovers must not keep our pipes open
+            ::kill(-c.pid, SIGKILL);
+            close_fd(c.pidfd);
+        }
+    }
+
+    /*
+     * Kills and reaps a child that is still running, closes everything it left open
+     */
+    void release(child& c) noexcept {
+        if (c.failure != std::errc{})
+            return;
+        if (!c.exited) {
+            ::kill(-c.pid, SIGKILL);
+            reap(c, 0);
+        }
+        close_fd(c.pidfd);
+        close_fd(c.out_fd);
+        close_fd(c.err_fd);
+    }
+
+    int exit_code(const child& c) noexcept {
+        if (WIFEXITED(c.status))
+            return WEXITSTATUS(c.status);
+        if (WIFSIGNALED(c.status))
+            return 128 + WTERMSIG(c.status);
+        return -1;
+    }
+
+    /*
+     * Reads what a pipe has, a streaming child hands it to its handler instead of keeping it
+     */
+    void read_pipe(child& c, int& fd, std::string& buffer, holofetch::subprocess::channel which) {
+        if (fd < 0)
+            return;
+
+        const bool open = drain(fd, buffer);
+        if (c.handler && !buffer.empty()) {
+            bool more = false;
+            try {
+                more = (*c.handler)(which, buffer);
+            } catch (...) {
+            }
+            buffer.clear();
+
+            if (!more) {
+                c.ended_early = true;
+                release(c);
+                return;
+            }
+        }
+
+        if (!open)
+            close_fd(fd);
+    }
+
+    /*
+     * epoll data of a child's descriptor: index in the batch and which descriptor it is
+     */
+    enum : uint64_t {
+        tag_out = 0,
+        tag_err = 1,
+        tag_exit = 2,
+        tag_bits = 2
+    };
+    constexpr uint64_t stop_tag = ~uint64_t{0};
+
+    /*
+     * All pipes, child exits (pidfd) and the stop request are multiplexed by one epoll instance
+     * on the calling thread, no helper threads involved
+     * Returns why it gave up on the children that have not finished, if it did
+     */
+    std::errc wait_for(std::span<child> children, std::chrono::steady_clock::time_point deadline, const std::stop_token& stop) {
+        int epoll = ::epoll_create1(EPOLL_CLOEXEC);
+        if (epoll < 0)
+            return std::errc::io_error;
+
+        int stop_event = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+        auto watch = [epoll](int fd, uint64_t tag) {
+            if (fd < 0)
+                return;
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.u64 = tag;
+            ::epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &event);
+        };
+
+        // without pidfd children are checked on every few milliseconds
+        bool slices = false;
+        for (size_t i = 0; i < children.size(); ++i) {
+            auto& c = children[i];
+            if (c.failure != std::errc{})
+                continue;
+            watch(c.out_fd, (i << tag_bits) | tag_out);
+            watch(c.err_fd, (i << tag_bits) | tag_err);
+            watch(c.pidfd, (i << tag_bits) | tag_exit);
+            slices = slices || c.pidfd < 0;
+        }
+        watch(stop_event, stop_tag);
+
+        auto signal_stop = [stop_event]() {
+            if (stop_event >= 0) {
+                uint64_t one = 1;
+                [[maybe_unused]] auto n = ::write(stop_event, &one, sizeof(one));
+            }
+        };
+        std::optional<std::stop_callback<decltype(signal_stop)>> on_stop;
+        on_stop.emplace(stop, signal_stop);
+
+        auto running = [children]() {
+            for (const auto& c : children) {
+                if (c.failure == std::errc{} && !c.finished())
+                    return true;
+            }
+            return false;
+        };
+
+        std::errc failure{};
+        epoll_event events[64];
+
+        while (failure == std::errc{} && running()) {
+            int wait = wait_milliseconds(deadline);
+            if (slices)
+                wait = wait < 0 ? 10 : std::min(wait, 10);
+
+            int ready = ::epoll_wait(epoll, events, static_cast<int>(std::size(events)), wait);
+            if (ready < 0) {
+                if (errno == EINTR)
+                    continue;
+                failure = std::errc::io_error;
+                break;
+            }
+
+            for (int i = 0; i < ready; ++i) {
+                const uint64_t tag = events[i].data.u64;
+                if (tag == stop_tag) {
+                    failure = std::errc::operation_canceled;
+                    continue;
+                }
+
+                // descriptors of a child released earlier in this round are already closed
+                auto& c = children[tag >> tag_bits];
+                switch (tag & ((1 << tag_bits) - 1)) {
+                    case tag_out:
+                        read_pipe(c, c.out_fd, c.out, holofetch::subprocess::channel::out);
+                        break;
+                    case tag_err:
+                        read_pipe(c, c.err_fd, c.err, holofetch::subprocess::channel::err);
+                        break;
+                    case tag_exit:
+                        reap(c, 0);
+                        break;
+                }
+            }
+
+            if (slices) {
+                for (auto& c : children) {
+                    if (c.failure == std::errc{} && c.pidfd < 0)
+                        reap(c, WNOHANG);
+                }
+            }
+
+            // checked on every round, a chatty child would never let the wait time out
+            if (failure == std::errc{} && deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= deadline)
+                failure = std::errc::timed_out;
+        }
+
+        // no more wakeups may land on the event once it is closed
+        on_stop.reset();
+        close_fd(stop_event);
+        close_fd(epoll);
+
+        return failure;
+    }
+
+} // namespace
+
+namespace holofetch::subprocess {
+
+    auto run(std::string_view command, std::chrono::milliseconds timeout, std::stop_token stop, const std::filesystem::path& working_directory) noexcept
+        -> std::expected<result, std::errc>
+    {
+        try {
+            auto results = run_all(std::span<const std::string_view>{&command, 1}, timeout, std::move(stop), working_directory);
+            return std::move(results.front());
+        } catch (...) {
+            return std::unexpected(std::errc::not_enough_memory);
+        }
+    }
+
+    auto run_all(std::span<const std::string_view> commands, std::chrono::milliseconds timeout, std::stop_token stop, const std::filesystem::path& working_directory)
+        -> std::vector<std::expected<result, std::errc>>
+    {
+        const auto deadline = make_deadline(timeout);
+        const std::string directory = working_directory.string();
+
+        std::vector<child> children(commands.size());
+        for (size_t i = 0; i < commands.size(); ++i) {
+            children[i].failure = spawn(children[i], commands[i], directory);
+        }
+
+        const std::errc failure = wait_for(children, deadline, stop);
+
+        std::vector<std::expected<result, std::errc>> results;
+        results.reserve(children.size());
+
+        for (auto& c : children) {
+            if (c.failure != std::errc{}) {
+                results.push_back(std::unexpected(c.failure));
+                continue;
+            }
+
+            const bool finished = c.finished();
+            release(c);
+
+            if (!finished) {
+                results.push_back(std::unexpected(failure));
+                continue;
+            }
+
+            results.push_back(result{
+                .out = std::move(c.out),
+                .err = std::move(c.err),
+                .code = exit_code(c)
+            });
+        }
+
+        return results;
+    }
+
+    auto stream(std::string_view command, const output_handler& on_output, std::chrono::milliseconds timeout, std::stop_token stop, const std::filesystem::path& working_directory) noexcept
+        -> std::expected<std::optional<int>, std::errc>
+    {
+        try {
+            const auto deadline = make_deadline(timeout);
+
+            child c;
+            c.handler = &on_output;
+            c.failure = spawn(c, command, working_directory.string());
+            if (c.failure != std::errc{})
+                return std::unexpected(c.failure);
+
+            const std::errc failure = wait_for(std::span<child>{&c, 1}, deadline, stop);
+            const bool finished = c.finished();
+            release(c);
+
+            if (c.ended_early)
+                return std::optional<int>{};
+            if (!finished)
+                return std::unexpected(failure);
+            return exit_code(c);
+        } catch (...) {
+            return std::unexpected(std::errc::not_enough_memory);
+        }
+    }
+
+} // namespace holofetch::subprocess
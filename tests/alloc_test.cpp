@@ -0,0 +1,127 @@
+#include "check.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include "holofetch/default_avatar.hpp"
+#include "holofetch/renderer.hpp"
+
+/*
+ * Every heap allocation of the program is counted, a redraw past the first few must take none
+ */
+namespace {
+    size_t allocations = 0;
+}
+
+void* operator new(size_t size) {
+    ++allocations;
+    if (void* p = std::malloc(size > 0 ? size : 1))
+        return p;
+    throw std::bad_alloc{};
+}
+
+// what std::pmr::new_delete_resource() allocates with
+void* operator new(size_t size, std::align_val_t alignment) {
+    ++allocations;
+    const auto align = static_cast<size_t>(alignment);
+#ifdef _WIN32
+    if (void* p = _aligned_malloc(size > 0 ? size : 1, align))
+#else
+    if (void* p = std::aligned_alloc(align, (size + align - 1) / align * align))
+#endif
+        return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void operator delete(void* p, size_t, std::align_val_t alignment) noexcept {
+    operator delete(p, alignment);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+    using namespace holofetch;
+
+    /*
+     * Values long enough to leave the small string buffer, alternating like a clock and a
+     * memory gauge do, and getting wider from frame `widen` on
+     */
+    std::pmr::vector<section> sections(std::pmr::memory_resource* memory, int frame, int widen) {
+        std::pmr::vector<section> s{memory};
+        s.reserve(3);
+
+        auto& hardware = s.emplace_back("Hardware");
+        hardware.properties.emplace_back("CPU", frame >= widen
+            ? "Some processor with a name long enough to leave SSO, and a good deal longer now"
+            : "Some processor with a name long enough to leave SSO");
+        hardware.properties.emplace_back("RAM", frame % 2 ? "001 GB / 016 GB [ \033[92m6\033[0m% ]" : "002 GB / 016 GB [ \033[92m12\033[0m% ]");
+
+        auto& terminal = s.emplace_back("Terminal");
+        terminal.properties.emplace_back("Uptime", frame % 3 ? "12 seconds, and a tail that skips SSO" : "7 seconds, and a tail that skips SSO");
+
+        auto& software = s.emplace_back("Software");
+        software.properties.emplace_back("OS", "Linux 6.18, a distribution with a long name");
+        return s;
+    }
+
+    void steady_frames_do_not_allocate() {
+        renderer r;
+        r.set_console_size(200, 80);
+        r.set_color_depth(sgr::color_depth::truecolor);
+
+        // as holofetch draws it without a template, the first frame writes the whole screen
+        image avatar;
+        avatar.cells = assets::default_avatar();
+        r.set_avatar(std::move(avatar));
+
+        constexpr int warm_up = 3;
+        constexpr int widen = 6;
+        for (int frame = 0; frame < 12; ++frame) {
+            const size_t before = allocations;
+            r.redraw(sections(r.begin_frame(), frame, widen));
+            const size_t taken = allocations - before;
+
+            if (frame >= warm_up) {
+                CHECK(taken == 0);
+                if (taken != 0)
+                    std::fprintf(stderr, "frame %d: %zu allocations\n", frame, taken);
+            }
+        }
+
+        r.end_redraw();
+    }
+
+} // namespace
+
+int main() {
+    // the frames go nowhere, only their allocations matter
+#ifdef _WIN32
+    if (!std::freopen("NUL", "w", stdout))
+#else
+    if (!std::freopen("/dev/null", "w", stdout))
+#endif
+        return 1;
+
+    steady_frames_do_not_allocate();
+    return holofetch::test::result();
+}
@@ -0,0 +1,116 @@
+#include "check.hpp"
+
+#include "holofetch/ansi.hpp"
+
+namespace {
+
+    namespace ansi = holofetch::ansi;
+    namespace sgr = holofetch::sgr;
+
+    constexpr sgr::color red = (1u << 24) | 31;
+
+    /*
+     * The index agrees with ansi::width, which measures without keeping lines
+     */
+    bool widest_agrees(std::string_view text) {
+        const ansi::line_index lines{text};
+        return lines.width() == ansi::width(text);
+    }
+
+    void empty_lines() {
+        CHECK(ansi::line_index{""}.empty());
+
+        const ansi::line_index one{"\n"};
+        CHECK(one.size() == 1 && one[0].length == 0 && one[0].width == 0);
+
+        const ansi::line_index lines{"a\n\n\nbc\n"};
+        CHECK(lines.size() == 4);
+        CHECK(lines.view(0) == "a");
+        CHECK(lines.view(1).empty() && lines.view(2).empty());
+        CHECK(lines[1].offset == 2 && lines[2].offset == 3);
+        CHECK(lines.view(3) == "bc" && lines[3].width == 2);
+        CHECK(lines.width() == 2);
+        CHECK(widest_agrees("a\n\n\nbc\n"));
+    }
+
+    void carriage_returns() {
+        const ansi::line_index lines{"ab\r\n\r\ncd\r\n"};
+        CHECK(lines.size() == 3);
+        CHECK(lines.view(0) == "ab" && lines[0].width == 2);
+        CHECK(lines.view(1).empty());
+        CHECK(lines.view(2) == "cd");
+
+        // only the one right before the end of the line goes
+        const ansi::line_index inner{"a\rb\r\r\nc\r"};
+        CHECK(inner.size() == 2);
+        CHECK(inner.view(0) == "a\rb\r" && inner[0].width == 2);
+        CHECK(inner.view(1) == "c");
+    }
+
+    void last_line_without_newline() {
+        const ansi::line_index lines{"ab\n中x"};
+        CHECK(lines.size() == 2);
+        CHECK(lines.view(1) == "中x" && lines[1].offset == 3 && lines[1].width == 3);
+        CHECK(lines.width() == 3);
+        CHECK(widest_agrees("ab\n中x"));
+
+        // a style set on the unterminated line is its end state
+        const ansi::line_index styled{"a\n\033[31mb"};
+        CHECK(styled.size() == 2 && styled[0].style.fg == 0 && styled[1].style.fg == red);
+    }
+
+    void string_sequences() {
+        // an OSC takes no columns, whether it ends at BEL or ST, and stays in the line's bytes
+        constexpr std::string_view title{"\033]0;title\a中x\n"};
+        const ansi::line_index titled{title};
+        CHECK(titled.size() == 1 && titled[0].width == 3 && titled.view(0) == title.substr(0, title.size() - 1));
+
+        constexpr std::string_view link{"\033]8;;https://example.org\033\\link\033]8;;\033\\\nz"};
+        const ansi::line_index linked{link};
+        CHECK(linked.size() == 2 && linked[0].width == 4 && linked.view(1) == "z");
+        CHECK(widest_agrees(link));
+
+        // a newline inside a string does not end the line
+        const ansi::line_index inside{"\033]0;a\nb\a\nc"};
+        CHECK(inside.size() == 2 && inside[0].width == 0 && inside.view(1) == "c");
+
+        // an unterminated string swallows the rest
+        const ansi::line_index open{"x\033]0;a\nb"};
+        CHECK(open.size() == 1 && open[0].width == 1);
+    }
+
+    void cancelled_sequences() {
+        // CAN and SUB end a sequence without effect, what follows is text again
+        const ansi::line_index can{"\033[31\x18" "ab\n"};
+        CHECK(can.size() == 1 && can[0].width == 2 && can[0].style.fg == 0);
+
+        const ansi::line_index sub{"\033]0;t\x1A" "ab\ncd"};
+        CHECK(sub.size() == 2 && sub[0].width == 2 && sub[1].width == 2);
+
+        // a newline inside a control sequence is executed, so it still ends the line
+        const ansi::line_index split{"\033[3\n1mx\n"};
+        CHECK(split.size() == 2 && split[0].width == 0 && split[1].width == 1);
+        CHECK(widest_agrees("\033[31\x18" "ab\n\033]0;t\x1A" "abc"));
+    }
+
+    void styles() {
+        const sgr::style initial{0, (1u << 24) | 44, 0};
+        const ansi::line_index lines{"\033[1;31mred\nstill\033[0m\nplain", initial};
+        CHECK(lines.size() == 3);
+        CHECK(lines[0].style.fg == red && (lines[0].style.attributes & sgr::bold) && lines[0].style.bg == initial.bg);
+        CHECK(lines[1].style == sgr::style{});
+        CHECK(lines[2].style == sgr::style{});
+        CHECK(lines[0].width == 3 && lines[1].width == 5);
+    }
+
+} // namespace
+
+int main() {
+    empty_lines();
+    carriage_returns();
+    last_line_without_newline();
+    string_sequences();
+    cancelled_sequences();
+    styles();
+    return holofetch::test::result();
+}
@@ -0,0 +1,185 @@
+#include "check.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "holofetch/avatar.hpp"
+#include "holofetch/renderer.hpp"
+
+namespace {
+
+    using holofetch::canvas;
+    using holofetch::compiled_avatar;
+    using holofetch::image;
+
+    bool same_cells(const canvas& a, const canvas& b) {
+        if (a.width() != b.width() || a.height() != b.height())
+            return false;
+
+        for (size_t y = 0; y < a.height(); ++y) {
+            for (size_t x = 0; x < a.width(); ++x) {
+                if (a.codepoint(x, y) != b.codepoint(x, y) || !(a.style(x, y) == b.style(x, y)))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    image framed(std::string_view texture) {
+        image i;
+        i.texture = texture;
+        i.border_left = "|";
+        i.border_right = "|";
+        i.border_top = "+--+";
+        i.border_bottom = "+--+";
+        return i;
+    }
+
+    /*
+     * The compiled avatar must draw exactly what the ANSI art it was compiled from draws
+     */
+    void compiled_matches_text(std::string_view ans, std::string_view texture = {}) {
+        auto compiled = compiled_avatar::compile(ans);
+        CHECK(compiled.has_value());
+        if (!compiled)
+            return;
+
+        image text = framed(texture);
+        text.data = ans;
+        image cells = framed(texture);
+        cells.cells = std::move(compiled);
+
+        const holofetch::palette palette;
+        CHECK(same_cells(cells.render(palette), text.render(palette)));
+    }
+
+    void wide_glyphs() {
+        compiled_matches_text("中文AB|X\n");
+        compiled_matches_text("\033[31m中\033[42m文\033[0mAB\nX中\n");
+
+        auto compiled = compiled_avatar::compile("中文AB|X\n");
+        CHECK(compiled.has_value());
+        if (!compiled)
+            return;
+
+        image bare;
+        bare.cells = std::move(compiled);
+        const canvas c = bare.render({});
+        CHECK(c.width() == 8);
+        CHECK(c.codepoint(0, 0) == U'中' && c.codepoint(1, 0) == canvas::wide_tail);
+        CHECK(c.codepoint(2, 0) == U'文' && c.codepoint(3, 0) == canvas::wide_tail);
+        CHECK(c.codepoint(4, 0) == U'A' && c.codepoint(7, 0) == U'X');
+    }
+
+    void narrow_glyphs() {
+        compiled_matches_text("\033[1;36m.-.\n\033[0m(o o)\n \033[7m|\033[27m \n");
+        compiled_matches_text("##.#\n#..#\n", "abc");
+    }
+
+    /*
+     * Offsets into the file image, see the header layout in avatar.cpp
+     */
+    constexpr size_t height_offset = 20;
+    constexpr size_t palette_size_offset = 24;
+    constexpr size_t run_count_offset = 28;
+    constexpr size_t header_size = 40;
+    constexpr size_t run_size = 12;
+
+    uint32_t read_u32(const std::vector<std::byte>& image, size_t offset) {
+        uint32_t v;
+        std::memcpy(&v, image.data() + offset, sizeof(v));
+        return v;
+    }
+
+    void write_u32(std::vector<std::byte>& image, size_t offset, uint32_t v) {
+        std::memcpy(image.data() + offset, &v, sizeof(v));
+    }
+
+    void write_u16(std::vector<std::byte>& image, size_t offset, uint16_t v) {
+        std::memcpy(image.data() + offset, &v, sizeof(v));
+    }
+
+    const std::filesystem::path scratch = std::filesystem::temp_directory_path() / "holofetch_avatar_test.hfa";
+
+    std::optional<compiled_avatar> load(const std::vector<std::byte>& image) {
+        {
+            std::ofstream out(scratch, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()));
+        }
+        auto avatar = compiled_avatar::load(scratch);
+        std::filesystem::remove(scratch);
+        return avatar;
+    }
+
+    void corrupt_files() {
+        // three rows of a run or more each, in three colors
+        auto compiled = compiled_avatar::compile("\033[31mab\033[32mcd\n\033[33mef\033[31mgh\nij\033[32mkl\n");
+        CHECK(compiled.has_value());
+        if (!compiled)
+            return;
+
+        const auto bytes = compiled->bytes();
+        const std::vector<std::byte> image(bytes.begin(), bytes.end());
+        CHECK(read_u32(image, height_offset) == 3);
+
+        const uint32_t palette_size = read_u32(image, palette_size_offset);
+        const uint32_t run_count = read_u32(image, run_count_offset);
+        const size_t rows_offset = header_size + 4 * size_t{palette_size};
+        const size_t runs_offset = rows_offset + 4 * 4;
+        CHECK(run_count >= 4);
+
+        // the image as it is loads and draws the same
+        auto valid = load(image);
+        CHECK(valid.has_value());
+        if (valid) {
+            holofetch::image from_file;
+            from_file.cells = std::move(valid);
+            holofetch::image in_memory;
+            in_memory.cells = std::move(compiled);
+            CHECK(same_cells(from_file.render({}), in_memory.render({})));
+        }
+
+        for (size_t size = 0; size < image.size(); size += 7) {
+            CHECK(!load(std::vector<std::byte>(image.begin(), image.begin() + static_cast<std::ptrdiff_t>(size))));
+        }
+
+        // rows going back
+        auto backwards = image;
+        write_u32(backwards, rows_offset + 4, read_u32(image, rows_offset + 8));
+        write_u32(backwards, rows_offset + 8, read_u32(image, rows_offset + 4));
+        CHECK(!load(backwards));
+
+        // a row ending far past the runs, all the others in order
+        auto past_end = image;
+        write_u32(past_end, rows_offset + 4, 1000000);
+        CHECK(!load(past_end));
+
+        auto one_past = image;
+        write_u32(one_past, rows_offset + 8, run_count + 1);
+        CHECK(!load(one_past));
+
+        // colors past the palette
+        auto foreground = image;
+        write_u16(foreground, runs_offset + 4, static_cast<uint16_t>(palette_size));
+        CHECK(!load(foreground));
+
+        auto background = image;
+        write_u16(background, runs_offset + run_size + 6, 0xFFFF);
+        CHECK(!load(background));
+
+        // a row wider than the avatar
+        auto wide = image;
+        write_u16(wide, runs_offset + 10, 0xFFFF);
+        CHECK(!load(wide));
+    }
+
+} // namespace
+
+int main() {
+    wide_glyphs();
+    narrow_glyphs();
+    corrupt_files();
+    return holofetch::test::result();
+}
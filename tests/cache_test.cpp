@@ -0,0 +1,199 @@
+#include "check.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "holofetch/cache.hpp"
+
+namespace {
+
+    using holofetch::cache_mode;
+    using holofetch::fact_cache;
+
+    using namespace std::chrono_literals;
+
+    const std::filesystem::path scratch = std::filesystem::temp_directory_path() / "holofetch_cache_test";
+    const std::filesystem::path file = scratch / "facts.cache";
+
+    void append(const std::filesystem::path& path, std::string_view text) {
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        out << text;
+    }
+
+    void expiry() {
+        fact_cache cache{file, cache_mode::refresh};
+        cache.put("fresh", "value", 1h);
+        cache.put("stale", "value", 0s);
+
+        // refresh only writes, what was put is read back once loaded
+        CHECK(!cache.get("fresh"));
+        CHECK(cache.save());
+
+        fact_cache loaded{file};
+        CHECK(loaded.get("fresh") == "value");
+        CHECK(!loaded.get("stale"));
+        CHECK(loaded.hits() == 1 && loaded.misses() == 1);
+
+        // an entry that expired in memory is a miss too
+        loaded.put("fresh", "again", 0s);
+        CHECK(!loaded.get("fresh"));
+    }
+
+    void keys() {
+        fact_cache cache{file, cache_mode::refresh};
+        cache.put("keyed", "value", 1h, "a|1|2");
+        CHECK(cache.save());
+
+        fact_cache loaded{file};
+        CHECK(loaded.get("keyed", "a|1|2") == "value");
+        CHECK(!loaded.get("keyed", "a|1|3"));
+        CHECK(!loaded.get("keyed"));
+    }
+
+    void round_trip() {
+        // every character the format escapes, in every field
+        constexpr std::string_view odd{"tab\there\nnew line\r\\back\\slash\\"};
+
+        fact_cache cache{file, cache_mode::refresh};
+        cache.put("plain", "value", 1h);
+        cache.put(odd, std::string{odd}, 1h, odd);
+        cache.put("empty", "", 1h);
+        CHECK(cache.save());
+
+        fact_cache loaded{file};
+        CHECK(loaded.get("plain") == "value");
+        CHECK(loaded.get(odd, odd) == odd);
+        CHECK(loaded.get("empty") == "");
+
+        // written aside and renamed, nothing is left next to the file
+        size_t files = 0;
+        for ([[maybe_unused]] const auto& entry : std::filesystem::directory_iterator(scratch))
+            ++files;
+        CHECK(files == 1);
+
+        // an unknown format is ignored as a whole
+        {
+            std::ofstream out(file, std::ios::binary | std::ios::trunc);
+            out << "holofetch-cache 0\nplain\t99999999999\t\tvalue\n";
+        }
+        fact_cache unknown{file};
+        CHECK(!unknown.get("plain"));
+    }
+
+    void modes() {
+        std::filesystem::remove(file);
+
+        // nothing is read or written when disabled
+        fact_cache disabled{file, cache_mode::disabled};
+        disabled.put("name", "value", 1h);
+        CHECK(!disabled.get("name"));
+        CHECK(disabled.save());
+        CHECK(!std::filesystem::exists(file));
+
+        fact_cache enabled{file};
+        enabled.put("name", "stored", 1h);
+        CHECK(enabled.get("name") == "stored");
+        CHECK(enabled.save());
+
+        // refresh ignores what is stored, and replaces it on save
+        fact_cache refresh{file, cache_mode::refresh};
+        CHECK(!refresh.get("name"));
+        refresh.put("name", "fresh", 1h);
+        CHECK(refresh.save());
+        CHECK(fact_cache{file}.get("name") == "fresh");
+
+        // a cache that put nothing leaves the file alone
+        const auto written = std::filesystem::last_write_time(file);
+        fact_cache untouched{file};
+        CHECK(untouched.save());
+        CHECK(std::filesystem::last_write_time(file) == written);
+    }
+
+    void tool_versions() {
+        // a path with a directory part is resolved as is, not through PATH
+        const auto tool = scratch / "tool";
+        std::filesystem::remove(tool);
+        append(tool, "#!/bin/sh\n");
+        std::filesystem::permissions(tool, std::filesystem::perms::owner_all);
+
+        const std::string name = tool.string();
+        std::filesystem::remove(file);
+        fact_cache cache{file};
+
+        int reads = 0;
+        std::string version = "1.0";
+        const holofetch::tool_version_query query{
+            .tool = name,
+            .read = [&](const std::filesystem::path& p) {
+                ++reads;
+                CHECK(p == tool);
+                return version;
+            }
+        };
+        auto versions = [&] {
+            return holofetch::cached_tool_versions(cache, std::span{&query, 1}, 1h, 1s).front();
+        };
+
+        CHECK(versions() == "1.0");
+        CHECK(versions() == "1.0" && reads == 1);
+
+        // another binary in its place, its size alone changes the fingerprint
+        append(tool, "# another version\n");
+        version = "2.0";
+        CHECK(versions() == "2.0" && reads == 2);
+        CHECK(versions() == "2.0" && reads == 2);
+
+        // a failed read is tried again on the next run
+        append(tool, "# broken\n");
+        version.clear();
+        CHECK(versions().empty() && reads == 3);
+        CHECK(versions().empty() && reads == 4);
+
+        // a missing tool is remembered as missing, without looking for it
+        std::filesystem::remove(tool);
+        CHECK(versions().empty() && reads == 4);
+        CHECK(cache.get("version." + name, "missing") == "");
+    }
+
+    void tool_versions_in_order() {
+        std::filesystem::remove(file);
+        fact_cache cache{file};
+
+        std::vector<std::string> names;
+        for (std::string_view tool : {"a", "b", "c"}) {
+            const auto path = scratch / tool;
+            std::filesystem::remove(path);
+            append(path, tool);
+            std::filesystem::permissions(path, std::filesystem::perms::owner_all);
+            names.push_back(path.string());
+        }
+
+        std::vector<holofetch::tool_version_query> queries;
+        for (const auto& name : names) {
+            queries.push_back({
+                .tool = name,
+                .read = [](const std::filesystem::path& p) { return p.filename().string(); }
+            });
+        }
+
+        const auto versions = holofetch::cached_tool_versions(cache, queries, 1h, 1s);
+        CHECK(versions.size() == 3 && versions[0] == "a" && versions[1] == "b" && versions[2] == "c");
+    }
+
+} // namespace
+
+int main() {
+    std::filesystem::remove_all(scratch);
+    std::filesystem::create_directories(scratch);
+
+    expiry();
+    keys();
+    round_trip();
+    modes();
+    tool_versions();
+    tool_versions_in_order();
+
+    std::filesystem::remove_all(scratch);
+    return holofetch::test::result();
+}
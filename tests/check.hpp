@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdio>
+#include <source_location>
+
+namespace holofetch::test {
+
+    inline int failures = 0;
+
+    inline void check(bool ok, const char* expression, std::source_location where = std::source_location::current()) {
+        if (ok)
+            return;
+
+        ++failures;
+        std::fprintf(stderr, "%s:%u: check failed: %s\n", where.file_name(), static_cast<unsigned>(where.line()), expression);
+    }
+
+    /*
+     * Exit code of a test program
+     */
+    inline int result() {
+        return failures == 0 ? 0 : 1;
+    }
+
+} // namespace holofetch::test
+
+/*
+ * Reports a failed condition and keeps going, so one run lists every failure
+ */
+#define CHECK(...) holofetch::test::check(static_cast<bool>(__VA_ARGS__), #__VA_ARGS__)
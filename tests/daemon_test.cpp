@@ -0,0 +1,141 @@
+#include "check.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "holofetch/daemon.hpp"
+
+namespace {
+
+    using namespace std::chrono_literals;
+
+    namespace daemon = holofetch::daemon;
+
+    daemon::snapshot sample() {
+        daemon::snapshot s;
+        s.taken = std::chrono::system_clock::time_point{1'760'000'000'123ms};
+
+        s.host.terminal = {"Windows Terminal", "workstation", "ada"};
+        s.host.hardware.cpu = {"AMD Ryzen 9 7950X 16-Core Processor", 32, 4500};
+        s.host.hardware.gpu = {"NVIDIA GeForce RTX 4090"};
+        s.host.hardware.mem = {12'345, 65'536, 18};
+        s.host.hardware.swap = {0, 8'192, 1'024, 0};
+        s.host.hardware.disks = {{120'000, 500'000, 24, 'C', ""}, {1, 2, 50, 'D', "/mnt/with space/ü"}};
+        s.host.hardware.displays = {{0, "DELL U2720Q", 3840, 2160, 60}};
+        s.host.software = {"Arch Linux", "7.4.6", "clang", "19.1.7", "3.13.1", ""};
+        s.host.uptime = 90'061'000ms;
+
+        s.network.adapters = {
+            {"eth0", "N/A", "02-FC-00-0A-BE-01", {"192.168.1.20", "10.0.0.7"}, {"fe80::fc:aff:febe:1"}},
+            {"wg0", "wireguard", "", {}, {}},
+        };
+        return s;
+    }
+
+    void round_trip() {
+        const auto s = sample();
+        const auto bytes = daemon::encode(s);
+
+        const auto decoded = daemon::decode(bytes);
+        CHECK(decoded.has_value());
+        if (!decoded)
+            return;
+
+        CHECK(decoded->taken == s.taken);
+        CHECK(decoded->host.terminal.username == "ada");
+        CHECK(decoded->host.hardware.cpu.name == s.host.hardware.cpu.name && decoded->host.hardware.cpu.cores == 32 && decoded->host.hardware.cpu.rate == 4500);
+        CHECK(decoded->host.hardware.mem.usedMB == 12'345 && decoded->host.hardware.swap.peakMB == 1'024);
+        CHECK(decoded->host.hardware.disks.size() == 2 && decoded->host.hardware.disks[1].id == 'D' && decoded->host.hardware.disks[1].path == "/mnt/with space/ü");
+        CHECK(decoded->host.hardware.displays.size() == 1 && decoded->host.hardware.displays[0].height == 2160);
+        CHECK(decoded->host.software.cc == "clang" && decoded->host.software.rust.empty());
+        CHECK(decoded->host.uptime == s.host.uptime);
+        CHECK(decoded->network.adapters.size() == 2 && decoded->network.adapters[0].ipv4.size() == 2 && decoded->network.adapters[0].ipv6[0] == "fe80::fc:aff:febe:1");
+        CHECK(decoded->network.adapters.size() == 2 && decoded->network.adapters[1].description == "wireguard" && decoded->network.adapters[1].ipv4.empty());
+
+        // every field survives, encoding what was decoded gives the same bytes
+        CHECK(daemon::encode(*decoded) == bytes);
+
+        // and an empty snapshot round trips as well
+        const auto empty = daemon::encode(daemon::snapshot{});
+        const auto decoded_empty = daemon::decode(empty);
+        CHECK(decoded_empty.has_value() && daemon::encode(*decoded_empty) == empty);
+    }
+
+    void rejected() {
+        const auto bytes = daemon::encode(sample());
+
+        // cut short anywhere
+        for (size_t size = 0; size < bytes.size(); ++size) {
+            const bool decoded = daemon::decode(std::string_view{bytes}.substr(0, size)).has_value();
+            CHECK(!decoded);
+            if (decoded)
+                std::fprintf(stderr, "  decoded %zu of %zu bytes\n", size, bytes.size());
+        }
+
+        // trailing bytes
+        CHECK(!daemon::decode(bytes + '\0').has_value());
+        CHECK(!daemon::decode(bytes + std::string(8, '\0')).has_value());
+
+        // another format, or another version of it
+        CHECK(!daemon::decode("").has_value());
+        auto other = bytes;
+        other[0] = 'H';
+        CHECK(!daemon::decode(other).has_value());
+        auto newer = bytes;
+        newer[newer.find('\n') - 1] = '2';
+        CHECK(!daemon::decode(newer).has_value());
+
+        // a string or vector length past the end, the count of the disks sits after
+        // the magic, taken, three terminal strings, cpu, gpu, memory and swap
+        const size_t magic = bytes.find('\n') + 1;
+        auto huge = bytes;
+        const uint64_t length = ~uint64_t{0};
+        std::memcpy(huge.data() + magic + 8, &length, sizeof(length));
+        CHECK(!daemon::decode(huge).has_value());
+
+        const auto s = sample();
+        size_t disks = magic + 8;
+        for (const auto& text : {s.host.terminal.tab, s.host.terminal.hostname, s.host.terminal.username, s.host.hardware.cpu.name})
+            disks += 8 + text.size();
+        disks += 2 * 8 + 8 + s.host.hardware.gpu.name.size() + 3 * 8 + 4 * 8;
+        uint64_t count = 0;
+        std::memcpy(&count, bytes.data() + disks, sizeof(count));
+        CHECK(count == 2);
+
+        auto many = bytes;
+        const uint64_t too_many = bytes.size();
+        std::memcpy(many.data() + disks, &too_many, sizeof(too_many));
+        CHECK(!daemon::decode(many).has_value());
+    }
+
+    void staleness() {
+        daemon::snapshot s;
+        s.taken = std::chrono::system_clock::now();
+
+        CHECK(!daemon::stale(s, s.taken));
+        CHECK(!daemon::stale(s, s.taken + 1s));
+        CHECK(!daemon::stale(s, s.taken + 5s));
+        CHECK(daemon::stale(s, s.taken + 5s + 1ms));
+        CHECK(daemon::stale(s, s.taken + 1h));
+
+        // a snapshot from ahead of the clock is only believed within the same margin
+        CHECK(!daemon::stale(s, s.taken - 5s));
+        CHECK(daemon::stale(s, s.taken - 5s - 1ms));
+        CHECK(daemon::stale(s, s.taken - 24h));
+
+        // the daemon of a machine that went to sleep or died leaves its last snapshot behind
+        const auto decoded = daemon::decode(daemon::encode(sample()));
+        CHECK(decoded.has_value() && daemon::stale(*decoded, std::chrono::system_clock::now()));
+    }
+
+} // namespace
+
+int main() {
+    round_trip();
+    rejected();
+    staleness();
+    return holofetch::test::result();
+}
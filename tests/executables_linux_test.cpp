@@ -0,0 +1,124 @@
+#include "check.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <unistd.h>
+
+#include "holofetch/executables.hpp"
+
+namespace {
+
+    using holofetch::executable_index;
+
+    const std::filesystem::path scratch = std::filesystem::temp_directory_path() / ("holofetch_executables_test." + std::to_string(::getpid()));
+    const std::filesystem::path first = scratch / "first";
+    const std::filesystem::path second = scratch / "second";
+    const std::filesystem::path third = scratch / "third";
+
+    void create(const std::filesystem::path& file, bool executable) {
+        std::ofstream{file} << "#!/bin/sh\n";
+        std::filesystem::permissions(file, executable ? std::filesystem::perms::owner_all : std::filesystem::perms::owner_read | std::filesystem::perms::owner_write);
+    }
+
+    std::string path_list(std::initializer_list<std::filesystem::path> directories) {
+        std::string list;
+        for (const auto& d : directories) {
+            if (!list.empty())
+                list += ':';
+            list += d.string();
+        }
+        return list;
+    }
+
+    void set_up() {
+        std::filesystem::remove_all(scratch);
+        for (const auto& d : {first, second, third})
+            std::filesystem::create_directories(d);
+
+        create(first / "both", true);
+        create(second / "both", true);
+        create(second / "only_second", true);
+        create(third / "only_third", true);
+
+        // shadowed by an executable further down
+        create(first / "hidden", false);
+        create(second / "hidden", true);
+
+        create(third / "plain", false);
+        std::filesystem::create_directories(first / "directory");
+    }
+
+    void path_order() {
+        executable_index index{path_list({first, second, third}), {}};
+        CHECK(index.resolve("both") == first / "both");
+        CHECK(index.resolve("only_second") == second / "only_second");
+        CHECK(index.resolve("only_third") == third / "only_third");
+        CHECK(index.resolve("missing").empty());
+        CHECK(index.resolve("").empty());
+
+        executable_index reversed{path_list({third, second, first}), {}};
+        CHECK(reversed.resolve("both") == second / "both");
+    }
+
+    void not_executable() {
+        executable_index index{path_list({first, second, third}), {}};
+
+        // a file without the execute bit is skipped for the next directory
+        CHECK(index.resolve("hidden") == second / "hidden");
+        CHECK(index.resolve("plain").empty());
+
+        // and so is a directory of the name
+        CHECK(index.resolve("directory").empty());
+    }
+
+    void names_with_a_directory() {
+        executable_index index{path_list({first}), {}};
+
+        // taken as they are, whatever PATH says
+        CHECK(index.resolve((third / "only_third").string()) == third / "only_third");
+        CHECK(index.resolve((third / "plain").string()).empty());
+        CHECK(index.resolve("./missing").empty());
+        CHECK(index.directory_scans() == 0);
+    }
+
+    void one_scan_per_directory() {
+        // the same directory twice, and an empty entry, which is skipped
+        executable_index index{path_list({first, second, first, third, second}) + "::", {}};
+
+        // found in the first directory, the others are not looked at yet
+        CHECK(index.resolve("both") == first / "both");
+        CHECK(index.directory_scans() == 1);
+
+        CHECK(index.resolve("only_third") == third / "only_third");
+        CHECK(index.directory_scans() == 3);
+
+        // every directory is listed already, however often it is asked
+        CHECK(index.resolve("missing").empty());
+        CHECK(index.resolve("only_second") == second / "only_second");
+        constexpr std::string_view names[] = {"both", "hidden", "missing", "only_third"};
+        const auto paths = index.resolve(names);
+        CHECK(paths.size() == 4 && paths[0] == first / "both" && paths[1] == second / "hidden" && paths[2].empty() && paths[3] == third / "only_third");
+        CHECK(index.directory_scans() == 3);
+
+        // a directory that does not exist counts as scanned once, with nothing in it
+        executable_index gone{path_list({scratch / "gone", first}), {}};
+        CHECK(gone.resolve("missing").empty());
+        CHECK(gone.resolve("missing").empty());
+        CHECK(gone.directory_scans() == 2);
+    }
+
+} // namespace
+
+int main() {
+    set_up();
+    path_order();
+    not_executable();
+    names_with_a_directory();
+    one_scan_per_directory();
+    std::filesystem::remove_all(scratch);
+    return holofetch::test::result();
+}
@@ -0,0 +1,136 @@
+#include "check.hpp"
+
+#include <vector>
+
+#include "holofetch/layout.hpp"
+
+namespace {
+
+    using holofetch::extent;
+    using holofetch::layout;
+    using holofetch::layout_input;
+    using holofetch::solve_layout;
+
+    constexpr extent avatar{80, 50};
+    constexpr extent landscape_header{40, 8};
+    constexpr extent portrait_header{60, 8};
+
+    layout_input input(extent console, const std::vector<extent>& sections) {
+        return {
+            .console = console,
+            .avatar = avatar,
+            .landscape_header = landscape_header,
+            .portrait_header = portrait_header,
+            .sections = sections,
+            .max_columns = 3,
+            .portrait_only = false,
+        };
+    }
+
+    void landscape_when_sections_fit_next_to_the_avatar() {
+        const std::vector<extent> sections(3, {30, 5});
+        const layout l = solve_layout(input({200, 80}, sections));
+
+        CHECK(!l.portrait);
+        CHECK(l.avatar && l.avatar->x == 0 && l.avatar->y == 0);
+        CHECK(l.header && l.header->x >= avatar.width);
+
+        // the avatar is as tall whatever the columns, so the fewest win
+        CHECK(l.columns == 1);
+        CHECK(l.sections.size() == 3);
+        for (size_t i = 0; i < l.sections.size(); ++i) {
+            CHECK(l.sections[i].x >= avatar.width);
+            CHECK(i == 0 || l.sections[i].y == l.sections[i - 1].y + 6);
+        }
+        CHECK(l.sections.back().y + 5 <= avatar.height);
+        CHECK(l.size.height == avatar.height);
+    }
+
+    void columns_when_one_is_too_tall() {
+        // stacked or two to a row they are taller than the avatar, three to a row they fit
+        const std::vector<extent> sections(3, {30, 20});
+        const layout l = solve_layout(input({200, 80}, sections));
+
+        CHECK(!l.portrait);
+        CHECK(l.columns == 3);
+        CHECK(l.sections[0].y == l.sections[1].y && l.sections[1].y == l.sections[2].y);
+        CHECK(l.sections[0].x == avatar.width + 2);
+        CHECK(l.sections[1].x == l.sections[0].x + 32 && l.sections[2].x == l.sections[1].x + 32);
+    }
+
+    void portrait_when_too_tall_next_to_the_avatar() {
+        // 40 columns next to the avatar take one section a row, which is taller than it
+        const std::vector<extent> sections(3, {30, 20});
+        const layout l = solve_layout(input({120, 80}, sections));
+
+        CHECK(l.portrait);
+        CHECK(l.avatar && l.avatar->x == 20 && l.avatar->y == 0);
+        CHECK(!l.header);
+
+        // only side by side do they fit the console height
+        CHECK(l.columns == 3);
+        CHECK(l.size.height <= 80);
+        for (const auto& p : l.sections) {
+            CHECK(p.y == avatar.height + 1);
+        }
+    }
+
+    void portrait_only() {
+        const std::vector<extent> sections(3, {30, 5});
+        layout_input in = input({200, 80}, sections);
+        in.portrait_only = true;
+        const layout l = solve_layout(in);
+
+        CHECK(l.portrait);
+        CHECK(l.avatar && l.avatar->x == 60 && l.avatar->y == 0);
+        for (const auto& p : l.sections) {
+            CHECK(p.y > avatar.height);
+        }
+    }
+
+    void header_without_avatar() {
+        // too low for the avatar, but high enough for the header in its place
+        const std::vector<extent> sections(2, {30, 5});
+        const layout l = solve_layout(input({100, 30}, sections));
+
+        CHECK(l.portrait);
+        CHECK(!l.avatar);
+        CHECK(l.header && l.header->x == 20 && l.header->y == 0);
+        CHECK(l.sections[0].y > portrait_header.height);
+    }
+
+    void plain_list() {
+        // neither the avatar nor the header: sections one under the other, indented
+        const std::vector<extent> sections{{30, 5}, {50, 3}, {20, 4}};
+        const layout l = solve_layout(input({100, 20}, sections));
+
+        CHECK(l.portrait);
+        CHECK(!l.avatar && !l.header);
+        CHECK(l.columns == 1);
+        CHECK(l.sections[0].x == 4 && l.sections[0].y == 0);
+        CHECK(l.sections[1].x == 4 && l.sections[1].y == 6);
+        CHECK(l.sections[2].x == 4 && l.sections[2].y == 10);
+        CHECK(l.size.width == 54 && l.size.height == 14);
+    }
+
+    void narrowest_when_nothing_fits() {
+        const std::vector<extent> sections(3, {70, 5});
+        const layout l = solve_layout(input({60, 20}, sections));
+
+        // nothing is narrower than a section, so one to a row
+        CHECK(l.columns == 1);
+        CHECK(l.size.width == 74);
+    }
+
+} // namespace
+
+int main() {
+    landscape_when_sections_fit_next_to_the_avatar();
+    columns_when_one_is_too_tall();
+    portrait_when_too_tall_next_to_the_avatar();
+    portrait_only();
+    header_without_avatar();
+    plain_list();
+    narrowest_when_nothing_fits();
+    return holofetch::test::result();
+}
@@ -0,0 +1,136 @@
+#include "check.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "holofetch/metadata.hpp"
+
+namespace {
+
+    namespace metadata = holofetch::metadata;
+
+    // run from the repository root, see build.sh
+    const std::filesystem::path fixtures{"tests/fixtures"};
+
+    std::vector<std::byte> load(const std::filesystem::path& name) {
+        std::ifstream in(fixtures / name, std::ios::binary);
+        std::vector<char> chars{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+
+        std::vector<std::byte> bytes(chars.size());
+        for (size_t i = 0; i < chars.size(); ++i) {
+            bytes[i] = static_cast<std::byte>(chars[i]);
+        }
+        return bytes;
+    }
+
+    void write_u32(std::vector<std::byte>& image, size_t offset, uint32_t v) {
+        for (size_t i = 0; i < 4; ++i) {
+            image[offset + i] = static_cast<std::byte>(v >> (8 * i));
+        }
+    }
+
+    void pe_valid() {
+        auto version = metadata::read_pe_version(fixtures / "version.dll");
+        CHECK(version.has_value());
+        if (!version)
+            return;
+
+        CHECK(version->major == 3 && version->minor == 12 && version->build == 1150 && version->revision == 1013);
+        CHECK(version->product_version == "3.12.1");
+        CHECK(version->file_version == "3.12.1150.1013");
+        CHECK(version->machine == "x64");
+    }
+
+    void pe_truncated() {
+        CHECK(!metadata::read_pe_version(fixtures / "version_truncated.dll"));
+
+        // every cut of the valid image, headers and resource tree included
+        const auto image = load("version.dll");
+        for (size_t size = 0; size < image.size(); ++size) {
+            auto version = metadata::read_pe_version(std::span{image}.first(size));
+            CHECK(!version || version->product_version.empty() || version->product_version == "3.12.1");
+        }
+    }
+
+    void pe_malformed() {
+        // the version data entry claims 2 GiB
+        CHECK(!metadata::read_pe_version(fixtures / "version_malformed.dll"));
+
+        const auto image = load("version.dll");
+        CHECK(!image.empty());
+        if (image.empty())
+            return;
+
+        // e_lfanew past the end of the file
+        auto far_header = image;
+        write_u32(far_header, 0x3C, 0xFFFFFFF0);
+        CHECK(!metadata::read_pe_version(far_header));
+
+        // the resource directory in no section
+        auto lost_resources = image;
+        write_u32(lost_resources, 0x58 + 112 + 2 * 8, 0x00F00000);
+        CHECK(!metadata::read_pe_version(lost_resources));
+
+        // the name directory of the version type points back at the root
+        auto cycle = image;
+        write_u32(cycle, 0x200 + 0x18 + 16 + 4, 0x80000000);
+        CHECK(!metadata::read_pe_version(cycle));
+
+        // every byte of the resource tree and the version block overwritten in turn
+        for (size_t offset = 0x200; offset < image.size(); ++offset) {
+            auto corrupt = image;
+            corrupt[offset] = std::byte{0xFF};
+            metadata::read_pe_version(corrupt);
+        }
+
+        CHECK(!metadata::read_pe_version(load("comment.o")));
+    }
+
+    void elf_valid() {
+        auto comments = metadata::read_elf_comments(fixtures / "comment.o");
+        CHECK(comments.size() == 1);
+        CHECK(!comments.empty() && comments.front().starts_with("GCC: "));
+
+        const auto image = load("comment.o");
+        CHECK(metadata::find_elf_section(image, ".text").has_value());
+        CHECK(!metadata::find_elf_section(image, ".missing"));
+    }
+
+    void elf_truncated() {
+        // the section headers are cut off after the second one
+        CHECK(metadata::read_elf_comments(fixtures / "comment_truncated.o").empty());
+
+        const auto image = load("comment.o");
+        for (size_t size = 0; size < image.size(); ++size) {
+            auto section = metadata::find_elf_section(std::span{image}.first(size), ".comment");
+            CHECK(!section || (section->data() >= image.data() && section->data() + section->size() <= image.data() + size));
+        }
+    }
+
+    void elf_malformed() {
+        // .comment claims nearly 2^64 bytes
+        CHECK(metadata::read_elf_comments(fixtures / "comment_malformed.o").empty());
+
+        const auto image = load("comment.o");
+        for (size_t offset = 0; offset < image.size(); ++offset) {
+            auto corrupt = image;
+            corrupt[offset] = std::byte{0xFF};
+            auto section = metadata::find_elf_section(corrupt, ".comment");
+            CHECK(!section || (section->data() >= corrupt.data() && section->data() + section->size() <= corrupt.data() + corrupt.size()));
+        }
+
+        CHECK(!metadata::find_elf_section(load("version.dll"), ".comment"));
+    }
+
+} // namespace
+
+int main() {
+    pe_valid();
+    pe_truncated();
+    pe_malformed();
+    elf_valid();
+    elf_truncated();
+    elf_malformed();
+    return holofetch::test::result();
+}
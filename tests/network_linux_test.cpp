@@ -0,0 +1,228 @@
+#include "check.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <linux/if.h>
+#include <linux/if_arp.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+
+#include "holofetch/network.hpp"
+
+namespace {
+
+    using holofetch::network::rtnetlink_adapters;
+
+    /*
+     * A netlink message built the way the kernel lays it out, header, family message and
+     * attributes each padded to NLMSG_ALIGN / RTA_ALIGN
+     */
+    class message {
+        std::vector<std::byte> bytes_;
+
+        nlmsghdr* header() noexcept { return reinterpret_cast<nlmsghdr*>(bytes_.data()); }
+
+    public:
+        template <class Family>
+        message(uint16_t type, const Family& family) : bytes_(NLMSG_SPACE(sizeof(Family))) {
+            header()->nlmsg_len = NLMSG_LENGTH(sizeof(Family));
+            header()->nlmsg_type = type;
+            std::memcpy(NLMSG_DATA(header()), &family, sizeof(Family));
+        }
+
+        message& attribute(uint16_t type, const void* data, size_t size) {
+            const size_t offset = NLMSG_ALIGN(header()->nlmsg_len);
+            bytes_.resize(offset + RTA_SPACE(size));
+            auto* rta = reinterpret_cast<rtattr*>(bytes_.data() + offset);
+            rta->rta_len = static_cast<unsigned short>(RTA_LENGTH(size));
+            rta->rta_type = type;
+            std::memcpy(RTA_DATA(rta), data, size);
+            header()->nlmsg_len = static_cast<uint32_t>(offset + RTA_LENGTH(size));
+            return *this;
+        }
+
+        message& attribute(uint16_t type, std::string_view text) {
+            std::string terminated{text};
+            return attribute(type, terminated.c_str(), terminated.size() + 1);
+        }
+
+        /* IFLA_LINKINFO holding only IFLA_INFO_KIND */
+        message& kind(std::string_view kind) {
+            std::vector<std::byte> nested(RTA_SPACE(kind.size() + 1));
+            auto* rta = reinterpret_cast<rtattr*>(nested.data());
+            rta->rta_len = static_cast<unsigned short>(RTA_LENGTH(kind.size() + 1));
+            rta->rta_type = IFLA_INFO_KIND;
+            std::memcpy(RTA_DATA(rta), kind.data(), kind.size());
+            return attribute(IFLA_LINKINFO, nested.data(), nested.size());
+        }
+
+        std::span<const std::byte> bytes() const noexcept { return {bytes_.data(), bytes_.size()}; }
+        std::vector<std::byte>& raw() noexcept { return bytes_; }
+    };
+
+    message link(int index, unsigned flags = IFF_UP, unsigned short type = ARPHRD_ETHER) {
+        ifinfomsg ifi{};
+        ifi.ifi_family = AF_UNSPEC;
+        ifi.ifi_index = index;
+        ifi.ifi_flags = flags;
+        ifi.ifi_type = type;
+        return {RTM_NEWLINK, ifi};
+    }
+
+    message address(int index, uint8_t family) {
+        ifaddrmsg ifa{};
+        ifa.ifa_family = family;
+        ifa.ifa_index = static_cast<uint32_t>(index);
+        return {RTM_NEWADDR, ifa};
+    }
+
+    in_addr ipv4(const char* text) {
+        in_addr a{};
+        inet_pton(AF_INET, text, &a);
+        return a;
+    }
+
+    in6_addr ipv6(const char* text) {
+        in6_addr a{};
+        inet_pton(AF_INET6, text, &a);
+        return a;
+    }
+
+    constexpr uint8_t mac[] = {0x02, 0xFC, 0x00, 0x0A, 0xBE, 0x01};
+
+    void links() {
+        rtnetlink_adapters adapters;
+        adapters.add_link(link(1, IFF_UP | IFF_LOOPBACK, ARPHRD_LOOPBACK).attribute(IFLA_IFNAME, "lo").bytes());
+        adapters.add_link(link(2).attribute(IFLA_IFNAME, "eth0").attribute(IFLA_ADDRESS, mac, sizeof(mac)).bytes());
+        adapters.add_link(link(3).attribute(IFLA_IFNAME, "docker0").kind("bridge").bytes());
+        adapters.add_link(link(4).attribute(IFLA_IFNAME, "veth1a2b").kind("veth").bytes());
+        adapters.add_link(link(5).attribute(IFLA_IFNAME, "wg0").kind("wireguard").bytes());
+        adapters.add_link(link(6).bytes());
+
+        // loopback flagged either way is skipped
+        adapters.add_link(link(7, IFF_UP | IFF_LOOPBACK).attribute(IFLA_IFNAME, "lo2").bytes());
+        adapters.add_link(link(8, IFF_UP, ARPHRD_LOOPBACK).attribute(IFLA_IFNAME, "lo3").bytes());
+
+        const auto info = adapters.take();
+        CHECK(info.adapters.size() == 3);
+        if (info.adapters.size() != 3)
+            return;
+
+        CHECK(info.adapters[0].name == "eth0");
+        CHECK(info.adapters[0].mac == "02-FC-00-0A-BE-01");
+        CHECK(info.adapters[0].description == "N/A");
+
+        CHECK(info.adapters[1].name == "wg0");
+        CHECK(info.adapters[1].description == "wireguard");
+        CHECK(info.adapters[1].mac.empty());
+
+        // no attributes at all
+        CHECK(info.adapters[2].name == "N/A");
+        CHECK(info.adapters[2].description == "N/A");
+    }
+
+    void addresses() {
+        rtnetlink_adapters adapters;
+        adapters.add_link(link(1, IFF_UP | IFF_LOOPBACK, ARPHRD_LOOPBACK).attribute(IFLA_IFNAME, "lo").bytes());
+        adapters.add_link(link(2).attribute(IFLA_IFNAME, "eth0").bytes());
+        adapters.add_link(link(3).attribute(IFLA_IFNAME, "docker0").kind("bridge").bytes());
+        adapters.add_link(link(4).attribute(IFLA_IFNAME, "ppp0").bytes());
+
+        const auto a = ipv4("192.168.1.20");
+        const auto b = ipv4("10.0.0.7");
+        const auto peer = ipv4("10.64.0.1");
+        const auto local = ipv4("10.64.0.2");
+        const auto v6 = ipv6("fe80::fc:aff:febe:1");
+
+        adapters.add_address(address(2, AF_INET).attribute(IFA_ADDRESS, &a, sizeof(a)).bytes());
+        adapters.add_address(address(2, AF_INET).attribute(IFA_ADDRESS, &b, sizeof(b)).attribute(IFA_LOCAL, &b, sizeof(b)).bytes());
+        adapters.add_address(address(2, AF_INET6).attribute(IFA_ADDRESS, &v6, sizeof(v6)).bytes());
+
+        // the peer of a point-to-point link comes first, the local address wins
+        adapters.add_address(address(4, AF_INET).attribute(IFA_ADDRESS, &peer, sizeof(peer)).attribute(IFA_LOCAL, &local, sizeof(local)).bytes());
+
+        // loopback, a skipped bridge and an index never seen
+        adapters.add_address(address(1, AF_INET).attribute(IFA_ADDRESS, &a, sizeof(a)).bytes());
+        adapters.add_address(address(3, AF_INET).attribute(IFA_ADDRESS, &a, sizeof(a)).bytes());
+        adapters.add_address(address(42, AF_INET).attribute(IFA_ADDRESS, &a, sizeof(a)).bytes());
+
+        // no address at all, one too short for its family and a family that is neither
+        adapters.add_address(address(2, AF_INET).bytes());
+        adapters.add_address(address(2, AF_INET6).attribute(IFA_ADDRESS, &a, sizeof(a)).bytes());
+        adapters.add_address(address(2, AF_PACKET).attribute(IFA_ADDRESS, &a, sizeof(a)).bytes());
+
+        const auto info = adapters.take();
+        CHECK(info.adapters.size() == 2);
+        if (info.adapters.size() != 2)
+            return;
+
+        const auto& eth0 = info.adapters[0];
+        CHECK(eth0.ipv4 == (std::vector<std::string>{"192.168.1.20", "10.0.0.7"}));
+        CHECK(eth0.ipv6 == (std::vector<std::string>{"fe80::fc:aff:febe:1"}));
+
+        const auto& ppp0 = info.adapters[1];
+        CHECK(ppp0.ipv4 == (std::vector<std::string>{"10.64.0.2"}));
+        CHECK(ppp0.ipv6.empty());
+    }
+
+    void malformed() {
+        rtnetlink_adapters adapters;
+
+        // shorter than a header, or than the header and its family message
+        adapters.add_link({});
+        auto whole = link(1).attribute(IFLA_IFNAME, "eth0");
+        adapters.add_link(whole.bytes().first(sizeof(nlmsghdr)));
+
+        // nlmsg_len past the end of what was received
+        adapters.add_link(whole.bytes().first(whole.bytes().size() - 4));
+
+        // an answer of another type
+        auto other = link(2).attribute(IFLA_IFNAME, "eth1");
+        reinterpret_cast<nlmsghdr*>(other.raw().data())->nlmsg_type = RTM_DELLINK;
+        adapters.add_link(other.bytes());
+
+        CHECK(adapters.take().adapters.empty());
+
+        // an attribute claiming more than the message holds is where the walk stops
+        rtnetlink_adapters cut;
+        auto lying = link(3).attribute(IFLA_IFNAME, "eth2").attribute(IFLA_ADDRESS, mac, sizeof(mac));
+        auto& bytes = lying.raw();
+        auto* last = reinterpret_cast<rtattr*>(bytes.data() + NLMSG_ALIGN(NLMSG_LENGTH(sizeof(ifinfomsg))) + RTA_SPACE(5));
+        last->rta_len = 0xFFF0;
+        cut.add_link(lying.bytes());
+
+        // a name without its terminator stays within the attribute
+        auto unterminated = link(4);
+        unterminated.attribute(IFLA_IFNAME, "eth3", 4);
+        cut.add_link(unterminated.bytes());
+
+        // and a length too small to be an attribute ends the walk as well
+        auto tiny = link(5).attribute(IFLA_IFNAME, "eth4");
+        reinterpret_cast<rtattr*>(tiny.raw().data() + NLMSG_ALIGN(NLMSG_LENGTH(sizeof(ifinfomsg))))->rta_len = 2;
+        cut.add_link(tiny.bytes());
+
+        const auto info = cut.take();
+        CHECK(info.adapters.size() == 3);
+        if (info.adapters.size() != 3)
+            return;
+        CHECK(info.adapters[0].name == "eth2" && info.adapters[0].mac.empty());
+        CHECK(info.adapters[1].name == "eth3");
+        CHECK(info.adapters[2].name == "N/A");
+    }
+
+} // namespace
+
+int main() {
+    links();
+    addresses();
+    malformed();
+    return holofetch::test::result();
+}
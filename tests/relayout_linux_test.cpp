@@ -0,0 +1,151 @@
+#include "check.hpp"
+#include "screen.hpp"
+
+#include <cstdlib>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "holofetch/default_avatar.hpp"
+#include "holofetch/renderer.hpp"
+
+namespace {
+
+    using namespace holofetch;
+    using holofetch::test::screen;
+
+    std::pmr::vector<section> sections(std::pmr::memory_resource* memory) {
+        std::pmr::vector<section> s{memory};
+        s.reserve(3);
+
+        auto& hardware = s.emplace_back("Hardware");
+        hardware.properties.emplace_back("CPU", "Some processor with a name long enough to matter");
+        hardware.properties.emplace_back("RAM", "002 GB / 016 GB [ \033[92m12\033[0m% ]");
+
+        auto& terminal = s.emplace_back("Terminal");
+        terminal.properties.emplace_back("Uptime", "7 seconds");
+
+        auto& software = s.emplace_back("Software");
+        software.properties.emplace_back("OS", "Linux 6.18");
+        software.properties.emplace_back("Shell", "bash 5.2");
+        return s;
+    }
+
+    /*
+     * Standard output goes to a file while it lives, what was written is read back
+     */
+    class capture {
+        std::string path_{"/tmp/holofetch_relayout_XXXXXX"};
+        int saved_{-1};
+
+    public:
+        capture() {
+            const int fd = ::mkstemp(path_.data());
+            saved_ = ::dup(STDOUT_FILENO);
+            ::dup2(fd, STDOUT_FILENO);
+            ::close(fd);
+        }
+
+        ~capture() {
+            ::dup2(saved_, STDOUT_FILENO);
+            ::close(saved_);
+            ::unlink(path_.c_str());
+        }
+
+        std::string text() const {
+            return read_file(path_);
+        }
+    };
+
+    /*
+     * Not a terminal, so the size comes from COLUMNS and LINES
+     */
+    void resize(size_t width, size_t height) {
+        ::setenv("COLUMNS", std::to_string(width).c_str(), 1);
+        ::setenv("LINES", std::to_string(height).c_str(), 1);
+    }
+
+    void set_up(renderer& r) {
+        r.set_color_depth(sgr::color_depth::truecolor);
+
+        image avatar;
+        avatar.cells = assets::default_avatar();
+        r.set_avatar(std::move(avatar));
+    }
+
+    /*
+     * What a fresh redraw at width x height shows
+     */
+    screen redrawn(size_t width, size_t height) {
+        resize(width, height);
+        capture out;
+        {
+            renderer r;
+            set_up(r);
+            r.redraw(sections(r.begin_frame()));
+        }
+
+        screen s{width, height};
+        s.write(out.text());
+        return s;
+    }
+
+    /*
+     * Laid out again from the sprites of the frame before, the screen is the same as a fresh
+     * redraw at the new size
+     */
+    void relayout_matches_redraw(size_t from_width, size_t from_height, size_t to_width, size_t to_height) {
+        resize(from_width, from_height);
+        std::string output;
+        {
+            capture out;
+            renderer r;
+            set_up(r);
+            r.redraw(sections(r.begin_frame()));
+
+            // the same size draws nothing
+            CHECK(!r.relayout());
+
+            resize(to_width, to_height);
+            CHECK(r.relayout());
+            output = out.text();
+        }
+
+        screen relaid{to_width, to_height};
+        relaid.write(output);
+
+        const screen expected = redrawn(to_width, to_height);
+        CHECK(relaid == expected);
+        for (size_t y = 0; y < to_height; ++y) {
+            if (relaid.row(y) != expected.row(y)) {
+                std::fprintf(stderr, "%zux%zu to %zux%zu, row %zu:\n  %s\n  %s\n", from_width, from_height, to_width, to_height, y, relaid.row(y).c_str(), expected.row(y).c_str());
+                break;
+            }
+        }
+    }
+
+    void nothing_to_lay_out_after_begin_frame() {
+        resize(200, 80);
+        capture out;
+        renderer r;
+        set_up(r);
+        r.redraw(sections(r.begin_frame()));
+
+        // the sprites went with the arena
+        r.begin_frame();
+        resize(150, 70);
+        CHECK(!r.relayout());
+    }
+
+} // namespace
+
+int main() {
+    // landscape to portrait and back, a narrower console, one too low for the avatar
+    relayout_matches_redraw(200, 80, 150, 70);
+    relayout_matches_redraw(120, 90, 200, 80);
+    relayout_matches_redraw(200, 80, 160, 80);
+    relayout_matches_redraw(200, 80, 100, 40);
+    nothing_to_lay_out_after_begin_frame();
+    return holofetch::test::result();
+}
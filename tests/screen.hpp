@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "holofetch/sgr.hpp"
+#include "holofetch/unicode.hpp"
+
+namespace holofetch::test {
+
+    /*
+     * A terminal just capable enough to show what holofetch writes, so that two outputs can be
+     * compared by what they put on the screen rather than byte by byte
+     * It understands printable UTF-8 (wide glyphs take two cells), CR, LF (as CR LF, like a tty
+     * with onlcr), CUP, ED 2 and SGR, and ignores the private modes holofetch sets; SGR is decoded
+     * here rather than with sgr::apply, so it checks the encoder instead of agreeing with it
+     * Writing past the right edge wraps, past the bottom scrolls
+     */
+    class screen {
+    public:
+        struct cell {
+            char32_t codepoint{' '};
+            sgr::style style;
+
+            bool operator==(const cell&) const noexcept = default;
+        };
+
+        static constexpr char32_t wide_tail{0xFFFFFFFF};
+
+        screen(size_t width, size_t height)
+            : width_{width}, height_{height}, cells_(width * height) {}
+
+        size_t width() const noexcept { return width_; }
+        size_t height() const noexcept { return height_; }
+
+        const cell& at(size_t x, size_t y) const noexcept {
+            return cells_[y * width_ + x];
+        }
+
+        /*
+         * The cell as it looks: a blank shows only its background and the attributes that draw
+         * lines or swap colors
+         */
+        cell shown(size_t x, size_t y) const noexcept {
+            using enum sgr::attribute;
+            cell c = at(x, y);
+            if (c.codepoint == ' ') {
+                c.style.fg = 0;
+                c.style.attributes &= underline | inverse | strike;
+            }
+            return c;
+        }
+
+        bool operator==(const screen& other) const noexcept {
+            if (width_ != other.width_ || height_ != other.height_)
+                return false;
+
+            for (size_t y = 0; y < height_; ++y) {
+                for (size_t x = 0; x < width_; ++x) {
+                    if (!(shown(x, y) == other.shown(x, y)))
+                        return false;
+                }
+            }
+            return true;
+        }
+
+        /*
+         * The glyphs of row y, for failure messages
+         */
+        std::string row(size_t y) const {
+            std::string text;
+            for (size_t x = 0; x < width_; ++x) {
+                char32_t cp = at(x, y).codepoint;
+                if (cp == wide_tail)
+                    continue;
+                append_utf8(text, cp);
+            }
+            return text;
+        }
+
+        const sgr::style& style() const noexcept { return style_; }
+
+        void write(std::string_view bytes) {
+            size_t i = 0;
+            while (i < bytes.size()) {
+                const auto c = static_cast<unsigned char>(bytes[i]);
+
+                if (c == 0x1B) {
+                    i = escape(bytes, i);
+                } else if (c == '\n') {
+                    x_ = 0;
+                    line_feed();
+                    ++i;
+                } else if (c == '\r') {
+                    x_ = 0;
+                    ++i;
+                } else if (c < 0x20 || c == 0x7F) {
+                    ++i;
+                } else {
+                    size_t length = 0;
+                    char32_t cp = unicode::decode_utf8(bytes.substr(i), length);
+                    put(cp);
+                    i += length > 0 ? length : 1;
+                }
+            }
+        }
+
+    private:
+        size_t width_;
+        size_t height_;
+        std::vector<cell> cells_;
+        size_t x_{0};
+        size_t y_{0};
+        sgr::style style_;
+
+        static void append_utf8(std::string& out, char32_t c) {
+            if (c < 0x80) {
+                out += static_cast<char>(c);
+            } else if (c < 0x800) {
+                out += static_cast<char>(0xC0 | (c >> 6));
+                out += static_cast<char>(0x80 | (c & 0x3F));
+            } else if (c < 0x10000) {
+                out += static_cast<char>(0xE0 | (c >> 12));
+                out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (c & 0x3F));
+            } else {
+                out += static_cast<char>(0xF0 | (c >> 18));
+                out += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+                out += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (c & 0x3F));
+            }
+        }
+
+        void line_feed() {
+            if (y_ + 1 < height_) {
+                ++y_;
+                return;
+            }
+
+            cells_.erase(cells_.begin(), cells_.begin() + static_cast<std::ptrdiff_t>(width_));
+            cells_.resize(width_ * height_);
+        }
+
+        void put(char32_t cp) {
+            const int columns = unicode::codepoint_width(cp);
+            if (columns <= 0)
+                return;
+
+            if (x_ + static_cast<size_t>(columns) > width_) {
+                x_ = 0;
+                line_feed();
+            }
+
+            cells_[y_ * width_ + x_++] = {cp, style_};
+            if (columns == 2) {
+                cells_[y_ * width_ + x_++] = {wide_tail, style_};
+            }
+        }
+
+        /*
+         * Returns the index after the sequence starting at i
+         */
+        size_t escape(std::string_view bytes, size_t i) {
+            if (i + 1 >= bytes.size() || bytes[i + 1] != '[')
+                return i + 2;
+
+            size_t end = i + 2;
+            while (end < bytes.size() && !(bytes[end] >= 0x40 && bytes[end] <= 0x7E)) {
+                ++end;
+            }
+            if (end == bytes.size())
+                return end;
+
+            const std::string_view parameters = bytes.substr(i + 2, end - i - 2);
+            switch (bytes[end]) {
+                case 'm':
+                    select_graphic_rendition(parameters);
+                    break;
+                case 'H': {
+                    auto ps = numbers(parameters);
+                    y_ = std::min(ps.size() > 0 && ps[0] > 0 ? ps[0] - 1 : 0, height_ - 1);
+                    x_ = std::min(ps.size() > 1 && ps[1] > 0 ? ps[1] - 1 : 0, width_ - 1);
+                    break;
+                }
+                case 'J':
+                    if (parameters == "2") {
+                        std::fill(cells_.begin(), cells_.end(), cell{' ', style_});
+                    }
+                    break;
+                default:
+                    // ?1049h, ?25l, ?2026h and the like
+                    break;
+            }
+            return end + 1;
+        }
+
+        static std::vector<size_t> numbers(std::string_view parameters) {
+            std::vector<size_t> ps{0};
+            for (char c : parameters) {
+                if (c == ';') {
+                    ps.push_back(0);
+                } else if (c >= '0' && c <= '9') {
+                    ps.back() = ps.back() * 10 + static_cast<size_t>(c - '0');
+                }
+            }
+            return ps;
+        }
+
+        void select_graphic_rendition(std::string_view parameters) {
+            using enum sgr::attribute;
+
+            const auto ps = numbers(parameters);
+            for (size_t i = 0; i < ps.size(); ++i) {
+                const size_t p = ps[i];
+                switch (p) {
+                    case 0: style_ = {}; break;
+                    case 1: style_.attributes |= bold; break;
+                    case 2: style_.attributes |= dim; break;
+                    case 3: style_.attributes |= italic; break;
+                    case 4: style_.attributes |= underline; break;
+                    case 5: style_.attributes |= blink; break;
+                    case 7: style_.attributes |= inverse; break;
+                    case 8: style_.attributes |= hidden; break;
+                    case 9: style_.attributes |= strike; break;
+                    case 22: style_.attributes &= ~(bold | dim); break;
+                    case 23: style_.attributes &= ~italic; break;
+                    case 24: style_.attributes &= ~underline; break;
+                    case 25: style_.attributes &= ~blink; break;
+                    case 27: style_.attributes &= ~inverse; break;
+                    case 28: style_.attributes &= ~hidden; break;
+                    case 29: style_.attributes &= ~strike; break;
+                    case 39: style_.fg = 0; break;
+                    case 49: style_.bg = 0; break;
+                    case 38:
+                    case 48: {
+                        sgr::color c = 0;
+                        if (i + 2 < ps.size() && ps[i + 1] == 5) {
+                            c = (2u << 24) | static_cast<sgr::color>(ps[i + 2]);
+                            i += 2;
+                        } else if (i + 4 < ps.size() && ps[i + 1] == 2) {
+                            c = (3u << 24) | static_cast<sgr::color>(ps[i + 2] << 16 | ps[i + 3] << 8 | ps[i + 4]);
+                            i += 4;
+                        }
+                        (p == 38 ? style_.fg : style_.bg) = c;
+                        break;
+                    }
+                    default:
+                        if ((p >= 30 && p <= 37) || (p >= 90 && p <= 97)) {
+                            style_.fg = (1u << 24) | static_cast<sgr::color>(p);
+                        } else if ((p >= 40 && p <= 47) || (p >= 100 && p <= 107)) {
+                            style_.bg = (1u << 24) | static_cast<sgr::color>(p);
+                        }
+                        break;
+                }
+            }
+        }
+    };
+
+} // namespace holofetch::test
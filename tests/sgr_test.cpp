@@ -0,0 +1,315 @@
+#include "check.hpp"
+#include "screen.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "holofetch/canvas.hpp"
+
+namespace {
+
+    using holofetch::canvas;
+    using holofetch::test::screen;
+    namespace sgr = holofetch::sgr;
+
+    /*
+     * Every cell with its full style after a reset, the output the encoder is measured against
+     */
+    std::string unminimized(const canvas& c) {
+        std::string out;
+
+        auto color = [&](sgr::color v, bool background) {
+            switch (v >> 24) {
+                case 1: out += ';' + std::to_string(v & 0xFF); break;
+                case 2: out += background ? ";48;5;" : ";38;5;"; out += std::to_string(v & 0xFF); break;
+                case 3:
+                    out += background ? ";48;2;" : ";38;2;";
+                    out += std::to_string((v >> 16) & 0xFF) + ';' + std::to_string((v >> 8) & 0xFF) + ';' + std::to_string(v & 0xFF);
+                    break;
+                default: break;
+            }
+        };
+
+        for (size_t y = 0; y < c.height(); ++y) {
+            for (size_t x = 0; x < c.width(); ++x) {
+                const char32_t cp = c.codepoint(x, y);
+                if (cp == canvas::wide_tail)
+                    continue;
+
+                const sgr::style s = cp == 0 ? sgr::style{} : c.style(x, y);
+                out += "\033[0";
+                constexpr int codes[] = {1, 2, 3, 4, 5, 7, 8, 9};
+                for (size_t i = 0; i < std::size(codes); ++i) {
+                    if (s.attributes & (1 << i))
+                        out += ';' + std::to_string(codes[i]);
+                }
+                color(s.fg, false);
+                color(s.bg, true);
+                out += 'm';
+
+                if (cp == 0 || cp == U' ') {
+                    out += ' ';
+                } else {
+                    // borrow the canvas for the UTF-8, a lone glyph comes out as itself and a newline
+                    canvas glyph(2, 1);
+                    glyph.set(0, 0, cp, {});
+                    glyph.encode(out, sgr::color_depth::none);
+                    out.pop_back();
+                }
+            }
+            out += "\033[0m\n";
+        }
+
+        return out;
+    }
+
+    screen show(std::string_view output, const canvas& c) {
+        // one more row for the newline after the last one
+        screen s{c.width(), c.height() + 1};
+        s.write(output);
+        return s;
+    }
+
+    canvas random_canvas(std::mt19937& random, size_t width, size_t height) {
+        constexpr char32_t glyphs[] = {U'a', U'Z', U'#', U'.', U' ', U' ', U' ', U'█', U'▀', U'中'};
+        auto pick = [&](size_t n) { return static_cast<size_t>(random() % n); };
+
+        // few distinct styles, so that runs of equal ones give the encoder something to save
+        std::vector<sgr::style> styles;
+        for (size_t i = 0; i < 6; ++i) {
+            auto color = [&]() -> sgr::color {
+                switch (pick(4)) {
+                    case 0: return 0;
+                    case 1: return (1u << 24) | static_cast<sgr::color>(30 + pick(8));
+                    case 2: return (2u << 24) | static_cast<sgr::color>(pick(256));
+                    default: return (3u << 24) | static_cast<sgr::color>(random() & 0xFFFFFF);
+                }
+            };
+
+            sgr::style s{color(), color(), static_cast<uint16_t>(pick(4) == 0 ? random() & 0xFF : 0)};
+            // the basic background codes are 40-47
+            if ((s.bg >> 24) == 1)
+                s.bg += 10;
+            styles.push_back(s);
+        }
+
+        canvas c(width, height);
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < width; ++x) {
+                if (pick(8) == 0)
+                    continue;
+
+                const char32_t cp = glyphs[pick(std::size(glyphs))];
+                const sgr::style s = styles[pick(styles.size())];
+                if (cp == U'中') {
+                    if (x + 1 == width)
+                        continue;
+                    c.set(x, y, cp, s);
+                    c.set(++x, y, canvas::wide_tail, s);
+                } else {
+                    c.set(x, y, cp, s);
+                }
+            }
+        }
+        return c;
+    }
+
+    void encode_matches_unminimized() {
+        std::mt19937 random{2024};
+
+        for (int round = 0; round < 200; ++round) {
+            const canvas c = random_canvas(random, 1 + random() % 40, 1 + random() % 8);
+
+            std::string minimized;
+            c.encode(minimized, sgr::color_depth::truecolor);
+            const std::string reference = unminimized(c);
+
+            const screen expected = show(reference, c);
+            const screen actual = show(minimized, c);
+            CHECK(actual == expected);
+            CHECK(actual.style() == sgr::style{});
+            CHECK(minimized.size() <= reference.size());
+        }
+    }
+
+    void changes_match_full_frame() {
+        std::mt19937 random{7};
+
+        for (int round = 0; round < 200; ++round) {
+            const size_t width = 1 + random() % 40;
+            const size_t height = 1 + random() % 8;
+            const canvas previous = random_canvas(random, width, height);
+            canvas next = previous;
+
+            // a few cells change, the rest stays
+            const canvas other = random_canvas(random, width, height);
+            for (size_t i = 0; i < 1 + random() % 6; ++i) {
+                size_t x = random() % width;
+                size_t y = random() % height;
+                if (other.codepoint(x, y) != canvas::wide_tail && previous.codepoint(x, y) != canvas::wide_tail
+                    && (x + 1 == width || previous.codepoint(x + 1, y) != canvas::wide_tail)
+                    && (x + 1 == width || other.codepoint(x + 1, y) != canvas::wide_tail)) {
+                    next.set(x, y, other.codepoint(x, y) == 0 ? U' ' : other.codepoint(x, y), other.style(x, y));
+                }
+            }
+
+            std::string output;
+            previous.encode(output, sgr::color_depth::truecolor);
+            next.encode_changes(previous, output, sgr::color_depth::truecolor);
+
+            std::string full;
+            next.encode(full, sgr::color_depth::truecolor);
+
+            CHECK(show(output, next) == show(full, next));
+        }
+    }
+
+    /*
+     * out after one glyph in a style with fg (or bg) set to c, written at depth
+     */
+    std::string encoded(sgr::color c, sgr::color_depth depth, bool background = false) {
+        sgr::style s;
+        (background ? s.bg : s.fg) = c;
+
+        std::string out;
+        sgr::encoder encoder{out, depth};
+        encoder.set(s);
+        encoder.glyph("x");
+        return out;
+    }
+
+    constexpr sgr::color rgb(int r, int g, int b) noexcept {
+        return (3u << 24) | (static_cast<sgr::color>(r) << 16) | (static_cast<sgr::color>(g) << 8) | static_cast<sgr::color>(b);
+    }
+
+    constexpr sgr::color indexed(int index) noexcept {
+        return (2u << 24) | static_cast<sgr::color>(index);
+    }
+
+    // the RGB of an entry of the 256 color palette, worked out here rather than taken from sgr.cpp
+    constexpr sgr::color palette_rgb(int index) noexcept {
+        constexpr int levels[] = {0, 95, 135, 175, 215, 255};
+        if (index >= 232)
+            return rgb(8 + 10 * (index - 232), 8 + 10 * (index - 232), 8 + 10 * (index - 232));
+        index -= 16;
+        return rgb(levels[index / 36], levels[index / 6 % 6], levels[index % 6]);
+    }
+
+    // the 256 color index an encoded foreground settled on, -1 for anything else
+    int indexed_of(std::string_view out) {
+        constexpr std::string_view prefix{"\033[38;5;"};
+        if (!out.starts_with(prefix))
+            return -1;
+        return std::atoi(out.data() + prefix.size());
+    }
+
+    void color_depth_names() {
+        CHECK(sgr::parse_color_depth("truecolor") == sgr::color_depth::truecolor);
+        CHECK(sgr::parse_color_depth("24bit") == sgr::color_depth::truecolor);
+        CHECK(sgr::parse_color_depth("256") == sgr::color_depth::indexed);
+        CHECK(sgr::parse_color_depth("16") == sgr::color_depth::basic);
+        CHECK(sgr::parse_color_depth("none") == sgr::color_depth::none);
+
+        for (std::string_view name : {"", "auto", "TrueColor", "24", "8", "256 ", "0x100", "None"})
+            CHECK(!sgr::parse_color_depth(name).has_value());
+    }
+
+    void downsampling() {
+        // one color at every depth, none leaves the glyph alone
+        CHECK(encoded(rgb(255, 0, 0), sgr::color_depth::truecolor) == "\033[38;2;255;0;0mx");
+        CHECK(encoded(rgb(255, 0, 0), sgr::color_depth::indexed) == "\033[38;5;196mx");
+        CHECK(encoded(rgb(255, 0, 0), sgr::color_depth::basic) == "\033[91mx");
+        CHECK(encoded(rgb(255, 0, 0), sgr::color_depth::none) == "x");
+        CHECK(encoded(rgb(255, 0, 0), sgr::color_depth::basic, true) == "\033[101mx");
+
+        // the default color stays the default, 16 color codes are shown everywhere
+        CHECK(encoded(0, sgr::color_depth::basic) == "x");
+        CHECK(encoded((1u << 24) | 33, sgr::color_depth::basic) == "\033[33mx");
+        CHECK(encoded((1u << 24) | 104, sgr::color_depth::indexed, true) == "\033[104mx");
+        CHECK(encoded(indexed(100), sgr::color_depth::indexed) == "\033[38;5;100mx");
+
+        // the first 16 of the 256 colors are the basic ones, the rest go to the nearest of them
+        CHECK(encoded(indexed(1), sgr::color_depth::basic) == "\033[31mx");
+        CHECK(encoded(indexed(12), sgr::color_depth::basic, true) == "\033[104mx");
+        CHECK(encoded(indexed(16), sgr::color_depth::basic) == "\033[30mx");
+        CHECK(encoded(indexed(21), sgr::color_depth::basic) == "\033[34mx");
+        CHECK(encoded(indexed(46), sgr::color_depth::basic) == "\033[92mx");
+        CHECK(encoded(indexed(196), sgr::color_depth::basic) == "\033[91mx");
+        CHECK(encoded(indexed(231), sgr::color_depth::basic) == "\033[97mx");
+        CHECK(encoded(indexed(232), sgr::color_depth::basic) == "\033[30mx");
+        CHECK(encoded(indexed(255), sgr::color_depth::basic) == "\033[37mx");
+
+        // xterm's RGB for the 16 colors comes back as their own codes
+        constexpr sgr::color xterm[] = {
+            rgb(0, 0, 0), rgb(205, 0, 0), rgb(0, 205, 0), rgb(205, 205, 0),
+            rgb(0, 0, 238), rgb(205, 0, 205), rgb(0, 205, 205), rgb(229, 229, 229),
+            rgb(127, 127, 127), rgb(255, 0, 0), rgb(0, 255, 0), rgb(255, 255, 0),
+            rgb(92, 92, 255), rgb(255, 0, 255), rgb(0, 255, 255), rgb(255, 255, 255),
+        };
+        for (int i = 0; i < 16; ++i) {
+            const int code = i < 8 ? 30 + i : 90 + i - 8;
+            CHECK(encoded(xterm[i], sgr::color_depth::basic) == "\033[" + std::to_string(code) + "mx");
+            CHECK(encoded(xterm[i], sgr::color_depth::basic, true) == "\033[" + std::to_string(code + 10) + "mx");
+        }
+    }
+
+    void palette_entries() {
+        // the 216 cube colors come back as themselves
+        for (int i = 16; i < 232; ++i) {
+            const int found = indexed_of(encoded(palette_rgb(i), sgr::color_depth::indexed));
+            CHECK(found == i);
+            if (found != i)
+                std::fprintf(stderr, "  cube entry %d came back as %d\n", i, found);
+        }
+
+        // so do the grays, except four that share an 8 level bucket of the table with a gray
+        // of the cube (88 and 95, 128 and 135, ...) and come out as that, 7 levels lighter
+        for (int i = 232; i < 256; ++i) {
+            const int found = indexed_of(encoded(palette_rgb(i), sgr::color_depth::indexed));
+            const int level = static_cast<int>(palette_rgb(i) & 0xFF);
+            const bool shared = level == 88 || level == 128 || level == 168 || level == 208;
+            CHECK(shared ? found >= 16 && found < 232 && palette_rgb(found) == rgb(level + 7, level + 7, level + 7) : found == i);
+            if (!shared && found != i)
+                std::fprintf(stderr, "  gray entry %d came back as %d\n", i, found);
+        }
+    }
+
+    void nearest_entries() {
+        // the first 16 entries are left to the user's theme, nothing is quantized to them
+        for (int r = 0; r < 256; r += 15) {
+            for (int g = 0; g < 256; g += 15) {
+                for (int b = 0; b < 256; b += 15) {
+                    const int found = indexed_of(encoded(rgb(r, g, b), sgr::color_depth::indexed));
+                    CHECK(found >= 16 && found < 256);
+                    if (found < 16 || found > 255)
+                        std::fprintf(stderr, "  %d,%d,%d came out as entry %d\n", r, g, b, found);
+                }
+            }
+        }
+
+        // colors between cube levels go to the nearer one
+        CHECK(indexed_of(encoded(rgb(200, 0, 0), sgr::color_depth::indexed)) == 16 + 36 * 4);
+        CHECK(indexed_of(encoded(rgb(0, 150, 0), sgr::color_depth::indexed)) == 16 + 6 * 2);
+        CHECK(indexed_of(encoded(rgb(255, 40, 0), sgr::color_depth::indexed)) == 196);
+        CHECK(indexed_of(encoded(rgb(255, 60, 0), sgr::color_depth::indexed)) == 202);
+
+        // near grays go to the gray ramp, which is finer than the cube's diagonal
+        CHECK(indexed_of(encoded(rgb(50, 50, 50), sgr::color_depth::indexed)) == 236);
+        CHECK(indexed_of(encoded(rgb(50, 52, 49), sgr::color_depth::indexed)) == 236);
+        CHECK(indexed_of(encoded(rgb(240, 240, 240), sgr::color_depth::indexed)) == 255);
+    }
+
+} // namespace
+
+int main() {
+    encode_matches_unminimized();
+    changes_match_full_frame();
+    color_depth_names();
+    downsampling();
+    palette_entries();
+    nearest_entries();
+    return holofetch::test::result();
+}
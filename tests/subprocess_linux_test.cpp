@@ -0,0 +1,158 @@
+#include "check.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <csignal>
+#include <unistd.h>
+
+#include "holofetch/subprocess.hpp"
+
+namespace {
+
+    namespace subprocess = holofetch::subprocess;
+
+    using namespace std::chrono_literals;
+    using clock = std::chrono::steady_clock;
+
+    void timeout() {
+        const auto start = clock::now();
+        auto r = subprocess::run("sleep 5", 200ms);
+        const auto elapsed = clock::now() - start;
+
+        CHECK(!r && r.error() == std::errc::timed_out);
+        CHECK(elapsed >= 200ms && elapsed < 1s);
+
+        // a child that is done in time is not affected
+        auto quick = subprocess::run("echo done", 5s);
+        CHECK(quick && quick->out == "done\n" && quick->code == 0);
+    }
+
+    void stop_request() {
+        std::stop_source source;
+        std::jthread stopper([&source] {
+            std::this_thread::sleep_for(200ms);
+            source.request_stop();
+        });
+
+        const auto start = clock::now();
+        auto r = subprocess::run("sleep 5", subprocess::infinite, source.get_token());
+        const auto elapsed = clock::now() - start;
+
+        CHECK(!r && r.error() == std::errc::operation_canceled);
+        CHECK(elapsed >= 200ms && elapsed < 1s);
+
+        // stopped before it starts, nothing is waited for
+        const auto again = clock::now();
+        auto stopped = subprocess::run("sleep 5", subprocess::infinite, source.get_token());
+        CHECK(!stopped && stopped.error() == std::errc::operation_canceled);
+        CHECK(clock::now() - again < 500ms);
+    }
+
+    /*
+     * Gone, or a zombie nobody reaped yet
+     */
+    bool dead(pid_t pid) {
+        std::ifstream stat("/proc/" + std::to_string(pid) + "/stat");
+        std::string line;
+        if (!std::getline(stat, line))
+            return true;
+        const auto state = line.rfind(") ");
+        return state != std::string::npos && state + 2 < line.size() && line[state + 2] == 'Z';
+    }
+
+    void process_group_killed() {
+        const auto pid_file = std::filesystem::temp_directory_path() / ("holofetch_subprocess_test." + std::to_string(::getpid()));
+        std::filesystem::remove(pid_file);
+
+        // the shell waits on a grandchild that would outlive it by far
+        auto r = subprocess::run("sh -c 'sleep 30 & echo $! > \"" + pid_file.string() + "\"; wait'", 300ms);
+        CHECK(!r && r.error() == std::errc::timed_out);
+
+        pid_t grandchild = 0;
+        std::ifstream(pid_file) >> grandchild;
+        std::filesystem::remove(pid_file);
+        CHECK(grandchild > 0);
+        if (grandchild <= 0)
+            return;
+
+        // the kill is sent before run returns, delivery may take a moment
+        const auto deadline = clock::now() + 1s;
+        while (!dead(grandchild) && clock::now() < deadline)
+            std::this_thread::sleep_for(10ms);
+        CHECK(dead(grandchild));
+        if (!dead(grandchild))
+            ::kill(grandchild, SIGKILL);
+    }
+
+    void batch_in_order() {
+        // the later commands finish first
+        constexpr std::string_view commands[] = {
+            "sh -c 'sleep 0.3; echo first'",
+            "sh -c 'sleep 0.1; echo second; exit 3'",
+            "sh -c 'echo third >&2'"
+        };
+
+        const auto start = clock::now();
+        auto results = subprocess::run_all(commands, 5s);
+        const auto elapsed = clock::now() - start;
+
+        CHECK(results.size() == 3);
+        CHECK(results[0] && results[0]->out == "first\n" && results[0]->code == 0);
+        CHECK(results[1] && results[1]->out == "second\n" && results[1]->code == 3);
+        CHECK(results[2] && results[2]->out.empty() && results[2]->err == "third\n");
+
+        // run side by side, not one after another
+        CHECK(elapsed < 350ms);
+    }
+
+    void batch_timeout() {
+        constexpr std::string_view commands[] = {
+            "echo quick",
+            "sleep 5",
+            "sh -c 'sleep 0.05; echo later'"
+        };
+
+        const auto start = clock::now();
+        auto results = subprocess::run_all(commands, 300ms);
+        const auto elapsed = clock::now() - start;
+
+        // only the one still running is cut off, the others keep what they wrote
+        CHECK(results.size() == 3);
+        CHECK(results[0] && results[0]->out == "quick\n");
+        CHECK(!results[1] && results[1].error() == std::errc::timed_out);
+        CHECK(results[2] && results[2]->out == "later\n");
+        CHECK(elapsed >= 300ms && elapsed < 1s);
+    }
+
+    void batch_with_missing_executable() {
+        constexpr std::string_view commands[] = {
+            "echo before",
+            "holofetch-no-such-executable --version",
+            "",
+            "echo after"
+        };
+
+        auto results = subprocess::run_all(commands, 5s);
+        CHECK(results.size() == 4);
+        CHECK(results[0] && results[0]->out == "before\n");
+        CHECK(!results[1] && results[1].error() == std::errc::no_child_process);
+        CHECK(!results[2] && results[2].error() == std::errc::invalid_argument);
+        CHECK(results[3] && results[3]->out == "after\n");
+    }
+
+} // namespace
+
+int main() {
+    timeout();
+    stop_request();
+    process_group_killed();
+    batch_in_order();
+    batch_timeout();
+    batch_with_missing_executable();
+    return holofetch::test::result();
+}
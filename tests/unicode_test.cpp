@@ -0,0 +1,144 @@
+#include "check.hpp"
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#include "holofetch/unicode.hpp"
+
+namespace {
+
+    namespace unicode = holofetch::unicode;
+
+    struct decoded {
+        std::string_view bytes;
+        char32_t cp;
+        size_t length;
+    };
+
+    void decode() {
+        constexpr decoded table[] = {
+            {"a", U'a', 1},
+            {"\x7F", 0x7F, 1},
+            {"\xC2\x80", 0x80, 2},
+            {"\xDF\xBF", 0x7FF, 2},
+            {"\xE0\xA0\x80", 0x800, 3},
+            {"中", U'中', 3},
+            {"\xED\x9F\xBF", 0xD7FF, 3},
+            {"\xEE\x80\x80", 0xE000, 3},
+            {"\xEF\xBF\xBD", 0xFFFD, 3},
+            {"\xF0\x90\x80\x80", 0x10000, 4},
+            {"😀", U'😀', 4},
+            {"\xF4\x8F\xBF\xBF", 0x10FFFF, 4},
+
+            // a continuation byte, a sequence cut short or interrupted
+            {"\x80", 0xFFFD, 1},
+            {"\xBF", 0xFFFD, 1},
+            {"\xE4\xB8", 0xFFFD, 1},
+            {"\xE4" "a" "\xAD", 0xFFFD, 1},
+            {"\xF0\x9F\x98", 0xFFFD, 1},
+
+            // overlong forms
+            {"\xC0\x80", 0xFFFD, 1},
+            {"\xC1\xBF", 0xFFFD, 1},
+            {"\xE0\x80\x80", 0xFFFD, 1},
+            {"\xE0\x9F\xBF", 0xFFFD, 1},
+            {"\xF0\x80\x80\x80", 0xFFFD, 1},
+            {"\xF0\x8F\xBF\xBF", 0xFFFD, 1},
+
+            // surrogates
+            {"\xED\xA0\x80", 0xFFFD, 1},
+            {"\xED\xBF\xBF", 0xFFFD, 1},
+
+            // past U+10FFFF, and lead bytes that never occur
+            {"\xF4\x90\x80\x80", 0xFFFD, 1},
+            {"\xF5\x80\x80\x80", 0xFFFD, 1},
+            {"\xF7\xBF\xBF\xBF", 0xFFFD, 1},
+            {"\xF8\x88\x80\x80\x80", 0xFFFD, 1},
+            {"\xFE", 0xFFFD, 1},
+            {"\xFF", 0xFFFD, 1},
+        };
+
+        for (const auto& d : table) {
+            size_t length = 0;
+            const char32_t cp = unicode::decode_utf8(d.bytes, length);
+            CHECK(cp == d.cp && length == d.length);
+            if (cp != d.cp || length != d.length)
+                std::fprintf(stderr, "  U+%04X (%zu bytes), expected U+%04X (%zu bytes)\n", static_cast<unsigned>(cp), length, static_cast<unsigned>(d.cp), d.length);
+        }
+    }
+
+    struct width {
+        char32_t cp;
+        int columns;
+    };
+
+    void widths() {
+        constexpr width table[] = {
+            // controls
+            {0x00, 0}, {0x07, 0}, {0x1B, 0}, {0x1F, 0}, {0x7F, 0}, {0x80, 0}, {0x9F, 0},
+
+            // ASCII and Latin-1
+            {U' ', 1}, {U'a', 1}, {U'~', 1}, {0xA0, 1}, {0xAD, 1}, {U'é', 1},
+
+            // combining marks and other zero width characters
+            {0x0300, 0}, {0x0301, 0}, {0x036F, 0}, {0x0483, 0}, {0x0591, 0}, {0x093C, 0},
+            {0x1160, 0}, {0x11FF, 0}, {0x200B, 0}, {0x200D, 0}, {0x20DD, 0}, {0xFE0F, 0}, {0xFEFF, 0},
+            {0xE0001, 0}, {0xE0100, 0},
+
+            // CJK, Hangul syllables and fullwidth forms
+            {0x1100, 2}, {0x3000, 2}, {U'あ', 2}, {U'中', 2}, {U'文', 2}, {0x9FFF, 2}, {0xAC00, 2}, {0xD7A3, 2},
+            {0xFF01, 2}, {0xFF60, 2}, {0xFF61, 1}, {0x20000, 2}, {0x2FFFD, 2}, {0x30000, 2},
+
+            // emoji with default emoji presentation are wide, text presentation ones are not
+            {U'😀', 2}, {0x1F680, 2}, {0x1F44D, 2}, {0x231A, 2}, {0x2600, 1}, {0x2764, 1},
+
+            // narrow neighbours of wide ranges
+            {0x10FF, 1}, {0x303F, 1}, {0xA4D0, 1}, {0xA960, 2}, {0x10FFFF, 1},
+        };
+
+        for (const auto& w : table) {
+            const int columns = unicode::codepoint_width(w.cp);
+            CHECK(columns == w.columns);
+            if (columns != w.columns)
+                std::fprintf(stderr, "  U+%04X: %d columns, expected %d\n", static_cast<unsigned>(w.cp), columns, w.columns);
+        }
+    }
+
+    void ascii_runs() {
+        CHECK(unicode::ascii_run("") == 0);
+        CHECK(unicode::ascii_run("\x1B[0m") == 0);
+        CHECK(unicode::ascii_run("ab\x7F") == 2);
+
+        // the end of the run at every offset around the 16 and 32 byte vectors, by each kind of stop
+        for (std::string_view stop : {"\x1B", "\x7F", "\x80", "\xFF", "\n", "中"}) {
+            for (size_t run = 0; run < 70; ++run) {
+                std::string text(run, 'x');
+                text += stop;
+                text += "yyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyy";
+                const size_t found = unicode::ascii_run(text);
+                CHECK(found == run);
+                if (found != run)
+                    std::fprintf(stderr, "  run of %zu before \\x%02X found as %zu\n", run, static_cast<unsigned char>(stop[0]), found);
+            }
+        }
+
+        // printable through to the end, crossing the boundaries
+        for (size_t size : {15u, 16u, 17u, 31u, 32u, 33u, 64u, 65u}) {
+            CHECK(unicode::ascii_run(std::string(size, ' ')) == size);
+        }
+
+        // the run stops at the end of the view, not at what follows it in memory
+        constexpr std::string_view longer{"0123456789abcdefghijklmnopqrstuvwxyz0123456789"};
+        CHECK(unicode::ascii_run(longer.substr(0, 33)) == 33);
+        CHECK(unicode::ascii_run(longer.substr(3, 30)) == 30);
+    }
+
+} // namespace
+
+int main() {
+    decode();
+    widths();
+    ascii_runs();
+    return holofetch::test::result();
+}